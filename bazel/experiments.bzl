@@ -52,6 +52,9 @@ EXPERIMENTS = {
             "periodic_resource_quota_reclamation",
             "unconstrained_max_quota_buffer_size",
         ],
+        "timer_test": [
+            "timer_wheel",
+        ],
     },
     "on": {
     },
@@ -251,6 +251,7 @@
         'test/core/end2end/tests/retry_exceeds_buffer_size_in_delay.cc',
         'test/core/end2end/tests/retry_exceeds_buffer_size_in_initial_batch.cc',
         'test/core/end2end/tests/retry_exceeds_buffer_size_in_subsequent_batch.cc',
+        'test/core/end2end/tests/retry_hedging.cc',
         'test/core/end2end/tests/retry_lb_drop.cc',
         'test/core/end2end/tests/retry_lb_fail.cc',
         'test/core/end2end/tests/retry_non_retriable_status.cc',
@@ -393,6 +394,8 @@
         'src/core/ext/filters/client_channel/lb_policy/grpclb/grpclb_balancer_addresses.cc',
         'src/core/ext/filters/client_channel/lb_policy/grpclb/grpclb_client_stats.cc',
         'src/core/ext/filters/client_channel/lb_policy/grpclb/load_balancer_api.cc',
+        'src/core/ext/filters/client_channel/lb_policy/least_request/least_request.cc',
+        'src/core/ext/filters/client_channel/lb_policy/maglev/maglev.cc',
         'src/core/ext/filters/client_channel/lb_policy/oob_backend_metric.cc',
         'src/core/ext/filters/client_channel/lb_policy/outlier_detection/outlier_detection.cc',
         'src/core/ext/filters/client_channel/lb_policy/pick_first/pick_first.cc',
@@ -400,6 +403,7 @@
         'src/core/ext/filters/client_channel/lb_policy/ring_hash/ring_hash.cc',
         'src/core/ext/filters/client_channel/lb_policy/rls/rls.cc',
         'src/core/ext/filters/client_channel/lb_policy/round_robin/round_robin.cc',
+        'src/core/ext/filters/client_channel/lb_policy/weighted_round_robin/weighted_round_robin.cc',
         'src/core/ext/filters/client_channel/lb_policy/weighted_target/weighted_target.cc',
         'src/core/ext/filters/client_channel/lb_policy/xds/cds.cc',
         'src/core/ext/filters/client_channel/lb_policy/xds/xds_cluster_impl.cc',
@@ -810,6 +814,7 @@
         'src/core/lib/event_engine/posix_engine/timer.cc',
         'src/core/lib/event_engine/posix_engine/timer_heap.cc',
         'src/core/lib/event_engine/posix_engine/timer_manager.cc',
+        'src/core/lib/event_engine/posix_engine/timer_wheel.cc',
         'src/core/lib/event_engine/resolved_address.cc',
         'src/core/lib/event_engine/slice.cc',
         'src/core/lib/event_engine/slice_buffer.cc',
@@ -820,6 +825,7 @@
         'src/core/lib/event_engine/windows/iocp.cc',
         'src/core/lib/event_engine/windows/win_socket.cc',
         'src/core/lib/event_engine/windows/windows_engine.cc',
+        'src/core/lib/event_engine/work_queue.cc',
         'src/core/lib/experiments/config.cc',
         'src/core/lib/experiments/experiments.cc',
         'src/core/lib/gpr/murmur_hash.cc',
@@ -899,6 +905,7 @@
         'src/core/lib/iomgr/timer_generic.cc',
         'src/core/lib/iomgr/timer_heap.cc',
         'src/core/lib/iomgr/timer_manager.cc',
+        'src/core/lib/iomgr/timer_wheel.cc',
         'src/core/lib/iomgr/unix_sockets_posix.cc',
         'src/core/lib/iomgr/unix_sockets_posix_noop.cc',
         'src/core/lib/iomgr/wakeup_fd_eventfd.cc',
@@ -919,6 +926,7 @@
         'src/core/lib/resolver/server_address.cc',
         'src/core/lib/resource_quota/api.cc',
         'src/core/lib/resource_quota/arena.cc',
+        'src/core/lib/resource_quota/arena_pool.cc',
         'src/core/lib/resource_quota/memory_quota.cc',
         'src/core/lib/resource_quota/periodic_update.cc',
         'src/core/lib/resource_quota/resource_quota.cc',
@@ -993,6 +1001,8 @@
         'src/core/lib/slice/slice_buffer.cc',
         'src/core/lib/slice/slice_refcount.cc',
         'src/core/lib/slice/slice_string_helpers.cc',
+        'src/core/lib/slice/small_slice_allocator.cc',
+        'src/core/lib/surface/admission_control.cc',
         'src/core/lib/surface/api_trace.cc',
         'src/core/lib/surface/builtins.cc',
         'src/core/lib/surface/byte_buffer.cc',
@@ -1146,6 +1156,8 @@
         'src/core/ext/filters/client_channel/lb_policy/grpclb/grpclb_balancer_addresses.cc',
         'src/core/ext/filters/client_channel/lb_policy/grpclb/grpclb_client_stats.cc',
         'src/core/ext/filters/client_channel/lb_policy/grpclb/load_balancer_api.cc',
+        'src/core/ext/filters/client_channel/lb_policy/least_request/least_request.cc',
+        'src/core/ext/filters/client_channel/lb_policy/maglev/maglev.cc',
         'src/core/ext/filters/client_channel/lb_policy/oob_backend_metric.cc',
         'src/core/ext/filters/client_channel/lb_policy/outlier_detection/outlier_detection.cc',
         'src/core/ext/filters/client_channel/lb_policy/pick_first/pick_first.cc',
@@ -1153,6 +1165,7 @@
         'src/core/ext/filters/client_channel/lb_policy/ring_hash/ring_hash.cc',
         'src/core/ext/filters/client_channel/lb_policy/rls/rls.cc',
         'src/core/ext/filters/client_channel/lb_policy/round_robin/round_robin.cc',
+        'src/core/ext/filters/client_channel/lb_policy/weighted_round_robin/weighted_round_robin.cc',
         'src/core/ext/filters/client_channel/lb_policy/weighted_target/weighted_target.cc',
         'src/core/ext/filters/client_channel/local_subchannel_pool.cc',
         'src/core/ext/filters/client_channel/resolver/binder/binder_resolver.cc',
@@ -1260,6 +1273,7 @@
         'src/core/lib/event_engine/posix_engine/timer.cc',
         'src/core/lib/event_engine/posix_engine/timer_heap.cc',
         'src/core/lib/event_engine/posix_engine/timer_manager.cc',
+        'src/core/lib/event_engine/posix_engine/timer_wheel.cc',
         'src/core/lib/event_engine/resolved_address.cc',
         'src/core/lib/event_engine/slice.cc',
         'src/core/lib/event_engine/slice_buffer.cc',
@@ -1270,6 +1284,7 @@
         'src/core/lib/event_engine/windows/iocp.cc',
         'src/core/lib/event_engine/windows/win_socket.cc',
         'src/core/lib/event_engine/windows/windows_engine.cc',
+        'src/core/lib/event_engine/work_queue.cc',
         'src/core/lib/experiments/config.cc',
         'src/core/lib/experiments/experiments.cc',
         'src/core/lib/gpr/murmur_hash.cc',
@@ -1348,6 +1363,7 @@
         'src/core/lib/iomgr/timer_generic.cc',
         'src/core/lib/iomgr/timer_heap.cc',
         'src/core/lib/iomgr/timer_manager.cc',
+        'src/core/lib/iomgr/timer_wheel.cc',
         'src/core/lib/iomgr/unix_sockets_posix.cc',
         'src/core/lib/iomgr/unix_sockets_posix_noop.cc',
         'src/core/lib/iomgr/wakeup_fd_eventfd.cc',
@@ -1367,6 +1383,7 @@
         'src/core/lib/resolver/server_address.cc',
         'src/core/lib/resource_quota/api.cc',
         'src/core/lib/resource_quota/arena.cc',
+        'src/core/lib/resource_quota/arena_pool.cc',
         'src/core/lib/resource_quota/memory_quota.cc',
         'src/core/lib/resource_quota/periodic_update.cc',
         'src/core/lib/resource_quota/resource_quota.cc',
@@ -1403,6 +1420,8 @@
         'src/core/lib/slice/slice_buffer.cc',
         'src/core/lib/slice/slice_refcount.cc',
         'src/core/lib/slice/slice_string_helpers.cc',
+        'src/core/lib/slice/small_slice_allocator.cc',
+        'src/core/lib/surface/admission_control.cc',
         'src/core/lib/surface/api_trace.cc',
         'src/core/lib/surface/builtins.cc',
         'src/core/lib/surface/byte_buffer.cc',
@@ -124,6 +124,24 @@ GRPCAPI grpc_event grpc_completion_queue_next(grpc_completion_queue* cq,
                                               gpr_timespec deadline,
                                               void* reserved);
 
+/** Like grpc_completion_queue_next, but once an event is available also
+    returns up to max_events - 1 further events that are already queued,
+    without polling again. This amortises the cost of a
+    grpc_completion_queue_next call over many events when completions arrive
+    faster than a thread can dequeue them one at a time.
+
+    events must point to an array of at least max_events (> 0) elements.
+    Returns the number of events written to it, which is at least one. If
+    events[0] has type GRPC_QUEUE_TIMEOUT or GRPC_QUEUE_SHUTDOWN it is the
+    only event returned.
+
+    Only valid for completion queues of type GRPC_CQ_NEXT. The same
+    restrictions as for grpc_completion_queue_next apply. */
+GRPCAPI int grpc_completion_queue_next_batch(grpc_completion_queue* cq,
+                                             grpc_event* events, int max_events,
+                                             gpr_timespec deadline,
+                                             void* reserved);
+
 /** Blocks until an event with tag 'tag' is available, the completion queue is
     being shutdown or deadline is reached.
 
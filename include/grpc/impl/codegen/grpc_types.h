@@ -232,6 +232,18 @@ typedef struct {
 /** How much data are we willing to queue up per stream if
     GRPC_WRITE_BUFFER_HINT is set? This is an upper bound */
 #define GRPC_ARG_HTTP2_WRITE_BUFFER_SIZE "grpc.http2.write_buffer_size"
+/** How long may a write on an http2 connection be held back so that frames
+    from other streams becoming ready in the meantime go out in the same
+    write? Writes not carrying new stream data (settings, pings, window
+    updates, cancellations...) are never held. Int valued, milliseconds.
+    Defaults to 0 (writes are never held). */
+#define GRPC_ARG_HTTP2_WRITE_COALESCING_WINDOW_MS \
+  "grpc.http2.write_coalescing_window_ms"
+/** Once this many bytes of messages are waiting in a held write, it is sent
+    without waiting for the rest of GRPC_ARG_HTTP2_WRITE_COALESCING_WINDOW_MS.
+    Int valued, bytes. Defaults to 64KiB. */
+#define GRPC_ARG_HTTP2_WRITE_COALESCING_BYTES \
+  "grpc.http2.write_coalescing_bytes"
 /** Should we allow receipt of true-binary data on http2 connections?
     Defaults to on (1) */
 #define GRPC_ARG_HTTP2_ENABLE_TRUE_BINARY "grpc.http2.true_binary"
@@ -268,6 +280,17 @@ typedef struct {
 /** The timeout used on servers for finishing handshaking on an incoming
     connection.  Defaults to 120 seconds. */
 #define GRPC_ARG_SERVER_HANDSHAKE_TIMEOUT_MS "grpc.server_handshake_timeout_ms"
+/** If set to a positive value, enables queue delay admission control on a
+    server. Once every incoming call in an interval has waited at least this
+    long (in milliseconds) for the application to take it, calls that wait
+    more than twice as long, and new calls queueing behind them, are failed
+    with RESOURCE_EXHAUSTED until the delay drops again. Int valued. */
+#define GRPC_ARG_SERVER_QUEUE_DELAY_TARGET_MS \
+  "grpc.server_queue_delay_target_ms"
+/** The interval (in milliseconds) over which queue delay admission control
+    tracks the minimum queueing delay. Defaults to 100ms. Int valued. */
+#define GRPC_ARG_SERVER_QUEUE_DELAY_INTERVAL_MS \
+  "grpc.server_queue_delay_interval_ms"
 /** This *should* be used for testing only.
     The caller of the secure_channel_create functions may override the target
     name used for SSL host name checking using this channel argument which is of
@@ -293,6 +316,14 @@ typedef struct {
 #define GRPC_ARG_MAX_METADATA_SIZE "grpc.max_metadata_size"
 /** If non-zero, allow the use of SO_REUSEPORT if it's available (default 1) */
 #define GRPC_ARG_ALLOW_REUSEPORT "grpc.so_reuseport"
+/** If non-zero and SO_REUSEPORT is in use, the server opens one listener per
+    server completion queue and binds every connection a listener accepts to
+    that completion queue's pollset, instead of assigning connections to
+    completion queues round-robin. This gives completion-queue affinity only:
+    the kernel still picks the listener, and with pollers such as epoll1 the
+    listeners and connections may still be polled from any completion queue.
+    Defaults to 0. */
+#define GRPC_ARG_SHARD_REUSEPORT_LISTENERS "grpc.shard_reuseport_listeners"
 /** If non-zero, a pointer to a buffer pool (a pointer of type
  * grpc_resource_quota*). (use grpc_resource_quota_arg_vtable() to fetch an
  * appropriate pointer arg vtable) */
@@ -379,6 +410,12 @@ typedef struct {
    over to the next priority. Default value is 10 seconds. */
 #define GRPC_ARG_PRIORITY_FAILOVER_TIMEOUT_MS \
   "grpc.priority_failover_timeout_ms"
+/* Delay in milliseconds after which the pick_first LB policy starts a
+   connection attempt to the next address while the previous attempts are
+   still in progress ("Connection Attempt Delay" in RFC 8305). Values below
+   100 are clamped to 100. Default value is 250. */
+#define GRPC_ARG_HAPPY_EYEBALLS_CONNECTION_ATTEMPT_DELAY_MS \
+  "grpc.happy_eyeballs_connection_attempt_delay_ms"
 /** If non-zero, grpc server's cronet compression workaround will be enabled */
 #define GRPC_ARG_WORKAROUND_CRONET_COMPRESSION \
   "grpc.workaround.cronet_compression"
@@ -395,17 +432,16 @@ typedef struct {
     retries are enabled when they are configured via the service config.
     For details, see:
       https://github.com/grpc/proposal/blob/master/A6-client-retries.md
-    NOTE: Hedging functionality is not yet implemented, so those
-          fields in the service config will currently be ignored.  See
-          also the GRPC_ARG_EXPERIMENTAL_ENABLE_HEDGING arg below.
+    NOTE: Hedging policies in the service config are ignored unless
+          the GRPC_ARG_EXPERIMENTAL_ENABLE_HEDGING arg below is also set.
  */
 #define GRPC_ARG_ENABLE_RETRIES "grpc.enable_retries"
 /** Enables hedging functionality, as described in:
       https://github.com/grpc/proposal/blob/master/A6-client-retries.md
-    Default is currently false, since this functionality is not yet
-    fully implemented.
+    Default is currently false, since this functionality is still
+    experimental.
     NOTE: This channel arg is experimental and will eventually be removed.
-          Once hedging functionality has been implemented and proves stable,
+          Once hedging functionality proves stable,
           this arg will be removed, and the hedging functionality will
           be enabled via the GRPC_ARG_ENABLE_RETRIES arg above. */
 #define GRPC_ARG_EXPERIMENTAL_ENABLE_HEDGING "grpc.experimental.enable_hedging"
@@ -787,8 +823,9 @@ typedef struct grpc_completion_queue_functor {
   struct grpc_completion_queue_functor* internal_next;
 } grpc_completion_queue_functor;
 
-#define GRPC_CQ_CURRENT_VERSION 2
+#define GRPC_CQ_CURRENT_VERSION 3
 #define GRPC_CQ_VERSION_MINIMUM_FOR_CALLBACKABLE 2
+#define GRPC_CQ_VERSION_MINIMUM_FOR_SHARDING 3
 typedef struct grpc_completion_queue_attributes {
   /** The version number of this structure. More fields might be added to this
      structure in future. */
@@ -806,6 +843,16 @@ typedef struct grpc_completion_queue_attributes {
   grpc_completion_queue_functor* cq_shutdown_cb;
 
   /* END OF VERSION 2 CQ ATTRIBUTES */
+
+  /* START OF VERSION 3 CQ ATTRIBUTES */
+  /** If non-zero, a GRPC_CQ_NEXT completion queue keeps its completed events
+   * in per-cpu shards, so that many threads can call
+   * grpc_completion_queue_next on it without contending with each other.
+   * Events are no longer returned in completion order across threads.
+   * Ignored for other completion types. */
+  int cq_sharded;
+
+  /* END OF VERSION 3 CQ ATTRIBUTES */
 } grpc_completion_queue_attributes;
 
 /** The completion queue factory structure is opaque to the callers of grpc */
@@ -108,7 +108,7 @@ class CompletionQueue : private grpc::GrpcLibraryCodegen {
   CompletionQueue()
       : CompletionQueue(grpc_completion_queue_attributes{
             GRPC_CQ_CURRENT_VERSION, GRPC_CQ_NEXT, GRPC_CQ_DEFAULT_POLLING,
-            nullptr}) {}
+            nullptr, 0}) {}
 
   /// Wrap \a take, taking ownership of the instance.
   ///
@@ -187,6 +187,22 @@ class CompletionQueue : private grpc::GrpcLibraryCodegen {
                                   GPR_CLOCK_REALTIME)) == GOT_EVENT);
   }
 
+  /// Read up to \a max_events events from the queue, blocking until at least
+  /// one is available. Events that are already queued once the first one is
+  /// available are returned by the same call, so an event loop that keeps up
+  /// with a busy queue pays the cost of \a Next once per batch rather than
+  /// once per event.
+  ///
+  /// \param[out] tags Array of at least \a max_events elements. Updated to
+  ///        point to the events' tags.
+  /// \param[out] oks Array of at least \a max_events elements. For each
+  ///        event, as the \a ok of \a Next.
+  /// \param max_events Maximum number of events to read; must be positive.
+  ///
+  /// \return The number of events read, or 0 if the queue is fully drained
+  ///         and shut down.
+  int NextBatch(void** tags, bool* oks, int max_events);
+
   /// Read from the queue, blocking up to \a deadline (or the queue's shutdown).
   /// Both \a tag and \a ok are updated upon success (if an event is available
   /// within the \a deadline).  A \a tag points to an arbitrary location usually
@@ -448,12 +464,15 @@ class ServerCompletionQueue : public CompletionQueue {
   /// allowed on this completion queue. See grpc_cq_polling_type's description
   /// in grpc_types.h for more details.
   /// \param shutdown_cb is the shutdown callback used for CALLBACK api queues
+  /// \param is_sharded requests a NEXT queue that keeps its events in per-cpu
+  /// shards, see cq_sharded in grpc_types.h.
   ServerCompletionQueue(grpc_cq_completion_type completion_type,
                         grpc_cq_polling_type polling_type,
-                        grpc_completion_queue_functor* shutdown_cb)
+                        grpc_completion_queue_functor* shutdown_cb,
+                        bool is_sharded = false)
       : CompletionQueue(grpc_completion_queue_attributes{
             GRPC_CQ_CURRENT_VERSION, completion_type, polling_type,
-            shutdown_cb}),
+            shutdown_cb, is_sharded}),
         polling_type_(polling_type) {}
 
   grpc_cq_polling_type polling_type_;
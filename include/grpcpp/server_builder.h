@@ -162,6 +162,14 @@ class ServerBuilder {
   std::unique_ptr<grpc::ServerCompletionQueue> AddCompletionQueue(
       bool is_frequently_polled = true);
 
+  /// As above, but if \a is_sharded is true the completion queue keeps its
+  /// completed events in per-cpu shards. Many threads can then call \a Next()
+  /// on one sharded completion queue without contending with each other, so
+  /// it can take the place of one completion queue per polling thread.
+  /// Events are not returned in completion order across threads.
+  std::unique_ptr<grpc::ServerCompletionQueue> AddCompletionQueue(
+      bool is_frequently_polled, bool is_sharded);
+
   //////////////////////////////////////////////////////////////////////////////
   // Less commonly used RegisterService variants
 
@@ -181,6 +181,7 @@ class ClientChannel {
   class ClientChannelControlHelper;
   class ConnectivityWatcherAdder;
   class ConnectivityWatcherRemover;
+  class PickerReader;
 
   // Represents a pending connectivity callback from an external caller
   // via grpc_client_channel_watch_connectivity_state().
@@ -291,6 +292,10 @@ class ClientChannel {
                                 grpc_polling_entity* pollent)
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(resolution_mu_);
 
+  // Waits until no PickerReader can still be using a picker that was
+  // replaced before this method was called.
+  void WaitForPickerReaders();
+
   // These methods all require holding data_plane_mu_.
   void AddLbQueuedCall(LbQueuedCall* call, grpc_polling_entity* pollent)
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(data_plane_mu_);
@@ -329,11 +334,27 @@ class ClientChannel {
       ABSL_GUARDED_BY(resolution_mu_);
 
   //
-  // Fields used in the data plane.  Guarded by data_plane_mu_.
+  // Fields used in the data plane.
   //
+  // The current picker, owned by the channel.  Calls pick from it without
+  // holding any lock, inside a PickerReader; it is replaced only while
+  // holding data_plane_mu_, and a replaced picker is destroyed once
+  // WaitForPickerReaders() returns.
+  std::atomic<LoadBalancingPolicy::SubchannelPicker*> picker_{nullptr};
+  // Number of PickerReaders in progress, sharded by thread to keep readers
+  // on different cores from contending for a cache line, and split by
+  // the parity of picker_epoch_ so that WaitForPickerReaders() is not held
+  // up by readers that start after it does.
+  struct alignas(GPR_CACHELINE_SIZE) PickerReaderShard {
+    std::atomic<size_t> count[2] = {};
+  };
+  static constexpr size_t kNumPickerReaderShards = 16;
+  // Channel data is only aligned to GPR_MAX_ALIGNMENT, so the shards are
+  // allocated separately to keep each one on a cache line of its own.
+  PickerReaderShard* picker_readers_;
+  std::atomic<size_t> picker_epoch_{0};
+  // Guards queued LB picks.
   mutable Mutex data_plane_mu_;
-  std::unique_ptr<LoadBalancingPolicy::SubchannelPicker> picker_
-      ABSL_GUARDED_BY(data_plane_mu_);
   // Linked list of calls queued waiting for LB pick.
   LbQueuedCall* lb_queued_calls_ ABSL_GUARDED_BY(data_plane_mu_) = nullptr;
 
@@ -422,13 +443,21 @@ class ClientChannel::LoadBalancedCall
 
   void StartTransportStreamOpBatch(grpc_transport_stream_op_batch* batch);
 
-  // Invoked by channel for queued LB picks when the picker is updated.
+  // Performs the LB pick for the call, without taking the data plane mutex
+  // unless the call needs to be queued.
   static void PickSubchannel(void* arg, grpc_error_handle error);
   // Helper function for performing an LB pick while holding the data plane
   // mutex.  Returns true if the pick is complete, in which case the caller
   // must invoke PickDone() or AsyncPickDone() with the returned error.
+  // Used for queued LB picks when the picker is updated.
   bool PickSubchannelLocked(grpc_error_handle* error)
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(&ClientChannel::data_plane_mu_);
+  // Performs an LB pick using picker, without touching the queued picks
+  // list.  Returns true if the pick is complete, as for
+  // PickSubchannelLocked(), or false if the call needs to be queued until
+  // the picker is updated.
+  bool PickSubchannelImpl(LoadBalancingPolicy::SubchannelPicker* picker,
+                          grpc_error_handle* error);
   // Schedules a callback to process the completed pick.  The callback
   // will not run until after this method returns.
   void AsyncPickDone(grpc_error_handle error);
@@ -62,6 +62,7 @@
 #include <string.h>
 
 #include <algorithm>
+#include <atomic>
 #include <map>
 #include <memory>
 #include <string>
@@ -391,8 +392,8 @@ class GrpcLb : public LoadBalancingPolicy {
     // Returns the LB token to use for a drop, or null if the call
     // should not be dropped.
     //
-    // Note: This is called from the picker, so it will be invoked in
-    // the channel's data plane mutex, NOT the control plane
+    // Note: This is called from the picker, so it may be invoked
+    // concurrently from multiple threads, NOT in the control plane
     // work_serializer.  It should not be accessed by any other part of the LB
     // policy.
     const char* ShouldDrop();
@@ -400,10 +401,10 @@ class GrpcLb : public LoadBalancingPolicy {
    private:
     std::vector<GrpcLbServer> serverlist_;
 
-    // Guarded by the channel's data plane mutex, NOT the control
+    // Advanced atomically by concurrent picks, NOT under the control
     // plane work_serializer.  It should not be accessed by anything but the
     // picker via the ShouldDrop() method.
-    size_t drop_index_ = 0;
+    std::atomic<size_t> drop_index_{0};
   };
 
   class Picker : public SubchannelPicker {
@@ -725,8 +726,9 @@ bool GrpcLb::Serverlist::ContainsAllDropEntries() const {
 
 const char* GrpcLb::Serverlist::ShouldDrop() {
   if (serverlist_.empty()) return nullptr;
-  GrpcLbServer& server = serverlist_[drop_index_];
-  drop_index_ = (drop_index_ + 1) % serverlist_.size();
+  const size_t index =
+      drop_index_.fetch_add(1, std::memory_order_relaxed) % serverlist_.size();
+  GrpcLbServer& server = serverlist_[index];
   return server.drop ? server.load_balance_token : nullptr;
 }
 
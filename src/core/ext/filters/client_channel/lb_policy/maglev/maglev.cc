@@ -0,0 +1,176 @@
+//
+// Copyright 2022 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/ext/filters/client_channel/lb_policy/maglev/maglev.h"
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "absl/memory/memory.h"
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/string_view.h"
+
+#define XXH_INLINE_ALL
+#include "xxhash.h"
+
+#include "src/core/lib/config/core_configuration.h"
+#include "src/core/lib/debug/trace.h"
+#include "src/core/lib/gprpp/orphanable.h"
+#include "src/core/lib/gprpp/prime.h"
+#include "src/core/lib/gprpp/ref_counted_ptr.h"
+#include "src/core/lib/json/json.h"
+#include "src/core/lib/load_balancing/lb_policy.h"
+#include "src/core/lib/load_balancing/lb_policy_factory.h"
+#include "src/core/lib/load_balancing/lb_policy_registry.h"
+
+namespace grpc_core {
+
+TraceFlag grpc_lb_maglev_trace(false, "maglev_lb");
+
+namespace {
+
+// Largest table size accepted, matching Envoy.
+constexpr uint64_t kMaxTableSize = 5000011;
+
+}  // namespace
+
+// Helper Parser method
+
+const JsonLoaderInterface* MaglevConfig::JsonLoader(const JsonArgs&) {
+  static const auto* loader =
+      JsonObjectLoader<MaglevConfig>()
+          .OptionalField("tableSize", &MaglevConfig::table_size)
+          .Finish();
+  return loader;
+}
+
+void MaglevConfig::JsonPostLoad(const Json&, const JsonArgs&,
+                                ValidationErrors* errors) {
+  ValidationErrors::ScopedField field(errors, ".tableSize");
+  if (!errors->FieldHasErrors() &&
+      (table_size > kMaxTableSize || !IsPrime(table_size))) {
+    errors->AddError("must be a prime number no larger than 5000011");
+  }
+}
+
+//
+// MaglevTable
+//
+
+MaglevTable::MaglevTable(const std::vector<HashedEndpoint>& endpoints,
+                         size_t table_size) {
+  if (endpoints.empty()) return;
+  // Per-endpoint state while populating the table.  The endpoint's
+  // preference list is slot (offset + skip * i) % table_size for
+  // i = 0, 1, ..., which visits every slot exactly once since table_size is
+  // prime; slot is the next candidate in that list.
+  struct BuildEntry {
+    uint64_t slot;
+    uint64_t skip;
+    uint64_t weight;
+    uint64_t target_weight = 0;
+  };
+  std::vector<BuildEntry> build_entries;
+  build_entries.reserve(endpoints.size());
+  uint64_t max_weight = 0;
+  for (const auto& endpoint : endpoints) {
+    const std::string& address = endpoint.address;
+    BuildEntry entry;
+    entry.slot = XXH64(address.data(), address.size(), 0) % table_size;
+    entry.skip =
+        XXH64(address.data(), address.size(), 1) % (table_size - 1) + 1;
+    entry.weight = endpoint.weight;
+    max_weight = std::max(max_weight, entry.weight);
+    build_entries.push_back(entry);
+  }
+  constexpr uint32_t kEmpty = std::numeric_limits<uint32_t>::max();
+  entries_.assign(table_size, kEmpty);
+  size_t filled = 0;
+  for (uint64_t iteration = 1; filled < table_size; ++iteration) {
+    for (size_t i = 0; i < build_entries.size() && filled < table_size; ++i) {
+      BuildEntry& entry = build_entries[i];
+      // An endpoint with the largest weight claims a slot on every
+      // iteration, while one with a third of that weight claims a slot on
+      // every third iteration.
+      if (iteration * entry.weight < entry.target_weight) continue;
+      entry.target_weight += max_weight;
+      while (entries_[entry.slot] != kEmpty) {
+        entry.slot += entry.skip;
+        if (entry.slot >= table_size) entry.slot -= table_size;
+      }
+      entries_[entry.slot] = static_cast<uint32_t>(i);
+      ++filled;
+    }
+  }
+}
+
+namespace {
+
+constexpr absl::string_view kMaglev = "maglev_experimental";
+
+class MaglevLbConfig : public HashTableLbConfig {
+ public:
+  explicit MaglevLbConfig(size_t table_size) : table_size_(table_size) {}
+  absl::string_view name() const override { return kMaglev; }
+
+  std::unique_ptr<HashedEndpointTable> MakeTable(
+      const std::vector<HashedEndpoint>& endpoints) const override {
+    return absl::make_unique<MaglevTable>(endpoints, table_size_);
+  }
+
+ private:
+  size_t table_size_;
+};
+
+//
+// factory
+//
+
+class MaglevFactory : public LoadBalancingPolicyFactory {
+ public:
+  OrphanablePtr<LoadBalancingPolicy> CreateLoadBalancingPolicy(
+      LoadBalancingPolicy::Args args) const override {
+    static const HashTableLbPolicyInfo kInfo = {
+        kMaglev, "MG", "maglev hash", &grpc_lb_maglev_trace};
+    return MakeHashTableLbPolicy(std::move(args), kInfo);
+  }
+
+  absl::string_view name() const override { return kMaglev; }
+
+  absl::StatusOr<RefCountedPtr<LoadBalancingPolicy::Config>>
+  ParseLoadBalancingConfig(const Json& json) const override {
+    auto config = LoadFromJson<MaglevConfig>(
+        json, JsonArgs(), "errors validating maglev LB policy config");
+    if (!config.ok()) return config.status();
+    return MakeRefCounted<MaglevLbConfig>(config->table_size);
+  }
+};
+
+}  // namespace
+
+void RegisterMaglevLbPolicy(CoreConfiguration::Builder* builder) {
+  builder->lb_policy_registry()->RegisterLoadBalancingPolicyFactory(
+      absl::make_unique<MaglevFactory>());
+}
+
+}  // namespace grpc_core
@@ -0,0 +1,74 @@
+//
+// Copyright 2022 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#ifndef GRPC_CORE_EXT_FILTERS_CLIENT_CHANNEL_LB_POLICY_MAGLEV_MAGLEV_H
+#define GRPC_CORE_EXT_FILTERS_CLIENT_CHANNEL_LB_POLICY_MAGLEV_MAGLEV_H
+
+#include <grpc/support/port_platform.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <vector>
+
+#include "src/core/ext/filters/client_channel/lb_policy/ring_hash/ring_hash.h"
+#include "src/core/lib/gprpp/validation_errors.h"
+#include "src/core/lib/json/json.h"
+#include "src/core/lib/json/json_args.h"
+#include "src/core/lib/json/json_object_loader.h"
+
+namespace grpc_core {
+
+// Helper Parsing method to parse maglev policy configs; for example, table
+// size validity.
+struct MaglevConfig {
+  uint64_t table_size = 65537;
+
+  static const JsonLoaderInterface* JsonLoader(const JsonArgs&);
+  void JsonPostLoad(const Json& json, const JsonArgs&,
+                    ValidationErrors* errors);
+};
+
+// The lookup table used by the maglev policy, as described in "Maglev: A
+// Fast and Reliable Software Network Load Balancer" (NSDI 2016).
+//
+// Each endpoint fills table slots in the order given by its own permutation
+// of the table, derived from two hashes of its address, and the endpoints
+// take turns in proportion to their weights until the table is full.  A
+// request hash owns slot (hash % table_size), so a pick is a single array
+// lookup, and adding or removing an endpoint only moves a small fraction of
+// the slots.  The table size must be prime.
+class MaglevTable : public HashedEndpointTable {
+ public:
+  MaglevTable() = default;
+  MaglevTable(const std::vector<HashedEndpoint>& endpoints, size_t table_size);
+
+  // Each entry is the index of an endpoint in the list that the table was
+  // built from.
+  const std::vector<uint32_t>& entries() const { return entries_; }
+
+  size_t size() const override { return entries_.size(); }
+  // Returns the index in entries() of the slot that owns hash h.
+  size_t FindIndex(uint64_t h) const override { return h % entries_.size(); }
+  size_t EndpointIndex(size_t i) const override { return entries_[i]; }
+
+ private:
+  std::vector<uint32_t> entries_;
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_CORE_EXT_FILTERS_CLIENT_CHANNEL_LB_POLICY_MAGLEV_MAGLEV_H
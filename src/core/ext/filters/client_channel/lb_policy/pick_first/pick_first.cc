@@ -37,12 +37,18 @@
 #include <grpc/support/log.h>
 
 #include "src/core/ext/filters/client_channel/lb_policy/subchannel_list.h"
+#include "src/core/lib/address_utils/sockaddr_utils.h"
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/config/core_configuration.h"
 #include "src/core/lib/debug/trace.h"
 #include "src/core/lib/gprpp/debug_location.h"
 #include "src/core/lib/gprpp/orphanable.h"
 #include "src/core/lib/gprpp/ref_counted_ptr.h"
+#include "src/core/lib/gprpp/time.h"
+#include "src/core/lib/gprpp/work_serializer.h"
+#include "src/core/lib/iomgr/closure.h"
+#include "src/core/lib/iomgr/error.h"
+#include "src/core/lib/iomgr/timer.h"
 #include "src/core/lib/json/json.h"
 #include "src/core/lib/load_balancing/lb_policy.h"
 #include "src/core/lib/load_balancing/lb_policy_factory.h"
@@ -63,6 +69,10 @@ namespace {
 
 constexpr absl::string_view kPickFirst = "pick_first";
 
+// Defaults for the Connection Attempt Delay from RFC 8305 section 8.
+constexpr Duration kDefaultConnectionAttemptDelay = Duration::Milliseconds(250);
+constexpr Duration kMinConnectionAttemptDelay = Duration::Milliseconds(100);
+
 class PickFirst : public LoadBalancingPolicy {
  public:
   explicit PickFirst(Args args);
@@ -95,6 +105,18 @@ class PickFirst : public LoadBalancingPolicy {
 
     // Processes the connectivity change to READY for an unselected subchannel.
     void ProcessUnselectedReadyLocked();
+
+    // Records a connection failure for this subchannel, and reports
+    // TRANSIENT_FAILURE once every subchannel in the list has failed.
+    void ProcessTransientFailureLocked();
+
+    bool seen_transient_failure() const { return seen_transient_failure_; }
+    void reset_seen_transient_failure() { seen_transient_failure_ = false; }
+
+   private:
+    // Has this subchannel failed since the list last reported
+    // TRANSIENT_FAILURE?
+    bool seen_transient_failure_ = false;
   };
 
   class PickFirstSubchannelList
@@ -108,7 +130,12 @@ class PickFirst : public LoadBalancingPolicy {
                               ? "PickFirstSubchannelList"
                               : nullptr),
                          std::move(addresses), policy->channel_control_helper(),
-                         args) {
+                         args),
+          connection_attempt_delay_(std::max(
+              kMinConnectionAttemptDelay,
+              args.GetDurationFromIntMillis(
+                      GRPC_ARG_HAPPY_EYEBALLS_CONNECTION_ATTEMPT_DELAY_MS)
+                  .value_or(kDefaultConnectionAttemptDelay))) {
       // Need to maintain a ref to the LB policy as long as we maintain
       // any references to subchannels, since the subchannels'
       // pollset_sets will include the LB policy's pollset_set.
@@ -138,9 +165,47 @@ class PickFirst : public LoadBalancingPolicy {
       return true;
     }
 
+    bool AllSubchannelsSeenTransientFailure() {
+      for (size_t i = 0; i < num_subchannels(); ++i) {
+        if (!subchannel(i)->seen_transient_failure()) return false;
+      }
+      return true;
+    }
+
+    // Starts a connection attempt on the subchannel at index, without
+    // cancelling the attempts already in flight.  If there are subchannels
+    // after it, the next one is attempted when the connection attempt delay
+    // expires or when this attempt fails, whichever comes first.
+    void StartConnectionAttemptLocked(size_t index);
+
+    void MaybeCancelConnectionAttemptTimerLocked();
+
+    void Orphan() override {
+      MaybeCancelConnectionAttemptTimerLocked();
+      SubchannelList::Orphan();
+    }
+
    private:
+    // One arming of the connection attempt timer.  Each arming gets its own
+    // timer and closure, because the callback of a cancelled arming may
+    // still be pending when the timer is re-armed.
+    struct ConnectionAttemptTimer {
+      PickFirstSubchannelList* subchannel_list;
+      grpc_timer timer;
+      grpc_closure closure;
+    };
+
+    static void OnConnectionAttemptTimer(void* arg, grpc_error_handle error);
+    void OnConnectionAttemptTimerLocked(ConnectionAttemptTimer* timer,
+                                        grpc_error_handle error);
+
+    const Duration connection_attempt_delay_;
     bool in_transient_failure_ = false;
     size_t attempting_index_ = 0;
+    // The currently armed connection attempt timer, or null if none is
+    // pending.  A callback whose arming is no longer current acts as a
+    // cancellation.
+    ConnectionAttemptTimer* connection_attempt_timer_ = nullptr;
   };
 
   class Picker : public SubchannelPicker {
@@ -215,11 +280,38 @@ void PickFirst::ResetBackoffLocked() {
   }
 }
 
+// Reorders the addresses so that address families alternate, starting with
+// the family of the first address, as described in RFC 8305 section 4.  That
+// way, a broken family costs at most one connection attempt delay before an
+// address of the other family is tried.  The order of the addresses within
+// each family is preserved.
+ServerAddressList InterleaveAddressFamilies(
+    const ServerAddressList& addresses) {
+  if (addresses.empty()) return addresses;
+  const int first_family = grpc_sockaddr_get_family(&addresses[0].address());
+  std::vector<const ServerAddress*> first;
+  std::vector<const ServerAddress*> other;
+  for (const ServerAddress& address : addresses) {
+    if (grpc_sockaddr_get_family(&address.address()) == first_family) {
+      first.push_back(&address);
+    } else {
+      other.push_back(&address);
+    }
+  }
+  ServerAddressList interleaved;
+  interleaved.reserve(addresses.size());
+  for (size_t i = 0; i < first.size() || i < other.size(); ++i) {
+    if (i < first.size()) interleaved.push_back(*first[i]);
+    if (i < other.size()) interleaved.push_back(*other[i]);
+  }
+  return interleaved;
+}
+
 void PickFirst::AttemptToConnectUsingLatestUpdateArgsLocked() {
   // Create a subchannel list from latest_update_args_.
   ServerAddressList addresses;
   if (latest_update_args_.addresses.ok()) {
-    addresses = *latest_update_args_.addresses;
+    addresses = InterleaveAddressFamilies(*latest_update_args_.addresses);
   }
   // Replace latest_pending_subchannel_list_.
   if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_pick_first_trace) &&
@@ -387,78 +479,43 @@ void PickFirst::PickFirstSubchannelData::ProcessConnectivityChangeLocked(
   // the subchannels report their state.
   if (!old_state.has_value()) {
     if (subchannel_list()->AllSubchannelsSeenInitialState()) {
-      subchannel_list()->subchannel(0)->subchannel()->RequestConnection();
+      subchannel_list()->StartConnectionAttemptLocked(0);
     }
     return;
   }
-  // Ignore any other updates for subchannels we're not currently trying to
-  // connect to.
-  if (Index() != subchannel_list()->attempting_index()) return;
   // Otherwise, process connectivity state.
   switch (new_state) {
     case GRPC_CHANNEL_READY:
       // Already handled this case above, so this should not happen.
       GPR_UNREACHABLE_CODE(break);
     case GRPC_CHANNEL_TRANSIENT_FAILURE: {
-      size_t next_index = (Index() + 1) % subchannel_list()->num_subchannels();
-      subchannel_list()->set_attempting_index(next_index);
-      PickFirstSubchannelData* sd = subchannel_list()->subchannel(next_index);
-      // If we're tried all subchannels, set state to TRANSIENT_FAILURE.
-      if (sd->Index() == 0) {
-        if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_pick_first_trace)) {
-          gpr_log(GPR_INFO,
-                  "Pick First %p subchannel list %p failed to connect to "
-                  "all subchannels",
-                  p, subchannel_list());
-        }
-        subchannel_list()->set_in_transient_failure(true);
-        // In case 2, swap to the new subchannel list.  This means reporting
-        // TRANSIENT_FAILURE and dropping the existing (working) connection,
-        // but we can't ignore what the control plane has told us.
-        if (subchannel_list() == p->latest_pending_subchannel_list_.get()) {
-          if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_pick_first_trace)) {
-            gpr_log(GPR_INFO,
-                    "Pick First %p promoting pending subchannel list %p to "
-                    "replace %p",
-                    p, p->latest_pending_subchannel_list_.get(),
-                    p->subchannel_list_.get());
-          }
-          p->selected_ = nullptr;  // owned by p->subchannel_list_
-          p->subchannel_list_ = std::move(p->latest_pending_subchannel_list_);
-        }
-        // If this is the current subchannel list (either because we were
-        // in case 1 or because we were in case 2 and just promoted it to
-        // be the current list), re-resolve and report new state.
-        if (subchannel_list() == p->subchannel_list_.get()) {
-          p->channel_control_helper()->RequestReresolution();
-          absl::Status status = absl::UnavailableError(
-              absl::StrCat("failed to connect to all addresses; last error: ",
-                           connectivity_status().ToString()));
-          p->channel_control_helper()->UpdateState(
-              GRPC_CHANNEL_TRANSIENT_FAILURE, status,
-              absl::make_unique<TransientFailurePicker>(status));
-        }
-      }
-      // If the next subchannel is in IDLE, trigger a connection attempt.
-      // If it's in READY, we can't get here, because we would already
-      // have selected the subchannel above.
-      // If it's already in CONNECTING, we don't need to do this.
-      // If it's in TRANSIENT_FAILURE, then we will trigger the
-      // connection attempt later when it reports IDLE.
-      auto sd_state = sd->connectivity_state();
-      if (sd_state.has_value() && *sd_state == GRPC_CHANNEL_IDLE) {
-        sd->subchannel()->RequestConnection();
+      ProcessTransientFailureLocked();
+      // If the most recent connection attempt failed, there is no point in
+      // waiting for the connection attempt delay before starting the next.
+      if (!subchannel_list()->in_transient_failure() &&
+          Index() == subchannel_list()->attempting_index() &&
+          Index() + 1 < subchannel_list()->num_subchannels()) {
+        subchannel_list()->StartConnectionAttemptLocked(Index() + 1);
       }
       break;
     }
     case GRPC_CHANNEL_IDLE: {
-      subchannel()->RequestConnection();
+      // Subchannels coming out of backoff reconnect right away once we've
+      // tried them all.  Before that, only reconnect subchannels that we've
+      // already started an attempt on and that went IDLE without failing.
+      if (subchannel_list()->in_transient_failure() ||
+          (Index() <= subchannel_list()->attempting_index() &&
+           !seen_transient_failure())) {
+        subchannel()->RequestConnection();
+      }
       break;
     }
     case GRPC_CHANNEL_CONNECTING: {
-      // Only update connectivity state in case 1, and only if we're not
-      // already in TRANSIENT_FAILURE.
+      // Only update connectivity state in case 1, only for the most recent
+      // connection attempt, and only if we're not already in
+      // TRANSIENT_FAILURE.
       if (subchannel_list() == p->subchannel_list_.get() &&
+          Index() == subchannel_list()->attempting_index() &&
           !subchannel_list()->in_transient_failure()) {
         p->channel_control_helper()->UpdateState(
             GRPC_CHANNEL_CONNECTING, absl::Status(),
@@ -472,6 +529,58 @@ void PickFirst::PickFirstSubchannelData::ProcessConnectivityChangeLocked(
   }
 }
 
+void PickFirst::PickFirstSubchannelData::ProcessTransientFailureLocked() {
+  PickFirst* p = static_cast<PickFirst*>(subchannel_list()->policy());
+  seen_transient_failure_ = true;
+  // Keep waiting while any other subchannel may still connect.
+  if (!subchannel_list()->AllSubchannelsSeenTransientFailure()) return;
+  if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_pick_first_trace)) {
+    gpr_log(GPR_INFO,
+            "Pick First %p subchannel list %p failed to connect to "
+            "all subchannels",
+            p, subchannel_list());
+  }
+  subchannel_list()->set_in_transient_failure(true);
+  for (size_t i = 0; i < subchannel_list()->num_subchannels(); ++i) {
+    subchannel_list()->subchannel(i)->reset_seen_transient_failure();
+  }
+  // In case 2, swap to the new subchannel list.  This means reporting
+  // TRANSIENT_FAILURE and dropping the existing (working) connection,
+  // but we can't ignore what the control plane has told us.
+  if (subchannel_list() == p->latest_pending_subchannel_list_.get()) {
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_pick_first_trace)) {
+      gpr_log(GPR_INFO,
+              "Pick First %p promoting pending subchannel list %p to "
+              "replace %p",
+              p, p->latest_pending_subchannel_list_.get(),
+              p->subchannel_list_.get());
+    }
+    p->selected_ = nullptr;  // owned by p->subchannel_list_
+    p->subchannel_list_ = std::move(p->latest_pending_subchannel_list_);
+  }
+  // If this is the current subchannel list (either because we were
+  // in case 1 or because we were in case 2 and just promoted it to
+  // be the current list), re-resolve and report new state.
+  if (subchannel_list() == p->subchannel_list_.get()) {
+    p->channel_control_helper()->RequestReresolution();
+    absl::Status status = absl::UnavailableError(
+        absl::StrCat("failed to connect to all addresses; last error: ",
+                     connectivity_status().ToString()));
+    p->channel_control_helper()->UpdateState(
+        GRPC_CHANNEL_TRANSIENT_FAILURE, status,
+        absl::make_unique<TransientFailurePicker>(status));
+  }
+  // Subchannels whose backoff expired while we were waiting for the others
+  // to fail have already reported IDLE, so reconnect them now.
+  for (size_t i = 0; i < subchannel_list()->num_subchannels(); ++i) {
+    PickFirstSubchannelData* sd = subchannel_list()->subchannel(i);
+    auto sd_state = sd->connectivity_state();
+    if (sd_state.has_value() && *sd_state == GRPC_CHANNEL_IDLE) {
+      sd->subchannel()->RequestConnection();
+    }
+  }
+}
+
 void PickFirst::PickFirstSubchannelData::ProcessUnselectedReadyLocked() {
   PickFirst* p = static_cast<PickFirst*>(subchannel_list()->policy());
   // If we get here, there are two possible cases:
@@ -504,6 +613,8 @@ void PickFirst::PickFirstSubchannelData::ProcessUnselectedReadyLocked() {
   p->channel_control_helper()->UpdateState(
       GRPC_CHANNEL_READY, absl::Status(),
       absl::make_unique<Picker>(subchannel()->Ref()));
+  // Cancel the connection attempts that lost the race.
+  subchannel_list()->MaybeCancelConnectionAttemptTimerLocked();
   for (size_t i = 0; i < subchannel_list()->num_subchannels(); ++i) {
     if (i != Index()) {
       subchannel_list()->subchannel(i)->ShutdownLocked();
@@ -511,6 +622,86 @@ void PickFirst::PickFirstSubchannelData::ProcessUnselectedReadyLocked() {
   }
 }
 
+//
+// PickFirst::PickFirstSubchannelList
+//
+
+void PickFirst::PickFirstSubchannelList::StartConnectionAttemptLocked(
+    size_t index) {
+  MaybeCancelConnectionAttemptTimerLocked();
+  for (; index < num_subchannels(); ++index) {
+    attempting_index_ = index;
+    PickFirstSubchannelData* sd = subchannel(index);
+    grpc_connectivity_state state = *sd->connectivity_state();
+    if (state == GRPC_CHANNEL_IDLE) {
+      sd->subchannel()->RequestConnection();
+      break;
+    }
+    // A subchannel shared with another channel may already be connecting.
+    if (state == GRPC_CHANNEL_CONNECTING) break;
+    // Otherwise, the subchannel is still in backoff after a previous
+    // failure, so move on to the next one immediately.
+    GPR_ASSERT(state == GRPC_CHANNEL_TRANSIENT_FAILURE);
+    sd->ProcessTransientFailureLocked();
+    if (in_transient_failure_) return;
+  }
+  if (index + 1 >= num_subchannels()) return;
+  if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_pick_first_trace)) {
+    gpr_log(GPR_INFO,
+            "Pick First %p subchannel list %p: attempting subchannel %" PRIuPTR
+            ", next attempt in %" PRId64 "ms",
+            policy(), this, index, connection_attempt_delay_.millis());
+  }
+  WeakRef(DEBUG_LOCATION, "ConnectionAttemptTimer").release();
+  connection_attempt_timer_ = new ConnectionAttemptTimer();
+  connection_attempt_timer_->subchannel_list = this;
+  GRPC_CLOSURE_INIT(&connection_attempt_timer_->closure,
+                    OnConnectionAttemptTimer, connection_attempt_timer_,
+                    nullptr);
+  grpc_timer_init(&connection_attempt_timer_->timer,
+                  Timestamp::Now() + connection_attempt_delay_,
+                  &connection_attempt_timer_->closure);
+}
+
+void PickFirst::PickFirstSubchannelList::
+    MaybeCancelConnectionAttemptTimerLocked() {
+  if (connection_attempt_timer_ != nullptr) {
+    // Lame timer callback.  The callback still runs against its own
+    // ConnectionAttemptTimer, which it frees, so the timer may be re-armed
+    // right away.
+    ConnectionAttemptTimer* timer =
+        std::exchange(connection_attempt_timer_, nullptr);
+    grpc_timer_cancel(&timer->timer);
+  }
+}
+
+void PickFirst::PickFirstSubchannelList::OnConnectionAttemptTimer(
+    void* arg, grpc_error_handle error) {
+  auto* timer = static_cast<ConnectionAttemptTimer*>(arg);
+  (void)GRPC_ERROR_REF(error);  // ref owned by lambda
+  static_cast<PickFirst*>(timer->subchannel_list->policy())
+      ->work_serializer()
+      ->Run(
+          [timer, error]() {
+            timer->subchannel_list->OnConnectionAttemptTimerLocked(timer,
+                                                                   error);
+          },
+          DEBUG_LOCATION);
+}
+
+void PickFirst::PickFirstSubchannelList::OnConnectionAttemptTimerLocked(
+    ConnectionAttemptTimer* timer, grpc_error_handle error) {
+  if (GRPC_ERROR_IS_NONE(error) && connection_attempt_timer_ == timer) {
+    connection_attempt_timer_ = nullptr;
+    if (!shutting_down() && !in_transient_failure_) {
+      StartConnectionAttemptLocked(attempting_index_ + 1);
+    }
+  }
+  delete timer;
+  WeakUnref(DEBUG_LOCATION, "ConnectionAttemptTimer");
+  GRPC_ERROR_UNREF(error);
+}
+
 class PickFirstConfig : public LoadBalancingPolicy::Config {
  public:
   absl::string_view name() const override { return kPickFirst; }
@@ -110,51 +110,135 @@ void RingHashConfig::JsonPostLoad(const Json&, const JsonArgs&,
   }
 }
 
-namespace {
+//
+// RingHashRing
+//
 
-constexpr absl::string_view kRingHash = "ring_hash_experimental";
+RingHashRing::RingHashRing(const std::vector<HashedEndpoint>& endpoints,
+                           size_t min_ring_size, size_t max_ring_size) {
+  if (endpoints.empty()) return;
+  size_t sum = 0;
+  for (const auto& endpoint : endpoints) sum += endpoint.weight;
+  // Calculating normalized weights and find min and max.
+  std::vector<double> normalized_weights;
+  normalized_weights.reserve(endpoints.size());
+  double min_normalized_weight = 1.0;
+  double max_normalized_weight = 0.0;
+  for (const auto& endpoint : endpoints) {
+    const double normalized_weight =
+        static_cast<double>(endpoint.weight) / sum;
+    normalized_weights.push_back(normalized_weight);
+    min_normalized_weight = std::min(normalized_weight, min_normalized_weight);
+    max_normalized_weight = std::max(normalized_weight, max_normalized_weight);
+  }
+  // Scale up the number of hashes per host such that the least-weighted host
+  // gets a whole number of hashes on the ring. Other hosts might not end up
+  // with whole numbers, and that's fine (the ring-building algorithm below can
+  // handle this). This preserves the original implementation's behavior: when
+  // weights aren't provided, all hosts should get an equal number of hashes. In
+  // the case where this number exceeds the max_ring_size, it's scaled back down
+  // to fit.
+  const double scale = std::min(
+      std::ceil(min_normalized_weight * min_ring_size) / min_normalized_weight,
+      static_cast<double>(max_ring_size));
+  // Reserve memory for the entire ring up front.
+  const size_t ring_size = std::ceil(scale);
+  entries_.reserve(ring_size);
+  // Populate the hash ring by walking through the (host, weight) pairs in
+  // normalized_host_weights, and generating (scale * weight) hashes for each
+  // host. Since these aren't necessarily whole numbers, we maintain running
+  // sums -- current_hashes and target_hashes -- which allows us to populate the
+  // ring in a mostly stable way.
+  absl::InlinedVector<char, 196> hash_key_buffer;
+  double current_hashes = 0.0;
+  double target_hashes = 0.0;
+  for (size_t i = 0; i < endpoints.size(); ++i) {
+    const std::string& address_string = endpoints[i].address;
+    hash_key_buffer.assign(address_string.begin(), address_string.end());
+    hash_key_buffer.emplace_back('_');
+    auto offset_start = hash_key_buffer.end();
+    target_hashes += scale * normalized_weights[i];
+    size_t count = 0;
+    while (current_hashes < target_hashes) {
+      const std::string count_str = absl::StrCat(count);
+      hash_key_buffer.insert(offset_start, count_str.begin(), count_str.end());
+      absl::string_view hash_key(hash_key_buffer.data(),
+                                 hash_key_buffer.size());
+      const uint64_t hash = XXH64(hash_key.data(), hash_key.size(), 0);
+      entries_.push_back({hash, i});
+      ++count;
+      ++current_hashes;
+      hash_key_buffer.erase(offset_start, hash_key_buffer.end());
+    }
+  }
+  std::sort(entries_.begin(), entries_.end(),
+            [](const Entry& lhs, const Entry& rhs) -> bool {
+              return lhs.hash < rhs.hash;
+            });
+}
 
-class RingHashLbConfig : public LoadBalancingPolicy::Config {
- public:
-  RingHashLbConfig(size_t min_ring_size, size_t max_ring_size)
-      : min_ring_size_(min_ring_size), max_ring_size_(max_ring_size) {}
-  absl::string_view name() const override { return kRingHash; }
-  size_t min_ring_size() const { return min_ring_size_; }
-  size_t max_ring_size() const { return max_ring_size_; }
+size_t RingHashRing::FindIndex(uint64_t h) const {
+  // Ported from https://github.com/RJ/ketama/blob/master/libketama/ketama.c
+  // (ketama_get_server) NOTE: The algorithm depends on using signed integers
+  // for lowp, highp, and first_index. Do not change them!
+  size_t lowp = 0;
+  size_t highp = entries_.size();
+  size_t first_index = 0;
+  while (true) {
+    first_index = (lowp + highp) / 2;
+    if (first_index == entries_.size()) {
+      first_index = 0;
+      break;
+    }
+    uint64_t midval = entries_[first_index].hash;
+    uint64_t midval1 = first_index == 0 ? 0 : entries_[first_index - 1].hash;
+    if (h <= midval && h > midval1) {
+      break;
+    }
+    if (midval < h) {
+      lowp = first_index + 1;
+    } else {
+      highp = first_index - 1;
+    }
+    if (lowp > highp) {
+      first_index = 0;
+      break;
+    }
+  }
+  return first_index;
+}
 
- private:
-  size_t min_ring_size_;
-  size_t max_ring_size_;
-};
+namespace {
 
 //
-// ring_hash LB policy
+// hash table LB policy
 //
 
-class RingHash : public LoadBalancingPolicy {
+class HashTableLb : public LoadBalancingPolicy {
  public:
-  explicit RingHash(Args args);
+  HashTableLb(Args args, const HashTableLbPolicyInfo& info);
 
-  absl::string_view name() const override { return kRingHash; }
+  absl::string_view name() const override { return info_.name; }
 
   absl::Status UpdateLocked(UpdateArgs args) override;
   void ResetBackoffLocked() override;
 
  private:
-  ~RingHash() override;
+  ~HashTableLb() override;
 
   // Forward declaration.
-  class RingHashSubchannelList;
+  class HashTableSubchannelList;
 
   // Data for a particular subchannel in a subchannel list.
   // This subclass adds the following functionality:
   // - Tracks the previous connectivity state of the subchannel, so that
   //   we know how many subchannels are in each state.
-  class RingHashSubchannelData
-      : public SubchannelData<RingHashSubchannelList, RingHashSubchannelData> {
+  class HashTableSubchannelData
+      : public SubchannelData<HashTableSubchannelList,
+                              HashTableSubchannelData> {
    public:
-    RingHashSubchannelData(
-        SubchannelList<RingHashSubchannelList, RingHashSubchannelData>*
+    HashTableSubchannelData(
+        SubchannelList<HashTableSubchannelList, HashTableSubchannelData>*
             subchannel_list,
         const ServerAddress& address,
         RefCountedPtr<SubchannelInterface> subchannel)
@@ -193,40 +277,35 @@ class RingHash : public LoadBalancingPolicy {
     absl::Status connectivity_status_ ABSL_GUARDED_BY(&mu_);
   };
 
-  // A list of subchannels and the ring containing those subchannels.
-  class RingHashSubchannelList
-      : public SubchannelList<RingHashSubchannelList, RingHashSubchannelData> {
+  // A list of subchannels and the table built from them.
+  class HashTableSubchannelList
+      : public SubchannelList<HashTableSubchannelList,
+                              HashTableSubchannelData> {
    public:
-    struct RingEntry {
-      uint64_t hash;
-      RingHashSubchannelData* subchannel;
-    };
-
-    RingHashSubchannelList(RingHash* policy, ServerAddressList addresses,
-                           const ChannelArgs& args);
+    HashTableSubchannelList(HashTableLb* policy, ServerAddressList addresses,
+                            const ChannelArgs& args);
 
-    ~RingHashSubchannelList() override {
-      RingHash* p = static_cast<RingHash*>(policy());
+    ~HashTableSubchannelList() override {
+      HashTableLb* p = static_cast<HashTableLb*>(policy());
       p->Unref(DEBUG_LOCATION, "subchannel_list");
     }
 
-    const std::vector<RingEntry>& ring() const { return ring_; }
+    const HashedEndpointTable& table() const { return *table_; }
 
     // Updates the counters of subchannels in each state when a
     // subchannel transitions from old_state to new_state.
     void UpdateStateCountersLocked(grpc_connectivity_state old_state,
                                    grpc_connectivity_state new_state);
 
-    // Updates the RH policy's connectivity state based on the
-    // subchannel list's state counters, creating new picker and new ring.
+    // Updates the policy's connectivity state based on the
+    // subchannel list's state counters, creating a new picker.
     // The index parameter indicates the index into the list of the subchannel
     // whose status report triggered the call to
-    // UpdateRingHashConnectivityStateLocked().
+    // UpdateHashTableConnectivityStateLocked().
     // connection_attempt_complete is true if the subchannel just
     // finished a connection attempt.
-    void UpdateRingHashConnectivityStateLocked(size_t index,
-                                               bool connection_attempt_complete,
-                                               absl::Status status);
+    void UpdateHashTableConnectivityStateLocked(
+        size_t index, bool connection_attempt_complete, absl::Status status);
 
    private:
     bool AllSubchannelsSeenInitialState() {
@@ -241,7 +320,7 @@ class RingHash : public LoadBalancingPolicy {
     size_t num_connecting_ = 0;
     size_t num_transient_failure_ = 0;
 
-    std::vector<RingEntry> ring_;
+    std::unique_ptr<HashedEndpointTable> table_;
 
     // The index of the subchannel currently doing an internally
     // triggered connection attempt, if any.
@@ -256,7 +335,7 @@ class RingHash : public LoadBalancingPolicy {
 
   class Picker : public SubchannelPicker {
    public:
-    explicit Picker(RefCountedPtr<RingHashSubchannelList> subchannel_list)
+    explicit Picker(RefCountedPtr<HashTableSubchannelList> subchannel_list)
         : subchannel_list_(std::move(subchannel_list)) {}
 
     ~Picker() override {
@@ -272,14 +351,14 @@ class RingHash : public LoadBalancingPolicy {
     class WorkSerializerRunner : public Orphanable {
      public:
       explicit WorkSerializerRunner(
-          RefCountedPtr<RingHashSubchannelList> subchannel_list)
+          RefCountedPtr<HashTableSubchannelList> subchannel_list)
           : subchannel_list_(std::move(subchannel_list)) {
         GRPC_CLOSURE_INIT(&closure_, RunInExecCtx, this, nullptr);
       }
 
       void Orphan() override {
-        // Hop into ExecCtx, so that we're not holding the data plane mutex
-        // while we run control-plane code.
+        // Hop into ExecCtx, so that we don't run control-plane code from
+        // within a pick on the data plane.
         ExecCtx::Run(DEBUG_LOCATION, &closure_, GRPC_ERROR_NONE);
       }
 
@@ -287,14 +366,14 @@ class RingHash : public LoadBalancingPolicy {
       virtual void Run() {}
 
      protected:
-      RingHash* ring_hash_lb() const {
-        return static_cast<RingHash*>(subchannel_list_->policy());
+      HashTableLb* hash_table_lb() const {
+        return static_cast<HashTableLb*>(subchannel_list_->policy());
       }
 
      private:
       static void RunInExecCtx(void* arg, grpc_error_handle /*error*/) {
         auto* self = static_cast<SubchannelConnectionAttempter*>(arg);
-        self->ring_hash_lb()->work_serializer()->Run(
+        self->hash_table_lb()->work_serializer()->Run(
             [self]() {
               self->Run();
               delete self;
@@ -302,7 +381,7 @@ class RingHash : public LoadBalancingPolicy {
             DEBUG_LOCATION);
       }
 
-      RefCountedPtr<RingHashSubchannelList> subchannel_list_;
+      RefCountedPtr<HashTableSubchannelList> subchannel_list_;
       grpc_closure closure_;
     };
 
@@ -311,7 +390,7 @@ class RingHash : public LoadBalancingPolicy {
     class SubchannelConnectionAttempter : public WorkSerializerRunner {
      public:
       explicit SubchannelConnectionAttempter(
-          RefCountedPtr<RingHashSubchannelList> subchannel_list)
+          RefCountedPtr<HashTableSubchannelList> subchannel_list)
           : WorkSerializerRunner(std::move(subchannel_list)) {}
 
       void AddSubchannel(RefCountedPtr<SubchannelInterface> subchannel) {
@@ -319,7 +398,7 @@ class RingHash : public LoadBalancingPolicy {
       }
 
       void Run() override {
-        if (!ring_hash_lb()->shutdown_) {
+        if (!hash_table_lb()->shutdown_) {
           for (auto& subchannel : subchannels_) {
             subchannel->RequestConnection();
           }
@@ -330,62 +409,42 @@ class RingHash : public LoadBalancingPolicy {
       std::vector<RefCountedPtr<SubchannelInterface>> subchannels_;
     };
 
-    RefCountedPtr<RingHashSubchannelList> subchannel_list_;
+    RefCountedPtr<HashTableSubchannelList> subchannel_list_;
   };
 
   void ShutdownLocked() override;
 
+  const HashTableLbPolicyInfo info_;
+
   // Current config from resolver.
-  RefCountedPtr<RingHashLbConfig> config_;
+  RefCountedPtr<HashTableLbConfig> config_;
 
   // list of subchannels.
-  RefCountedPtr<RingHashSubchannelList> subchannel_list_;
-  RefCountedPtr<RingHashSubchannelList> latest_pending_subchannel_list_;
+  RefCountedPtr<HashTableSubchannelList> subchannel_list_;
+  RefCountedPtr<HashTableSubchannelList> latest_pending_subchannel_list_;
   // indicating if we are shutting down.
   bool shutdown_ = false;
 };
 
 //
-// RingHash::Picker
+// HashTableLb::Picker
 //
 
-RingHash::PickResult RingHash::Picker::Pick(PickArgs args) {
+HashTableLb::PickResult HashTableLb::Picker::Pick(PickArgs args) {
   auto* call_state = static_cast<ClientChannel::LoadBalancedCall::LbCallState*>(
       args.call_state);
   auto hash = call_state->GetCallAttribute(RequestHashAttributeName());
+  const HashTableLbPolicyInfo& info =
+      static_cast<HashTableLb*>(subchannel_list_->policy())->info_;
   uint64_t h;
   if (!absl::SimpleAtoi(hash, &h)) {
-    return PickResult::Fail(
-        absl::InternalError("ring hash value is not a number"));
-  }
-  const auto& ring = subchannel_list_->ring();
-  // Ported from https://github.com/RJ/ketama/blob/master/libketama/ketama.c
-  // (ketama_get_server) NOTE: The algorithm depends on using signed integers
-  // for lowp, highp, and first_index. Do not change them!
-  size_t lowp = 0;
-  size_t highp = ring.size();
-  size_t first_index = 0;
-  while (true) {
-    first_index = (lowp + highp) / 2;
-    if (first_index == ring.size()) {
-      first_index = 0;
-      break;
-    }
-    uint64_t midval = ring[first_index].hash;
-    uint64_t midval1 = first_index == 0 ? 0 : ring[first_index - 1].hash;
-    if (h <= midval && h > midval1) {
-      break;
-    }
-    if (midval < h) {
-      lowp = first_index + 1;
-    } else {
-      highp = first_index - 1;
-    }
-    if (lowp > highp) {
-      first_index = 0;
-      break;
-    }
+    return PickResult::Fail(absl::InternalError(
+        absl::StrCat(info.description, " value is not a number")));
   }
+  const HashedEndpointTable& table = subchannel_list_->table();
+  const size_t first_index = table.FindIndex(h);
+  HashTableSubchannelData* first_subchannel =
+      subchannel_list_->subchannel(table.EndpointIndex(first_index));
   OrphanablePtr<SubchannelConnectionAttempter> subchannel_connection_attempter;
   auto ScheduleSubchannelConnectionAttempt =
       [&](RefCountedPtr<SubchannelInterface> subchannel) {
@@ -397,41 +456,38 @@ RingHash::PickResult RingHash::Picker::Pick(PickArgs args) {
         }
         subchannel_connection_attempter->AddSubchannel(std::move(subchannel));
       };
-  switch (ring[first_index].subchannel->GetConnectivityState()) {
+  switch (first_subchannel->GetConnectivityState()) {
     case GRPC_CHANNEL_READY:
-      return PickResult::Complete(
-          ring[first_index].subchannel->subchannel()->Ref());
+      return PickResult::Complete(first_subchannel->subchannel()->Ref());
     case GRPC_CHANNEL_IDLE:
       ScheduleSubchannelConnectionAttempt(
-          ring[first_index].subchannel->subchannel()->Ref());
+          first_subchannel->subchannel()->Ref());
       ABSL_FALLTHROUGH_INTENDED;
     case GRPC_CHANNEL_CONNECTING:
       return PickResult::Queue();
     default:  // GRPC_CHANNEL_TRANSIENT_FAILURE
       break;
   }
-  ScheduleSubchannelConnectionAttempt(
-      ring[first_index].subchannel->subchannel()->Ref());
+  ScheduleSubchannelConnectionAttempt(first_subchannel->subchannel()->Ref());
   // Loop through remaining subchannels to find one in READY.
   // On the way, we make sure the right set of connection attempts
   // will happen.
   bool found_second_subchannel = false;
   bool found_first_non_failed = false;
-  for (size_t i = 1; i < ring.size(); ++i) {
-    const auto& entry = ring[(first_index + i) % ring.size()];
-    if (entry.subchannel == ring[first_index].subchannel) {
+  for (size_t i = 1; i < table.size(); ++i) {
+    HashTableSubchannelData* sd = subchannel_list_->subchannel(
+        table.EndpointIndex((first_index + i) % table.size()));
+    if (sd == first_subchannel) {
       continue;
     }
-    grpc_connectivity_state connectivity_state =
-        entry.subchannel->GetConnectivityState();
+    grpc_connectivity_state connectivity_state = sd->GetConnectivityState();
     if (connectivity_state == GRPC_CHANNEL_READY) {
-      return PickResult::Complete(entry.subchannel->subchannel()->Ref());
+      return PickResult::Complete(sd->subchannel()->Ref());
     }
     if (!found_second_subchannel) {
       switch (connectivity_state) {
         case GRPC_CHANNEL_IDLE:
-          ScheduleSubchannelConnectionAttempt(
-              entry.subchannel->subchannel()->Ref());
+          ScheduleSubchannelConnectionAttempt(sd->subchannel()->Ref());
           ABSL_FALLTHROUGH_INTENDED;
         case GRPC_CHANNEL_CONNECTING:
           return PickResult::Queue();
@@ -442,31 +498,30 @@ RingHash::PickResult RingHash::Picker::Pick(PickArgs args) {
     }
     if (!found_first_non_failed) {
       if (connectivity_state == GRPC_CHANNEL_TRANSIENT_FAILURE) {
-        ScheduleSubchannelConnectionAttempt(
-            entry.subchannel->subchannel()->Ref());
+        ScheduleSubchannelConnectionAttempt(sd->subchannel()->Ref());
       } else {
         if (connectivity_state == GRPC_CHANNEL_IDLE) {
-          ScheduleSubchannelConnectionAttempt(
-              entry.subchannel->subchannel()->Ref());
+          ScheduleSubchannelConnectionAttempt(sd->subchannel()->Ref());
         }
         found_first_non_failed = true;
       }
     }
   }
   return PickResult::Fail(absl::UnavailableError(absl::StrCat(
-      "ring hash cannot find a connected subchannel; first failure: ",
-      ring[first_index].subchannel->GetConnectivityStatus().ToString())));
+      info.description,
+      " cannot find a connected subchannel; first failure: ",
+      first_subchannel->GetConnectivityStatus().ToString())));
 }
 
 //
-// RingHash::RingHashSubchannelList
+// HashTableLb::HashTableSubchannelList
 //
 
-RingHash::RingHashSubchannelList::RingHashSubchannelList(
-    RingHash* policy, ServerAddressList addresses, const ChannelArgs& args)
+HashTableLb::HashTableSubchannelList::HashTableSubchannelList(
+    HashTableLb* policy, ServerAddressList addresses, const ChannelArgs& args)
     : SubchannelList(policy,
-                     (GRPC_TRACE_FLAG_ENABLED(grpc_lb_ring_hash_trace)
-                          ? "RingHashSubchannelList"
+                     (GRPC_TRACE_FLAG_ENABLED(*policy->info_.trace)
+                          ? "HashTableSubchannelList"
                           : nullptr),
                      std::move(addresses), policy->channel_control_helper(),
                      args),
@@ -475,105 +530,34 @@ RingHash::RingHashSubchannelList::RingHashSubchannelList(
   // any references to subchannels, since the subchannels'
   // pollset_sets will include the LB policy's pollset_set.
   policy->Ref(DEBUG_LOCATION, "subchannel_list").release();
-  // Construct the ring.
-  // Store the weights while finding the sum.
-  struct AddressWeight {
-    std::string address;
-    // Default weight is 1 for the cases where a weight is not provided,
-    // each occurrence of the address will be counted a weight value of 1.
-    uint32_t weight = 1;
-    double normalized_weight;
-  };
-  std::vector<AddressWeight> address_weights;
-  size_t sum = 0;
-  address_weights.reserve(num_subchannels());
+  // Construct the table.
+  std::vector<HashedEndpoint> endpoints;
+  endpoints.reserve(num_subchannels());
   for (size_t i = 0; i < num_subchannels(); ++i) {
-    RingHashSubchannelData* sd = subchannel(i);
+    HashTableSubchannelData* sd = subchannel(i);
     const ServerAddressWeightAttribute* weight_attribute = static_cast<
         const ServerAddressWeightAttribute*>(sd->address().GetAttribute(
         ServerAddressWeightAttribute::kServerAddressWeightAttributeKey));
-    AddressWeight address_weight;
-    address_weight.address =
+    HashedEndpoint endpoint;
+    endpoint.address =
         grpc_sockaddr_to_string(&sd->address().address(), false).value();
     // Weight should never be zero, but ignore it just in case, since
-    // that value would screw up the ring-building algorithm.
+    // that value would screw up the table-building algorithm.
     if (weight_attribute != nullptr && weight_attribute->weight() > 0) {
-      address_weight.weight = weight_attribute->weight();
+      endpoint.weight = weight_attribute->weight();
     }
-    sum += address_weight.weight;
-    address_weights.push_back(std::move(address_weight));
-  }
-  // Calculating normalized weights and find min and max.
-  double min_normalized_weight = 1.0;
-  double max_normalized_weight = 0.0;
-  for (auto& address : address_weights) {
-    address.normalized_weight = static_cast<double>(address.weight) / sum;
-    min_normalized_weight =
-        std::min(address.normalized_weight, min_normalized_weight);
-    max_normalized_weight =
-        std::max(address.normalized_weight, max_normalized_weight);
+    endpoints.push_back(std::move(endpoint));
   }
-  // Scale up the number of hashes per host such that the least-weighted host
-  // gets a whole number of hashes on the ring. Other hosts might not end up
-  // with whole numbers, and that's fine (the ring-building algorithm below can
-  // handle this). This preserves the original implementation's behavior: when
-  // weights aren't provided, all hosts should get an equal number of hashes. In
-  // the case where this number exceeds the max_ring_size, it's scaled back down
-  // to fit.
-  const size_t min_ring_size = policy->config_->min_ring_size();
-  const size_t max_ring_size = policy->config_->max_ring_size();
-  const double scale = std::min(
-      std::ceil(min_normalized_weight * min_ring_size) / min_normalized_weight,
-      static_cast<double>(max_ring_size));
-  // Reserve memory for the entire ring up front.
-  const size_t ring_size = std::ceil(scale);
-  ring_.reserve(ring_size);
-  // Populate the hash ring by walking through the (host, weight) pairs in
-  // normalized_host_weights, and generating (scale * weight) hashes for each
-  // host. Since these aren't necessarily whole numbers, we maintain running
-  // sums -- current_hashes and target_hashes -- which allows us to populate the
-  // ring in a mostly stable way.
-  absl::InlinedVector<char, 196> hash_key_buffer;
-  double current_hashes = 0.0;
-  double target_hashes = 0.0;
-  uint64_t min_hashes_per_host = ring_size;
-  uint64_t max_hashes_per_host = 0;
-  for (size_t i = 0; i < num_subchannels(); ++i) {
-    const std::string& address_string = address_weights[i].address;
-    hash_key_buffer.assign(address_string.begin(), address_string.end());
-    hash_key_buffer.emplace_back('_');
-    auto offset_start = hash_key_buffer.end();
-    target_hashes += scale * address_weights[i].normalized_weight;
-    size_t count = 0;
-    while (current_hashes < target_hashes) {
-      const std::string count_str = absl::StrCat(count);
-      hash_key_buffer.insert(offset_start, count_str.begin(), count_str.end());
-      absl::string_view hash_key(hash_key_buffer.data(),
-                                 hash_key_buffer.size());
-      const uint64_t hash = XXH64(hash_key.data(), hash_key.size(), 0);
-      ring_.push_back({hash, subchannel(i)});
-      ++count;
-      ++current_hashes;
-      hash_key_buffer.erase(offset_start, hash_key_buffer.end());
-    }
-    min_hashes_per_host =
-        std::min(static_cast<uint64_t>(i), min_hashes_per_host);
-    max_hashes_per_host =
-        std::max(static_cast<uint64_t>(i), max_hashes_per_host);
-  }
-  std::sort(ring_.begin(), ring_.end(),
-            [](const RingHashSubchannelList::RingEntry& lhs,
-               const RingHashSubchannelList::RingEntry& rhs) -> bool {
-              return lhs.hash < rhs.hash;
-            });
-  if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_ring_hash_trace)) {
+  table_ = policy->config_->MakeTable(endpoints);
+  if (GRPC_TRACE_FLAG_ENABLED(*policy->info_.trace)) {
     gpr_log(GPR_INFO,
-            "[RH %p] created subchannel list %p with %" PRIuPTR " ring entries",
-            policy, this, ring_.size());
+            "[%s %p] created subchannel list %p with %" PRIuPTR
+            " table entries",
+            policy->info_.log_tag, policy, this, table_->size());
   }
 }
 
-void RingHash::RingHashSubchannelList::UpdateStateCountersLocked(
+void HashTableLb::HashTableSubchannelList::UpdateStateCountersLocked(
     grpc_connectivity_state old_state, grpc_connectivity_state new_state) {
   if (old_state == GRPC_CHANNEL_IDLE) {
     GPR_ASSERT(num_idle_ > 0);
@@ -600,17 +584,19 @@ void RingHash::RingHashSubchannelList::UpdateStateCountersLocked(
   }
 }
 
-void RingHash::RingHashSubchannelList::UpdateRingHashConnectivityStateLocked(
-    size_t index, bool connection_attempt_complete, absl::Status status) {
-  RingHash* p = static_cast<RingHash*>(policy());
+void HashTableLb::HashTableSubchannelList::
+    UpdateHashTableConnectivityStateLocked(size_t index,
+                                           bool connection_attempt_complete,
+                                           absl::Status status) {
+  HashTableLb* p = static_cast<HashTableLb*>(policy());
   // If this is latest_pending_subchannel_list_, then swap it into
   // subchannel_list_ as soon as we get the initial connectivity state
   // report for every subchannel in the list.
   if (p->latest_pending_subchannel_list_.get() == this &&
       AllSubchannelsSeenInitialState()) {
-    if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_ring_hash_trace)) {
-      gpr_log(GPR_INFO, "[RH %p] replacing subchannel list %p with %p", p,
-              p->subchannel_list_.get(), this);
+    if (GRPC_TRACE_FLAG_ENABLED(*p->info_.trace)) {
+      gpr_log(GPR_INFO, "[%s %p] replacing subchannel list %p with %p",
+              p->info_.log_tag, p, p->subchannel_list_.get(), this);
     }
     p->subchannel_list_ = std::move(p->latest_pending_subchannel_list_);
   }
@@ -661,17 +647,17 @@ void RingHash::RingHashSubchannelList::UpdateRingHashConnectivityStateLocked(
   // Note that we use our own picker regardless of connectivity state.
   p->channel_control_helper()->UpdateState(
       state, status,
-      absl::make_unique<Picker>(Ref(DEBUG_LOCATION, "RingHashPicker")));
-  // While the ring_hash policy is reporting TRANSIENT_FAILURE, it will
+      absl::make_unique<Picker>(Ref(DEBUG_LOCATION, "HashTablePicker")));
+  // While the policy is reporting TRANSIENT_FAILURE, it will
   // not be getting any pick requests from the priority policy.
-  // However, because the ring_hash policy does not attempt to
+  // However, because the policy does not attempt to
   // reconnect to subchannels unless it is getting pick requests,
   // it will need special handling to ensure that it will eventually
   // recover from TRANSIENT_FAILURE state once the problem is resolved.
   // Specifically, it will make sure that it is attempting to connect to
   // at least one subchannel at any given time.  After a given subchannel
   // fails a connection attempt, it will move on to the next subchannel
-  // in the ring.  It will keep doing this until one of the subchannels
+  // in the list.  It will keep doing this until one of the subchannels
   // successfully connects, at which point it will report READY and stop
   // proactively trying to connect.  The policy will remain in
   // TRANSIENT_FAILURE until at least one subchannel becomes connected,
@@ -688,12 +674,12 @@ void RingHash::RingHashSubchannelList::UpdateRingHashConnectivityStateLocked(
   if (start_connection_attempt &&
       !internally_triggered_connection_index_.has_value()) {
     size_t next_index = (index + 1) % num_subchannels();
-    if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_ring_hash_trace)) {
+    if (GRPC_TRACE_FLAG_ENABLED(*p->info_.trace)) {
       gpr_log(GPR_INFO,
-              "[RH %p] triggering internal connection attempt for subchannel "
+              "[%s %p] triggering internal connection attempt for subchannel "
               "%p, subchannel_list %p (index %" PRIuPTR " of %" PRIuPTR ")",
-              p, subchannel(next_index)->subchannel(), this, next_index,
-              num_subchannels());
+              p->info_.log_tag, p, subchannel(next_index)->subchannel(), this,
+              next_index, num_subchannels());
     }
     internally_triggered_connection_index_ = next_index;
     subchannel(next_index)->subchannel()->RequestConnection();
@@ -701,20 +687,20 @@ void RingHash::RingHashSubchannelList::UpdateRingHashConnectivityStateLocked(
 }
 
 //
-// RingHash::RingHashSubchannelData
+// HashTableLb::HashTableSubchannelData
 //
 
-void RingHash::RingHashSubchannelData::ProcessConnectivityChangeLocked(
+void HashTableLb::HashTableSubchannelData::ProcessConnectivityChangeLocked(
     absl::optional<grpc_connectivity_state> old_state,
     grpc_connectivity_state new_state) {
-  RingHash* p = static_cast<RingHash*>(subchannel_list()->policy());
+  HashTableLb* p = static_cast<HashTableLb*>(subchannel_list()->policy());
   grpc_connectivity_state last_connectivity_state = GetConnectivityState();
-  if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_ring_hash_trace)) {
+  if (GRPC_TRACE_FLAG_ENABLED(*p->info_.trace)) {
     gpr_log(
         GPR_INFO,
-        "[RH %p] connectivity changed for subchannel %p, subchannel_list %p "
+        "[%s %p] connectivity changed for subchannel %p, subchannel_list %p "
         "(index %" PRIuPTR " of %" PRIuPTR "): prev_state=%s new_state=%s",
-        p, subchannel(), subchannel_list(), Index(),
+        p->info_.log_tag, p, subchannel(), subchannel_list(), Index(),
         subchannel_list()->num_subchannels(),
         ConnectivityStateName(last_connectivity_state),
         ConnectivityStateName(new_state));
@@ -726,10 +712,11 @@ void RingHash::RingHashSubchannelData::ProcessConnectivityChangeLocked(
   // because that would result in an endless loop of re-resolution.
   if (old_state.has_value() && (new_state == GRPC_CHANNEL_TRANSIENT_FAILURE ||
                                 new_state == GRPC_CHANNEL_IDLE)) {
-    if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_ring_hash_trace)) {
+    if (GRPC_TRACE_FLAG_ENABLED(*p->info_.trace)) {
       gpr_log(GPR_INFO,
-              "[RH %p] Subchannel %p reported %s; requesting re-resolution", p,
-              subchannel(), ConnectivityStateName(new_state));
+              "[%s %p] Subchannel %p reported %s; requesting re-resolution",
+              p->info_.log_tag, p, subchannel(),
+              ConnectivityStateName(new_state));
     }
     p->channel_control_helper()->RequestReresolution();
   }
@@ -760,70 +747,71 @@ void RingHash::RingHashSubchannelData::ProcessConnectivityChangeLocked(
   }
   // Update last seen state, also used by picker.
   connectivity_state_.store(new_state, std::memory_order_relaxed);
-  // Update the RH policy's connectivity state, creating new picker and new
-  // ring.
-  subchannel_list()->UpdateRingHashConnectivityStateLocked(
+  // Update the policy's connectivity state, creating a new picker.
+  subchannel_list()->UpdateHashTableConnectivityStateLocked(
       Index(), connection_attempt_complete, status);
 }
 
 //
-// RingHash
+// HashTableLb
 //
 
-RingHash::RingHash(Args args) : LoadBalancingPolicy(std::move(args)) {
-  if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_ring_hash_trace)) {
-    gpr_log(GPR_INFO, "[RH %p] Created", this);
+HashTableLb::HashTableLb(Args args, const HashTableLbPolicyInfo& info)
+    : LoadBalancingPolicy(std::move(args)), info_(info) {
+  if (GRPC_TRACE_FLAG_ENABLED(*info_.trace)) {
+    gpr_log(GPR_INFO, "[%s %p] Created", info_.log_tag, this);
   }
 }
 
-RingHash::~RingHash() {
-  if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_ring_hash_trace)) {
-    gpr_log(GPR_INFO, "[RH %p] Destroying Ring Hash policy", this);
+HashTableLb::~HashTableLb() {
+  if (GRPC_TRACE_FLAG_ENABLED(*info_.trace)) {
+    gpr_log(GPR_INFO, "[%s %p] Destroying %s policy", info_.log_tag, this,
+            info_.description);
   }
   GPR_ASSERT(subchannel_list_ == nullptr);
   GPR_ASSERT(latest_pending_subchannel_list_ == nullptr);
 }
 
-void RingHash::ShutdownLocked() {
-  if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_ring_hash_trace)) {
-    gpr_log(GPR_INFO, "[RH %p] Shutting down", this);
+void HashTableLb::ShutdownLocked() {
+  if (GRPC_TRACE_FLAG_ENABLED(*info_.trace)) {
+    gpr_log(GPR_INFO, "[%s %p] Shutting down", info_.log_tag, this);
   }
   shutdown_ = true;
   subchannel_list_.reset();
   latest_pending_subchannel_list_.reset();
 }
 
-void RingHash::ResetBackoffLocked() {
+void HashTableLb::ResetBackoffLocked() {
   subchannel_list_->ResetBackoffLocked();
   if (latest_pending_subchannel_list_ != nullptr) {
     latest_pending_subchannel_list_->ResetBackoffLocked();
   }
 }
 
-absl::Status RingHash::UpdateLocked(UpdateArgs args) {
+absl::Status HashTableLb::UpdateLocked(UpdateArgs args) {
   config_ = std::move(args.config);
   ServerAddressList addresses;
   if (args.addresses.ok()) {
-    if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_ring_hash_trace)) {
-      gpr_log(GPR_INFO, "[RH %p] received update with %" PRIuPTR " addresses",
-              this, args.addresses->size());
+    if (GRPC_TRACE_FLAG_ENABLED(*info_.trace)) {
+      gpr_log(GPR_INFO, "[%s %p] received update with %" PRIuPTR " addresses",
+              info_.log_tag, this, args.addresses->size());
     }
     addresses = *std::move(args.addresses);
   } else {
-    if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_ring_hash_trace)) {
-      gpr_log(GPR_INFO, "[RH %p] received update with addresses error: %s",
-              this, args.addresses.status().ToString().c_str());
+    if (GRPC_TRACE_FLAG_ENABLED(*info_.trace)) {
+      gpr_log(GPR_INFO, "[%s %p] received update with addresses error: %s",
+              info_.log_tag, this, args.addresses.status().ToString().c_str());
     }
     // If we already have a subchannel list, then keep using the existing
     // list, but still report back that the update was not accepted.
     if (subchannel_list_ != nullptr) return args.addresses.status();
   }
-  if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_ring_hash_trace) &&
+  if (GRPC_TRACE_FLAG_ENABLED(*info_.trace) &&
       latest_pending_subchannel_list_ != nullptr) {
-    gpr_log(GPR_INFO, "[RH %p] replacing latest pending subchannel list %p",
-            this, latest_pending_subchannel_list_.get());
+    gpr_log(GPR_INFO, "[%s %p] replacing latest pending subchannel list %p",
+            info_.log_tag, this, latest_pending_subchannel_list_.get());
   }
-  latest_pending_subchannel_list_ = MakeRefCounted<RingHashSubchannelList>(
+  latest_pending_subchannel_list_ = MakeRefCounted<HashTableSubchannelList>(
       this, std::move(addresses), args.args);
   latest_pending_subchannel_list_->StartWatchingLocked();
   // If we have no existing list or the new list is empty, immediately
@@ -832,11 +820,11 @@ absl::Status RingHash::UpdateLocked(UpdateArgs args) {
   // initial subchannel states are reported.
   if (subchannel_list_ == nullptr ||
       latest_pending_subchannel_list_->num_subchannels() == 0) {
-    if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_ring_hash_trace) &&
+    if (GRPC_TRACE_FLAG_ENABLED(*info_.trace) &&
         subchannel_list_ != nullptr) {
       gpr_log(GPR_INFO,
-              "[RH %p] empty address list, replacing subchannel list %p", this,
-              subchannel_list_.get());
+              "[%s %p] empty address list, replacing subchannel list %p",
+              info_.log_tag, this, subchannel_list_.get());
     }
     subchannel_list_ = std::move(latest_pending_subchannel_list_);
     // If the new list is empty, report TRANSIENT_FAILURE.
@@ -852,12 +840,40 @@ absl::Status RingHash::UpdateLocked(UpdateArgs args) {
       return status;
     }
     // Otherwise, report IDLE.
-    subchannel_list_->UpdateRingHashConnectivityStateLocked(
+    subchannel_list_->UpdateHashTableConnectivityStateLocked(
         /*index=*/0, /*connection_attempt_complete=*/false, absl::OkStatus());
   }
   return absl::OkStatus();
 }
 
+}  // namespace
+
+OrphanablePtr<LoadBalancingPolicy> MakeHashTableLbPolicy(
+    LoadBalancingPolicy::Args args, const HashTableLbPolicyInfo& info) {
+  return MakeOrphanable<HashTableLb>(std::move(args), info);
+}
+
+namespace {
+
+constexpr absl::string_view kRingHash = "ring_hash_experimental";
+
+class RingHashLbConfig : public HashTableLbConfig {
+ public:
+  RingHashLbConfig(size_t min_ring_size, size_t max_ring_size)
+      : min_ring_size_(min_ring_size), max_ring_size_(max_ring_size) {}
+  absl::string_view name() const override { return kRingHash; }
+
+  std::unique_ptr<HashedEndpointTable> MakeTable(
+      const std::vector<HashedEndpoint>& endpoints) const override {
+    return absl::make_unique<RingHashRing>(endpoints, min_ring_size_,
+                                           max_ring_size_);
+  }
+
+ private:
+  size_t min_ring_size_;
+  size_t max_ring_size_;
+};
+
 //
 // factory
 //
@@ -866,7 +882,9 @@ class RingHashFactory : public LoadBalancingPolicyFactory {
  public:
   OrphanablePtr<LoadBalancingPolicy> CreateLoadBalancingPolicy(
       LoadBalancingPolicy::Args args) const override {
-    return MakeOrphanable<RingHash>(std::move(args));
+    static const HashTableLbPolicyInfo kInfo = {
+        kRingHash, "RH", "ring hash", &grpc_lb_ring_hash_trace};
+    return MakeHashTableLbPolicy(std::move(args), kInfo);
   }
 
   absl::string_view name() const override { return kRingHash; }
@@ -19,18 +19,80 @@
 
 #include <grpc/support/port_platform.h>
 
+#include <stddef.h>
 #include <stdint.h>
 
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "absl/strings/string_view.h"
+
+#include "src/core/lib/debug/trace.h"
+#include "src/core/lib/gprpp/orphanable.h"
 #include "src/core/lib/gprpp/unique_type_name.h"
 #include "src/core/lib/gprpp/validation_errors.h"
 #include "src/core/lib/json/json.h"
 #include "src/core/lib/json/json_args.h"
 #include "src/core/lib/json/json_object_loader.h"
+#include "src/core/lib/load_balancing/lb_policy.h"
 
 namespace grpc_core {
 
 UniqueTypeName RequestHashAttributeName();
 
+// An endpoint to be placed on a hash ring or in a Maglev lookup table.
+struct HashedEndpoint {
+  // The string that is hashed to place the endpoint, normally its address.
+  std::string address;
+  // Must be non-zero.
+  uint32_t weight = 1;
+};
+
+// Maps request hashes onto the endpoints of a hash-based policy.  A table
+// has a number of positions, each owned by one endpoint; when the endpoint
+// owning a hash is unusable, the policy falls back to the endpoints of the
+// following positions.
+class HashedEndpointTable {
+ public:
+  virtual ~HashedEndpointTable() = default;
+
+  // Returns the number of positions in the table.
+  virtual size_t size() const = 0;
+  // Returns the position that owns hash h.
+  virtual size_t FindIndex(uint64_t h) const = 0;
+  // Returns the index of the endpoint at position i, in the list that the
+  // table was built from.
+  virtual size_t EndpointIndex(size_t i) const = 0;
+};
+
+// The ring used by the ring_hash policy.  Each entry maps a hash to the
+// index of an endpoint in the list that the ring was built from.
+class RingHashRing : public HashedEndpointTable {
+ public:
+  struct Entry {
+    uint64_t hash;
+    size_t endpoint_index;
+  };
+
+  RingHashRing() = default;
+  RingHashRing(const std::vector<HashedEndpoint>& endpoints,
+               size_t min_ring_size, size_t max_ring_size);
+
+  const std::vector<Entry>& entries() const { return entries_; }
+
+  size_t size() const override { return entries_.size(); }
+  // Returns the index in entries() of the entry that owns hash h, i.e. the
+  // first entry whose hash is >= h, wrapping around to 0.
+  size_t FindIndex(uint64_t h) const override;
+  size_t EndpointIndex(size_t i) const override {
+    return entries_[i].endpoint_index;
+  }
+
+ private:
+  std::vector<Entry> entries_;
+};
+
 // Helper Parsing method to parse ring hash policy configs; for example, ring
 // hash size validity.
 struct RingHashConfig {
@@ -42,6 +104,33 @@ struct RingHashConfig {
                     ValidationErrors* errors);
 };
 
+// Config of a policy created by MakeHashTableLbPolicy().
+class HashTableLbConfig : public LoadBalancingPolicy::Config {
+ public:
+  // Builds the table to pick from for a new list of endpoints.
+  virtual std::unique_ptr<HashedEndpointTable> MakeTable(
+      const std::vector<HashedEndpoint>& endpoints) const = 0;
+};
+
+// Describes a policy created by MakeHashTableLbPolicy().
+struct HashTableLbPolicyInfo {
+  // The policy name.
+  absl::string_view name;
+  // Prefix of trace log lines, e.g. "RH".
+  const char* log_tag;
+  // Names the policy in pick failures, e.g. "ring hash".
+  const char* description;
+  TraceFlag* trace;
+};
+
+// Creates a policy that picks the endpoint owning each request's hash in the
+// table built by its HashTableLbConfig.  This is the ring_hash policy
+// with the ring made pluggable: the subchannel connectivity aggregation, the
+// connection attempts triggered by picks and the fallback to the following
+// positions of the table are shared by every policy created this way.
+OrphanablePtr<LoadBalancingPolicy> MakeHashTableLbPolicy(
+    LoadBalancingPolicy::Args args, const HashTableLbPolicyInfo& info);
+
 }  // namespace grpc_core
 
 #endif  // GRPC_CORE_EXT_FILTERS_CLIENT_CHANNEL_LB_POLICY_RING_HASH_RING_HASH_H
@@ -0,0 +1,66 @@
+//
+// Copyright 2022 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#ifndef GRPC_CORE_EXT_FILTERS_CLIENT_CHANNEL_LB_POLICY_WEIGHTED_ROUND_ROBIN_WEIGHTED_ROUND_ROBIN_H
+#define GRPC_CORE_EXT_FILTERS_CLIENT_CHANNEL_LB_POLICY_WEIGHTED_ROUND_ROBIN_WEIGHTED_ROUND_ROBIN_H
+
+#include <grpc/support/port_platform.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <vector>
+
+#include "absl/types/optional.h"
+
+namespace grpc_core {
+
+// Picks from a fixed set of weights in O(1) time with no locking.
+//
+// Each backend i gets a scaled integer weight w_i in [1, kMaxWeight]. The
+// picker walks a shared atomic sequence number; position seq maps to backend
+// seq % n in "generation" seq / n, and the backend is accepted in a given
+// generation iff its weight accumulated so far crosses a multiple of
+// kMaxWeight. Over kMaxWeight generations backend i is therefore accepted
+// exactly w_i times, and since the largest weight is always kMaxWeight the
+// expected number of rejected positions per pick is bounded by n.
+class StaticStrideScheduler {
+ public:
+  static constexpr uint32_t kMaxWeight = 0xffff;
+
+  // Returns nullopt if fewer than two backends have a usable weight, in
+  // which case plain round robin gives the same result.
+  static absl::optional<StaticStrideScheduler> Make(
+      const std::vector<float>& float_weights, uint32_t initial_sequence);
+
+  StaticStrideScheduler(StaticStrideScheduler&& other) noexcept;
+  StaticStrideScheduler& operator=(StaticStrideScheduler&& other) noexcept;
+
+  // Returns the index of the next backend to use.
+  size_t Pick() const;
+
+ private:
+  StaticStrideScheduler(std::vector<uint16_t> weights,
+                        uint32_t initial_sequence);
+
+  std::vector<uint16_t> weights_;
+  mutable std::atomic<uint32_t> sequence_;
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_CORE_EXT_FILTERS_CLIENT_CHANNEL_LB_POLICY_WEIGHTED_ROUND_ROBIN_WEIGHTED_ROUND_ROBIN_H
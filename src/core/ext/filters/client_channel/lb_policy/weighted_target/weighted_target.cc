@@ -16,8 +16,6 @@
 
 #include <grpc/support/port_platform.h>
 
-#include <stdlib.h>
-
 #include <algorithm>
 #include <cstdint>
 #include <map>
@@ -27,6 +25,7 @@
 #include <vector>
 
 #include "absl/memory/memory.h"
+#include "absl/random/random.h"
 #include "absl/status/status.h"
 #include "absl/status/statusor.h"
 #include "absl/strings/str_cat.h"
@@ -260,8 +259,11 @@ class WeightedTargetLb : public LoadBalancingPolicy {
 
 WeightedTargetLb::PickResult WeightedTargetLb::WeightedPicker::Pick(
     PickArgs args) {
-  // Generate a random number in [0, total weight).
-  const uint32_t key = rand() % pickers_[pickers_.size() - 1].first;
+  // Generate a random number in [0, total weight).  Each thread uses its
+  // own generator, since picks may run concurrently.
+  thread_local absl::InsecureBitGen bit_gen;
+  const uint32_t key =
+      absl::Uniform<uint32_t>(bit_gen, 0, pickers_[pickers_.size() - 1].first);
   // Find the index in pickers_ corresponding to key.
   size_t mid = 0;
   size_t start_index = 0;
@@ -513,6 +513,14 @@ void CdsLb::OnClusterChanged(const std::string& name,
           {"min_ring_size", cluster_data.min_ring_size},
           {"max_ring_size", cluster_data.max_ring_size},
       };
+    } else if (lb_policy == "MAGLEV") {
+      xds_lb_policy["MAGLEV"] = Json::Object{
+          {"tableSize", cluster_data.table_size},
+      };
+    } else if (lb_policy == "LEAST_REQUEST") {
+      xds_lb_policy["LEAST_REQUEST"] = Json::Object{
+          {"choiceCount", cluster_data.choice_count},
+      };
     } else {
       xds_lb_policy["ROUND_ROBIN"] = Json::Object();
     }
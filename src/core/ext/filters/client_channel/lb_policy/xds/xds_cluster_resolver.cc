@@ -41,6 +41,7 @@
 
 #include "src/core/ext/filters/client_channel/lb_policy/address_filtering.h"
 #include "src/core/ext/filters/client_channel/lb_policy/child_policy_handler.h"
+#include "src/core/ext/filters/client_channel/lb_policy/maglev/maglev.h"
 #include "src/core/ext/filters/client_channel/lb_policy/outlier_detection/outlier_detection.h"
 #include "src/core/ext/filters/client_channel/lb_policy/ring_hash/ring_hash.h"
 #include "src/core/ext/filters/client_channel/lb_policy/xds/xds.h"
@@ -881,7 +882,18 @@ XdsClusterResolverLb::CreateChildPolicyConfigLocked() {
             discovery_entry.discovery_mechanism->override_child_policy();
       } else {
         const auto& xds_lb_policy = config_->xds_lb_policy().object_value();
-        if (xds_lb_policy.find("ROUND_ROBIN") != xds_lb_policy.end()) {
+        auto least_request_it = xds_lb_policy.find("LEAST_REQUEST");
+        auto maglev_it = xds_lb_policy.find("MAGLEV");
+        if (xds_lb_policy.find("ROUND_ROBIN") != xds_lb_policy.end() ||
+            least_request_it != xds_lb_policy.end()) {
+          // Endpoint-picking policy used within each locality.
+          Json::Object endpoint_picking_policy;
+          if (least_request_it != xds_lb_policy.end()) {
+            endpoint_picking_policy["least_request"] =
+                least_request_it->second;
+          } else {
+            endpoint_picking_policy["round_robin"] = Json::Object();
+          }
           const auto& localities = priority_entry.localities;
           Json::Object weighted_targets;
           for (const auto& p : localities) {
@@ -893,9 +905,7 @@ XdsClusterResolverLb::CreateChildPolicyConfigLocked() {
                     {"weight", locality.lb_weight},
                     {"childPolicy",
                      Json::Array{
-                         Json::Object{
-                             {"round_robin", Json::Object()},
-                         },
+                         endpoint_picking_policy,
                      }},
                 };
           }
@@ -915,6 +925,12 @@ XdsClusterResolverLb::CreateChildPolicyConfigLocked() {
           GPR_ASSERT(it != config.end());
           (*it->second.mutable_object())["targets"] =
               std::move(weighted_targets);
+        } else if (maglev_it != xds_lb_policy.end()) {
+          child_policy = Json::Array{
+              Json::Object{
+                  {"maglev_experimental", maglev_it->second},
+              },
+          };
         } else {
           auto it = xds_lb_policy.find("RING_HASH");
           GPR_ASSERT(it != xds_lb_policy.end());
@@ -1175,6 +1191,24 @@ void XdsClusterResolverLbConfig::JsonPostLoad(const Json& json,
             }
             break;
           }
+          policy_it = policy.find("LEAST_REQUEST");
+          if (policy_it != policy.end()) {
+            ValidationErrors::ScopedField field(errors,
+                                                "[\"LEAST_REQUEST\"]");
+            if (policy_it->second.type() != Json::Type::OBJECT) {
+              errors->AddError("is not an object");
+            } else {
+              xds_lb_policy_ = array[i];
+            }
+            break;
+          }
+          policy_it = policy.find("MAGLEV");
+          if (policy_it != policy.end()) {
+            ValidationErrors::ScopedField field(errors, "[\"MAGLEV\"]");
+            LoadFromJson<MaglevConfig>(policy_it->second, args, errors);
+            xds_lb_policy_ = array[i];
+            break;
+          }
           {
             ValidationErrors::ScopedField field(errors, "[\"RING_HASH\"]");
             policy_it = policy.find("RING_HASH");
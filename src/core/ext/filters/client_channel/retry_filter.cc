@@ -250,11 +250,21 @@ class RetryFilter::CallData {
     ~CallAttempt() override;
 
     bool lb_call_committed() const { return lb_call_committed_; }
+    size_t completed_send_message_count() const {
+      return completed_send_message_count_;
+    }
+
+    // Adds whatever batches are needed on this attempt to closures.
+    void AddRetriableBatches(CallCombinerClosureList* closures);
 
     // Constructs and starts whatever batches are needed on this call
     // attempt.
     void StartRetriableBatches();
 
+    // Cancels and abandons this attempt because the call has been
+    // committed to a different (hedged) attempt.
+    void AbandonForCommit(CallCombinerClosureList* closures);
+
     // Frees cached send ops that have already been completed after
     // committing the call.
     void FreeCachedSendOpDataAfterCommit();
@@ -420,9 +430,6 @@ class RetryFilter::CallData {
     // Adds batches for pending batches to closures.
     void AddBatchesForPendingBatches(CallCombinerClosureList* closures);
 
-    // Adds whatever batches are needed on this attempt to closures.
-    void AddRetriableBatches(CallCombinerClosureList* closures);
-
     // Returns true if any send op in the batch was not yet started on this
     // attempt.
     bool PendingBatchContainsUnstartedSendOps(PendingBatch* pending);
@@ -439,6 +446,13 @@ class RetryFilter::CallData {
     bool ShouldRetry(absl::optional<grpc_status_code> status,
                      absl::optional<Duration> server_pushback_ms);
 
+    // Used instead of ShouldRetry() when the method has a hedging policy.
+    // Returns true if this attempt should be dropped while the call carries
+    // on, either with other hedged attempts still in flight or with a new
+    // one.
+    bool ShouldContinueHedging(grpc_status_code status,
+                               absl::optional<Duration> server_pushback);
+
     // Abandons the call attempt.  Unrefs any deferred batches.
     void Abandon();
 
@@ -450,6 +464,8 @@ class RetryFilter::CallData {
     AttemptDispatchController attempt_dispatch_controller_;
     OrphanablePtr<ClientChannel::LoadBalancedCall> lb_call_;
     bool lb_call_committed_ = false;
+    // Value of the grpc-previous-rpc-attempts header sent on this attempt.
+    const int num_previous_attempts_;
 
     grpc_timer per_attempt_recv_timer_;
     grpc_closure on_per_attempt_recv_timer_;
@@ -542,8 +558,12 @@ class RetryFilter::CallData {
   void FreeAllCachedSendOpData();
 
   // Commits the call so that no further retry attempts will be performed.
+  // Any other hedged attempts still in flight are cancelled.
   void RetryCommit(CallAttempt* call_attempt);
 
+  // Drops calld's ref to a call attempt that has been abandoned.
+  void RemoveCallAttempt(CallAttempt* call_attempt);
+
   // Starts a timer to retry after appropriate back-off.
   // If server_pushback is nullopt, retry_backoff_ is used.
   void StartRetryTimer(absl::optional<Duration> server_pushback);
@@ -551,6 +571,23 @@ class RetryFilter::CallData {
   static void OnRetryTimer(void* arg, grpc_error_handle error);
   static void OnRetryTimerLocked(void* arg, grpc_error_handle error);
 
+  // Returns true if the hedging policy allows starting another attempt.
+  bool CanStartHedgedAttempt();
+  // Starts the timer for sending the next hedged attempt, if any remain.
+  void MaybeStartHedgingTimer();
+  void MaybeCancelHedgingTimer();
+  static void OnHedgingTimer(void* arg, grpc_error_handle error);
+  static void OnHedgingTimerLocked(void* arg, grpc_error_handle error);
+
+  // One arming of the hedging timer.  Each arming gets its own timer and
+  // closure, allocated on the call arena, because the callback of a
+  // cancelled arming may still be pending when the timer is re-armed.
+  struct HedgingTimer {
+    CallData* calld;
+    grpc_timer timer;
+    grpc_closure closure;
+  };
+
   // Adds a closure to closures to start a transparent retry.
   void AddClosureToStartTransparentRetry(CallCombinerClosureList* closures);
   static void StartTransparentRetry(void* arg, grpc_error_handle error);
@@ -578,10 +615,9 @@ class RetryFilter::CallData {
 
   RefCountedPtr<CallStackDestructionBarrier> call_stack_destruction_barrier_;
 
-  // TODO(roth): As part of implementing hedging, we will need to maintain a
-  // list of all pending attempts, so that we can cancel them all if the call
-  // gets cancelled.
-  RefCountedPtr<CallAttempt> call_attempt_;
+  // Call attempts in flight.  Unless the method has a hedging policy,
+  // there is at most one.
+  absl::InlinedVector<RefCountedPtr<CallAttempt>, 1> call_attempts_;
 
   // LB call used when we've committed to a call attempt and the retry
   // state for that attempt is no longer needed.  This provides a fast
@@ -604,9 +640,21 @@ class RetryFilter::CallData {
   bool retry_timer_pending_ : 1;
   bool retry_codepath_started_ : 1;
   bool sent_transparent_retry_not_seen_by_server_ : 1;
+  bool transparent_retry_pending_ : 1;
+  // Hedging state.
+  // Set when server pushback tells us not to send any more hedged attempts.
+  bool hedging_stopped_ : 1;
+  // Set when the call is committed while other hedged attempts were still
+  // in flight.  Those attempts may still be using the cached send op data,
+  // so we keep it until the call is destroyed.
+  bool keep_cached_send_ops_ : 1;
   int num_attempts_completed_ = 0;
+  int num_attempts_started_ = 0;
   grpc_timer retry_timer_;
   grpc_closure retry_closure_;
+  // The currently armed hedging timer, or null if none is pending.  A
+  // callback whose arming is no longer current acts as a cancellation.
+  HedgingTimer* hedging_timer_ = nullptr;
 
   // Cached data for retrying send ops.
   // send_initial_metadata
@@ -701,6 +749,10 @@ RetryFilter::CallData::CallAttempt::CallAttempt(CallData* calld,
                                                            : nullptr),
       calld_(calld),
       attempt_dispatch_controller_(this),
+      num_previous_attempts_(calld->retry_policy_ != nullptr &&
+                                     calld->retry_policy_->hedging()
+                                 ? calld->num_attempts_started_ - 1
+                                 : calld->num_attempts_completed_),
       batch_payload_(calld->call_context_),
       started_send_initial_metadata_(false),
       completed_send_initial_metadata_(false),
@@ -751,10 +803,8 @@ RetryFilter::CallData::CallAttempt::~CallAttempt() {
 }
 
 void RetryFilter::CallData::CallAttempt::FreeCachedSendOpDataAfterCommit() {
-  // TODO(roth): When we implement hedging, this logic will need to get
-  // a bit more complex, because there may be other (now abandoned) call
-  // attempts still using this data.  We may need to do some sort of
-  // ref-counting instead.
+  // Abandoned hedged attempts may still be using this data.
+  if (calld_->keep_cached_send_ops_) return;
   if (completed_send_initial_metadata_) {
     calld_->FreeCachedSendInitialMetadata();
   }
@@ -794,12 +844,9 @@ bool RetryFilter::CallData::CallAttempt::HaveSendOpsToReplay() {
 }
 
 void RetryFilter::CallData::CallAttempt::MaybeSwitchToFastPath() {
-  // If we're not yet committed, we can't switch yet.
-  // TODO(roth): As part of implementing hedging, this logic needs to
-  // check that *this* call attempt is the one that we've committed to.
-  // Might need to replace abandoned_ with an enum indicating whether we're
-  // in flight, abandoned, or the winning call attempt.
-  if (!calld_->retry_committed_) return;
+  // If we're not yet committed, we can't switch yet.  If we were committed
+  // but this attempt was abandoned, it is not the one we committed to.
+  if (!calld_->retry_committed_ || abandoned_) return;
   // If we've already switched to fast path, there's nothing to do here.
   if (calld_->committed_call_ != nullptr) return;
   // If the perAttemptRecvTimeout timer is pending, we can't switch yet.
@@ -817,7 +864,7 @@ void RetryFilter::CallData::CallAttempt::MaybeSwitchToFastPath() {
             calld_->chand_, calld_, this);
   }
   calld_->committed_call_ = std::move(lb_call_);
-  calld_->call_attempt_.reset(DEBUG_LOCATION, "MaybeSwitchToFastPath");
+  calld_->RemoveCallAttempt(this);
 }
 
 // If there are any cached send ops that need to be replayed on the
@@ -1124,6 +1171,23 @@ void RetryFilter::CallData::CallAttempt::CancelFromSurface(
   lb_call_->StartTransportStreamOpBatch(cancel_batch);
 }
 
+void RetryFilter::CallData::CallAttempt::AbandonForCommit(
+    CallCombinerClosureList* closures) {
+  if (GRPC_TRACE_FLAG_ENABLED(grpc_retry_trace)) {
+    gpr_log(GPR_INFO,
+            "chand=%p calld=%p attempt=%p: cancelling hedged attempt; call "
+            "committed to another attempt",
+            calld_->chand_, calld_, this);
+  }
+  MaybeCancelPerAttemptRecvTimer();
+  MaybeAddBatchForCancelOp(
+      grpc_error_set_int(GRPC_ERROR_CREATE_FROM_STATIC_STRING(
+                             "call committed to another hedged attempt"),
+                         GRPC_ERROR_INT_GRPC_STATUS, GRPC_STATUS_CANCELLED),
+      closures);
+  Abandon();
+}
+
 bool RetryFilter::CallData::CallAttempt::ShouldRetry(
     absl::optional<grpc_status_code> status,
     absl::optional<Duration> server_pushback) {
@@ -1225,6 +1289,56 @@ bool RetryFilter::CallData::CallAttempt::ShouldRetry(
   return true;
 }
 
+bool RetryFilter::CallData::CallAttempt::ShouldContinueHedging(
+    grpc_status_code status, absl::optional<Duration> server_pushback) {
+  if (GPR_LIKELY(status == GRPC_STATUS_OK)) {
+    if (calld_->retry_throttle_data_ != nullptr) {
+      calld_->retry_throttle_data_->RecordSuccess();
+    }
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_retry_trace)) {
+      gpr_log(GPR_INFO, "chand=%p calld=%p attempt=%p: call succeeded",
+              calld_->chand_, calld_, this);
+    }
+    return false;
+  }
+  // Any status not configured as non-fatal ends the call, cancelling the
+  // other hedged attempts.
+  if (!calld_->retry_policy_->non_fatal_status_codes().Contains(status)) {
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_retry_trace)) {
+      gpr_log(GPR_INFO,
+              "chand=%p calld=%p attempt=%p: status %s is fatal for hedging",
+              calld_->chand_, calld_, this, grpc_status_code_to_string(status));
+    }
+    return false;
+  }
+  // Record the failure.  The throttle is consulted before each new
+  // attempt is started, so the result is not needed here.
+  if (calld_->retry_throttle_data_ != nullptr) {
+    calld_->retry_throttle_data_->RecordFailure();
+  }
+  ++calld_->num_attempts_completed_;
+  // Negative server push-back means no more hedged attempts may be sent,
+  // but those already in flight may still succeed.
+  if (server_pushback.has_value() && *server_pushback < Duration::Zero()) {
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_retry_trace)) {
+      gpr_log(GPR_INFO,
+              "chand=%p calld=%p attempt=%p: no more hedged attempts due to "
+              "server push-back",
+              calld_->chand_, calld_, this);
+    }
+    calld_->hedging_stopped_ = true;
+    calld_->MaybeCancelHedgingTimer();
+  }
+  // If other attempts are still in flight, wait for them.
+  if (calld_->call_attempts_.size() > 1 ||
+      calld_->transparent_retry_pending_) {
+    return true;
+  }
+  // Otherwise, this was the last attempt in flight, so carry on only if
+  // we can start another one.
+  return calld_->CanStartHedgedAttempt();
+}
+
 void RetryFilter::CallData::CallAttempt::Abandon() {
   abandoned_ = true;
   // Unref batches for deferred completion callbacks that will now never
@@ -1294,6 +1408,7 @@ void RetryFilter::CallData::CallAttempt::OnPerAttemptRecvTimerLocked(
                                   /*server_pushback_ms=*/absl::nullopt)) {
       // Mark current attempt as abandoned.
       call_attempt->Abandon();
+      calld->RemoveCallAttempt(call_attempt);
       // We are retrying.  Start backoff timer.
       calld->StartRetryTimer(/*server_pushback=*/absl::nullopt);
     } else {
@@ -1366,10 +1481,8 @@ RetryFilter::CallData::CallAttempt::BatchData::~BatchData() {
 void RetryFilter::CallData::CallAttempt::BatchData::
     FreeCachedSendOpDataForCompletedBatch() {
   auto* calld = call_attempt_->calld_;
-  // TODO(roth): When we implement hedging, this logic will need to get
-  // a bit more complex, because there may be other (now abandoned) call
-  // attempts still using this data.  We may need to do some sort of
-  // ref-counting instead.
+  // Abandoned hedged attempts may still be using this data.
+  if (calld->keep_cached_send_ops_) return;
   if (batch_.send_initial_metadata) {
     calld->FreeCachedSendInitialMetadata();
   }
@@ -1769,9 +1882,15 @@ void RetryFilter::CallData::CallAttempt::BatchData::RecvTrailingMetadataReady(
   }
   // Check if we should retry.
   if (!is_lb_drop) {  // Never retry on LB drops.
-    enum { kNoRetry, kTransparentRetry, kConfigurableRetry } retry = kNoRetry;
-    // Handle transparent retries.
-    if (stream_network_state.has_value() && !calld->retry_committed_) {
+    enum {
+      kNoRetry,
+      kTransparentRetry,
+      kConfigurableRetry,
+      kHedgedRetry
+    } retry = kNoRetry;
+    // Handle transparent retries.  Only one can be pending at a time.
+    if (stream_network_state.has_value() && !calld->retry_committed_ &&
+        !calld->transparent_retry_pending_) {
       // If not sent on wire, then always retry.
       // If sent on wire but not seen by server, retry exactly once.
       if (*stream_network_state == GrpcStreamNetworkState::kNotSentOnWire) {
@@ -1783,10 +1902,17 @@ void RetryFilter::CallData::CallAttempt::BatchData::RecvTrailingMetadataReady(
         retry = kTransparentRetry;
       }
     }
-    // If not transparently retrying, check for configurable retry.
-    if (retry == kNoRetry &&
-        call_attempt->ShouldRetry(status, server_pushback)) {
-      retry = kConfigurableRetry;
+    // If not transparently retrying, check for configurable retry or
+    // hedging.
+    if (retry == kNoRetry) {
+      if (calld->retry_policy_ != nullptr && calld->retry_policy_->hedging()) {
+        if (!calld->retry_committed_ &&
+            call_attempt->ShouldContinueHedging(status, server_pushback)) {
+          retry = kHedgedRetry;
+        }
+      } else if (call_attempt->ShouldRetry(status, server_pushback)) {
+        retry = kConfigurableRetry;
+      }
     }
     // If we're retrying, do so.
     if (retry != kNoRetry) {
@@ -1804,11 +1930,19 @@ void RetryFilter::CallData::CallAttempt::BatchData::RecvTrailingMetadataReady(
       // For configurable retries, start retry timer.
       if (retry == kTransparentRetry) {
         calld->AddClosureToStartTransparentRetry(&closures);
-      } else {
+      } else if (retry == kConfigurableRetry) {
         calld->StartRetryTimer(server_pushback);
       }
       // Record that this attempt has been abandoned.
       call_attempt->Abandon();
+      calld->RemoveCallAttempt(call_attempt);
+      // For hedging, if this was the last attempt in flight, start the
+      // next one right away, or after the server push-back delay.
+      if (retry == kHedgedRetry && calld->call_attempts_.empty() &&
+          !calld->transparent_retry_pending_) {
+        calld->MaybeCancelHedgingTimer();
+        calld->StartRetryTimer(server_pushback.value_or(Duration::Zero()));
+      }
       // Yields call combiner.
       closures.RunClosures(calld->call_combiner_);
       return;
@@ -1995,9 +2129,10 @@ void RetryFilter::CallData::CallAttempt::BatchData::
   // If we've already completed one or more attempts, add the
   // grpc-retry-attempts header.
   call_attempt_->send_initial_metadata_ = calld->send_initial_metadata_.Copy();
-  if (GPR_UNLIKELY(calld->num_attempts_completed_ > 0)) {
-    call_attempt_->send_initial_metadata_.Set(GrpcPreviousRpcAttemptsMetadata(),
-                                              calld->num_attempts_completed_);
+  if (GPR_UNLIKELY(call_attempt_->num_previous_attempts_ > 0)) {
+    call_attempt_->send_initial_metadata_.Set(
+        GrpcPreviousRpcAttemptsMetadata(),
+        call_attempt_->num_previous_attempts_);
   } else {
     call_attempt_->send_initial_metadata_.Remove(
         GrpcPreviousRpcAttemptsMetadata());
@@ -2182,7 +2317,10 @@ RetryFilter::CallData::CallData(RetryFilter* chand,
       retry_committed_(false),
       retry_timer_pending_(false),
       retry_codepath_started_(false),
-      sent_transparent_retry_not_seen_by_server_(false) {}
+      sent_transparent_retry_not_seen_by_server_(false),
+      transparent_retry_pending_(false),
+      hedging_stopped_(false),
+      keep_cached_send_ops_(false) {}
 
 RetryFilter::CallData::~CallData() {
   FreeAllCachedSendOpData();
@@ -2229,19 +2367,17 @@ void RetryFilter::CallData::StartTransportStreamOpBatch(
     PendingBatchesFail(GRPC_ERROR_REF(cancelled_from_surface_));
     // If we have a current call attempt, commit the call, then send
     // the cancellation down to that attempt.  When the call fails, it
-    // will not be retried, because we have committed it here.
-    if (call_attempt_ != nullptr) {
-      RetryCommit(call_attempt_.get());
-      // TODO(roth): When implementing hedging, this will get more
-      // complex, because instead of just passing the batch down to a
-      // single call attempt, we'll need to cancel multiple call
-      // attempts and wait for the cancellation on_complete from each call
-      // attempt before we propagate the on_complete from this batch
-      // back to the surface.
+    // will not be retried, because we have committed it here.  Committing
+    // cancels any other hedged attempts, so the surface's cancellation
+    // only needs to go down to the one that remains.
+    if (!call_attempts_.empty()) {
+      RefCountedPtr<CallAttempt> call_attempt = call_attempts_.front();
+      RetryCommit(call_attempt.get());
       // Note: This will release the call combiner.
-      call_attempt_->CancelFromSurface(batch);
+      call_attempt->CancelFromSurface(batch);
       return;
     }
+    MaybeCancelHedgingTimer();
     // Cancel retry timer if needed.
     if (retry_timer_pending_) {
       if (GRPC_TRACE_FLAG_ENABLED(grpc_retry_trace)) {
@@ -2263,13 +2399,16 @@ void RetryFilter::CallData::StartTransportStreamOpBatch(
   PendingBatch* pending = PendingBatchesAdd(batch);
   // If the timer is pending, yield the call combiner and wait for it to
   // run, since we don't want to start another call attempt until it does.
-  if (retry_timer_pending_) {
+  // Likewise for a transparent retry that is about to start, unless other
+  // hedged attempts are still in flight to take the batch.
+  if (retry_timer_pending_ ||
+      (transparent_retry_pending_ && call_attempts_.empty())) {
     GRPC_CALL_COMBINER_STOP(call_combiner_,
                             "added pending batch while retry timer pending");
     return;
   }
   // If we do not yet have a call attempt, create one.
-  if (call_attempt_ == nullptr) {
+  if (call_attempts_.empty()) {
     // If this is the first batch and retries are already committed
     // (e.g., if this batch put the call above the buffer size limit), then
     // immediately create an LB call and delegate the batch to it.  This
@@ -2316,11 +2455,27 @@ void RetryFilter::CallData::StartTransportStreamOpBatch(
     return;
   }
   // Send batches to call attempt.
+  if (call_attempts_.size() == 1) {
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_retry_trace)) {
+      gpr_log(GPR_INFO, "chand=%p calld=%p: starting batch on attempt=%p",
+              chand_, this, call_attempts_.front().get());
+    }
+    call_attempts_.front()->StartRetriableBatches();
+    return;
+  }
+  // With several hedged attempts in flight, the batch goes to each of them.
   if (GRPC_TRACE_FLAG_ENABLED(grpc_retry_trace)) {
-    gpr_log(GPR_INFO, "chand=%p calld=%p: starting batch on attempt=%p", chand_,
-            this, call_attempt_.get());
+    gpr_log(GPR_INFO,
+            "chand=%p calld=%p: starting batch on %" PRIuPTR
+            " hedged attempts",
+            chand_, this, call_attempts_.size());
   }
-  call_attempt_->StartRetriableBatches();
+  CallCombinerClosureList closures;
+  for (auto& call_attempt : call_attempts_) {
+    call_attempt->AddRetriableBatches(&closures);
+  }
+  // Note: This will yield the call combiner.
+  closures.RunClosures(call_combiner_);
 }
 
 OrphanablePtr<ClientChannel::LoadBalancedCall>
@@ -2339,8 +2494,14 @@ RetryFilter::CallData::CreateLoadBalancedCall(
 }
 
 void RetryFilter::CallData::CreateCallAttempt(bool is_transparent_retry) {
-  call_attempt_ = MakeRefCounted<CallAttempt>(this, is_transparent_retry);
-  call_attempt_->StartRetriableBatches();
+  if (!is_transparent_retry) ++num_attempts_started_;
+  call_attempts_.push_back(
+      MakeRefCounted<CallAttempt>(this, is_transparent_retry));
+  CallAttempt* call_attempt = call_attempts_.back().get();
+  if (retry_policy_ != nullptr && retry_policy_->hedging()) {
+    MaybeStartHedgingTimer();
+  }
+  call_attempt->StartRetriableBatches();
 }
 
 //
@@ -2458,9 +2619,6 @@ RetryFilter::CallData::PendingBatch* RetryFilter::CallData::PendingBatchesAdd(
   if (batch->send_trailing_metadata) {
     pending_send_trailing_metadata_ = true;
   }
-  // TODO(roth): When we implement hedging, if there are currently attempts
-  // in flight, we will need to pick the one on which the max number of send
-  // ops have already been sent, and we commit to that attempt.
   if (GPR_UNLIKELY(bytes_buffered_for_retry_ >
                    chand_->per_rpc_retry_buffer_size_)) {
     if (GRPC_TRACE_FLAG_ENABLED(grpc_retry_trace)) {
@@ -2468,7 +2626,17 @@ RetryFilter::CallData::PendingBatch* RetryFilter::CallData::PendingBatchesAdd(
               "chand=%p calld=%p: exceeded retry buffer size, committing",
               chand_, this);
     }
-    RetryCommit(call_attempt_.get());
+    // If several hedged attempts are in flight, commit to the one that has
+    // the least left to replay.
+    CallAttempt* call_attempt = nullptr;
+    for (auto& attempt : call_attempts_) {
+      if (call_attempt == nullptr ||
+          attempt->completed_send_message_count() >
+              call_attempt->completed_send_message_count()) {
+        call_attempt = attempt.get();
+      }
+    }
+    RetryCommit(call_attempt);
   }
   return pending;
 }
@@ -2576,7 +2744,25 @@ void RetryFilter::CallData::RetryCommit(CallAttempt* call_attempt) {
   if (GRPC_TRACE_FLAG_ENABLED(grpc_retry_trace)) {
     gpr_log(GPR_INFO, "chand=%p calld=%p: committing retries", chand_, this);
   }
+  MaybeCancelHedgingTimer();
   if (call_attempt != nullptr) {
+    // Cancel any other hedged attempts still in flight.  Their cancel
+    // batches hold refs to them until they complete.
+    if (call_attempts_.size() > 1) {
+      CallCombinerClosureList closures;
+      RefCountedPtr<CallAttempt> winner;
+      for (auto& attempt : call_attempts_) {
+        if (attempt.get() == call_attempt) {
+          winner = std::move(attempt);
+        } else {
+          attempt->AbandonForCommit(&closures);
+        }
+      }
+      call_attempts_.clear();
+      if (winner != nullptr) call_attempts_.push_back(std::move(winner));
+      keep_cached_send_ops_ = true;
+      closures.RunClosuresWithoutYielding(call_combiner_);
+    }
     // If the call attempt's LB call has been committed, inform the call
     // dispatch controller that the call has been committed.
     // Note: If call_attempt is null, this is happening before the first
@@ -2594,10 +2780,17 @@ void RetryFilter::CallData::RetryCommit(CallAttempt* call_attempt) {
   }
 }
 
+void RetryFilter::CallData::RemoveCallAttempt(CallAttempt* call_attempt) {
+  for (auto it = call_attempts_.begin(); it != call_attempts_.end(); ++it) {
+    if (it->get() == call_attempt) {
+      call_attempts_.erase(it);
+      return;
+    }
+  }
+}
+
 void RetryFilter::CallData::StartRetryTimer(
     absl::optional<Duration> server_pushback) {
-  // Reset call attempt.
-  call_attempt_.reset(DEBUG_LOCATION, "StartRetryTimer");
   // Compute backoff delay.
   Timestamp next_attempt_time;
   if (server_pushback.has_value()) {
@@ -2638,12 +2831,105 @@ void RetryFilter::CallData::OnRetryTimerLocked(void* arg,
   GRPC_CALL_STACK_UNREF(calld->owning_call_, "OnRetryTimer");
 }
 
+bool RetryFilter::CallData::CanStartHedgedAttempt() {
+  if (retry_committed_ || hedging_stopped_ ||
+      !GRPC_ERROR_IS_NONE(cancelled_from_surface_)) {
+    return false;
+  }
+  if (num_attempts_started_ >= retry_policy_->max_attempts()) {
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_retry_trace)) {
+      gpr_log(GPR_INFO, "chand=%p calld=%p: exceeded %d hedged attempts",
+              chand_, this, retry_policy_->max_attempts());
+    }
+    return false;
+  }
+  if (retry_throttle_data_ != nullptr &&
+      !retry_throttle_data_->RetriesAllowed()) {
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_retry_trace)) {
+      gpr_log(GPR_INFO, "chand=%p calld=%p: hedged attempts throttled",
+              chand_, this);
+    }
+    return false;
+  }
+  auto* service_config_call_data =
+      static_cast<ClientChannelServiceConfigCallData*>(
+          call_context_[GRPC_CONTEXT_SERVICE_CONFIG_CALL_DATA].value);
+  return service_config_call_data->call_dispatch_controller()->ShouldRetry();
+}
+
+void RetryFilter::CallData::MaybeStartHedgingTimer() {
+  if (hedging_timer_ != nullptr || hedging_stopped_ ||
+      num_attempts_started_ >= retry_policy_->max_attempts()) {
+    return;
+  }
+  if (GRPC_TRACE_FLAG_ENABLED(grpc_retry_trace)) {
+    gpr_log(GPR_INFO,
+            "chand=%p calld=%p: sending hedged attempt %d in %" PRId64 " ms",
+            chand_, this, num_attempts_started_ + 1,
+            retry_policy_->hedging_delay().millis());
+  }
+  hedging_timer_ = arena_->New<HedgingTimer>();
+  hedging_timer_->calld = this;
+  GRPC_CLOSURE_INIT(&hedging_timer_->closure, OnHedgingTimer, hedging_timer_,
+                    nullptr);
+  GRPC_CALL_STACK_REF(owning_call_, "OnHedgingTimer");
+  grpc_timer_init(&hedging_timer_->timer,
+                  Timestamp::Now() + retry_policy_->hedging_delay(),
+                  &hedging_timer_->closure);
+}
+
+void RetryFilter::CallData::MaybeCancelHedgingTimer() {
+  if (hedging_timer_ != nullptr) {
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_retry_trace)) {
+      gpr_log(GPR_INFO, "chand=%p calld=%p: cancelling hedging timer", chand_,
+              this);
+    }
+    // Lame timer callback.  The callback still runs against its own
+    // HedgingTimer, so the timer may be re-armed right away.
+    HedgingTimer* hedging_timer = std::exchange(hedging_timer_, nullptr);
+    grpc_timer_cancel(&hedging_timer->timer);
+  }
+}
+
+void RetryFilter::CallData::OnHedgingTimer(void* arg,
+                                           grpc_error_handle error) {
+  auto* hedging_timer = static_cast<HedgingTimer*>(arg);
+  GRPC_CLOSURE_INIT(&hedging_timer->closure, OnHedgingTimerLocked,
+                    hedging_timer, nullptr);
+  GRPC_CALL_COMBINER_START(hedging_timer->calld->call_combiner_,
+                           &hedging_timer->closure, GRPC_ERROR_REF(error),
+                           "hedging timer fired");
+}
+
+void RetryFilter::CallData::OnHedgingTimerLocked(void* arg,
+                                                 grpc_error_handle error) {
+  auto* hedging_timer = static_cast<HedgingTimer*>(arg);
+  CallData* calld = hedging_timer->calld;
+  if (GRPC_ERROR_IS_NONE(error) && calld->hedging_timer_ == hedging_timer) {
+    calld->hedging_timer_ = nullptr;
+    if (calld->CanStartHedgedAttempt()) {
+      if (GRPC_TRACE_FLAG_ENABLED(grpc_retry_trace)) {
+        gpr_log(GPR_INFO, "chand=%p calld=%p: starting hedged attempt",
+                calld->chand_, calld);
+      }
+      calld->CreateCallAttempt(/*is_transparent_retry=*/false);
+    } else {
+      GRPC_CALL_COMBINER_STOP(calld->call_combiner_,
+                              "hedged attempt not allowed");
+    }
+  } else {
+    GRPC_CALL_COMBINER_STOP(calld->call_combiner_, "hedging timer cancelled");
+  }
+  GRPC_CALL_STACK_UNREF(calld->owning_call_, "OnHedgingTimer");
+}
+
 void RetryFilter::CallData::AddClosureToStartTransparentRetry(
     CallCombinerClosureList* closures) {
   if (GRPC_TRACE_FLAG_ENABLED(grpc_retry_trace)) {
     gpr_log(GPR_INFO, "chand=%p calld=%p: scheduling transparent retry", chand_,
             this);
   }
+  transparent_retry_pending_ = true;
   GRPC_CALL_STACK_REF(owning_call_, "OnRetryTimer");
   GRPC_CLOSURE_INIT(&retry_closure_, StartTransparentRetry, this, nullptr);
   closures->Add(&retry_closure_, GRPC_ERROR_NONE, "start transparent retry");
@@ -2652,11 +2938,23 @@ void RetryFilter::CallData::AddClosureToStartTransparentRetry(
 void RetryFilter::CallData::StartTransparentRetry(void* arg,
                                                   grpc_error_handle /*error*/) {
   auto* calld = static_cast<CallData*>(arg);
-  if (GRPC_ERROR_IS_NONE(calld->cancelled_from_surface_)) {
-    calld->CreateCallAttempt(/*is_transparent_retry=*/true);
-  } else {
+  calld->transparent_retry_pending_ = false;
+  if (!GRPC_ERROR_IS_NONE(calld->cancelled_from_surface_)) {
     GRPC_CALL_COMBINER_STOP(calld->call_combiner_,
                             "call cancelled before transparent retry");
+  } else if (calld->retry_committed_ && !calld->call_attempts_.empty()) {
+    // Another hedged attempt was committed first, so give it any batches
+    // that were queued behind the transparent retry.
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_retry_trace)) {
+      gpr_log(GPR_INFO,
+              "chand=%p calld=%p: call committed to attempt=%p before "
+              "transparent retry",
+              calld->chand_, calld, calld->call_attempts_.front().get());
+    }
+    // Note: This will yield the call combiner.
+    calld->call_attempts_.front()->StartRetriableBatches();
+  } else {
+    calld->CreateCallAttempt(/*is_transparent_retry=*/true);
   }
   GRPC_CALL_STACK_UNREF(calld->owning_call_, "OnRetryTimer");
 }
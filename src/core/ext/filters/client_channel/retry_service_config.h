@@ -65,6 +65,16 @@ class RetryMethodConfig : public ServiceConfigParser::ParsedConfig {
         retryable_status_codes_(retryable_status_codes),
         per_attempt_recv_timeout_(per_attempt_recv_timeout) {}
 
+  // Creates a config for a hedging policy, as described in gRFC A6.
+  RetryMethodConfig(int max_attempts, Duration hedging_delay,
+                    StatusCodeSet non_fatal_status_codes)
+      : max_attempts_(max_attempts),
+        hedging_delay_(hedging_delay),
+        non_fatal_status_codes_(non_fatal_status_codes) {}
+
+  // True if this config holds a hedgingPolicy rather than a retryPolicy.
+  bool hedging() const { return hedging_delay_.has_value(); }
+
   int max_attempts() const { return max_attempts_; }
   Duration initial_backoff() const { return initial_backoff_; }
   Duration max_backoff() const { return max_backoff_; }
@@ -75,6 +85,13 @@ class RetryMethodConfig : public ServiceConfigParser::ParsedConfig {
   absl::optional<Duration> per_attempt_recv_timeout() const {
     return per_attempt_recv_timeout_;
   }
+  // Hedging parameters; only meaningful if hedging() is true.
+  Duration hedging_delay() const {
+    return hedging_delay_.value_or(Duration::Zero());
+  }
+  StatusCodeSet non_fatal_status_codes() const {
+    return non_fatal_status_codes_;
+  }
 
  private:
   int max_attempts_ = 0;
@@ -83,6 +100,8 @@ class RetryMethodConfig : public ServiceConfigParser::ParsedConfig {
   float backoff_multiplier_ = 0;
   StatusCodeSet retryable_status_codes_;
   absl::optional<Duration> per_attempt_recv_timeout_;
+  absl::optional<Duration> hedging_delay_;
+  StatusCodeSet non_fatal_status_codes_;
 };
 
 class RetryServiceConfigParser : public ServiceConfigParser::Parser {
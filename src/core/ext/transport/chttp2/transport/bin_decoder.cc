@@ -25,7 +25,7 @@
 #include <grpc/support/alloc.h>
 #include <grpc/support/log.h>
 
-static uint8_t decode_table[] = {
+static const uint8_t decode_table[] = {
     0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
     0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
     0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
@@ -110,16 +110,30 @@ bool grpc_base64_decode_partial(struct grpc_base64_decode_context* ctx) {
     return false;
   }
 
-  // Process a block of 4 input characters and 3 output bytes
-  while (ctx->input_end >= ctx->input_cur + 4 &&
-         ctx->output_end >= ctx->output_cur + 3) {
-    if (!input_is_valid(ctx->input_cur, 4)) return false;
-    ctx->output_cur[0] = COMPOSE_OUTPUT_BYTE_0(ctx->input_cur);
-    ctx->output_cur[1] = COMPOSE_OUTPUT_BYTE_1(ctx->input_cur);
-    ctx->output_cur[2] = COMPOSE_OUTPUT_BYTE_2(ctx->input_cur);
-    ctx->output_cur += 3;
-    ctx->input_cur += 4;
+  // Process a block of 4 input characters and 3 output bytes. Invalid
+  // characters decode to 0x40, so the block's codes are checked all at once.
+  const uint8_t* in = ctx->input_cur;
+  uint8_t* out = ctx->output_cur;
+  while (ctx->input_end - in >= 4 && ctx->output_end - out >= 3) {
+    const uint32_t c0 = decode_table[in[0]];
+    const uint32_t c1 = decode_table[in[1]];
+    const uint32_t c2 = decode_table[in[2]];
+    const uint32_t c3 = decode_table[in[3]];
+    if (GPR_UNLIKELY(((c0 | c1 | c2 | c3) & 0xC0) != 0)) {
+      ctx->input_cur = in;
+      ctx->output_cur = out;
+      // Logs the invalid character.
+      return input_is_valid(in, 4);
+    }
+    const uint32_t packed = (c0 << 18) | (c1 << 12) | (c2 << 6) | c3;
+    out[0] = static_cast<uint8_t>(packed >> 16);
+    out[1] = static_cast<uint8_t>(packed >> 8);
+    out[2] = static_cast<uint8_t>(packed);
+    out += 3;
+    in += 4;
   }
+  ctx->input_cur = in;
+  ctx->output_cur = out;
 
   // Process the tail of input data
   input_tail = static_cast<size_t>(ctx->input_end - ctx->input_cur);
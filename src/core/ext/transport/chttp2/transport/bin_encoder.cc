@@ -27,14 +27,14 @@
 
 #include "src/core/ext/transport/chttp2/transport/huffsyms.h"
 
-static const char alphabet[] =
+static constexpr char alphabet[] =
     "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
 
 struct b64_huff_sym {
   uint16_t bits;
   uint8_t length;
 };
-static const b64_huff_sym huff_alphabet[64] = {
+static constexpr b64_huff_sym huff_alphabet[64] = {
     {0x21, 6}, {0x5d, 7}, {0x5e, 7},   {0x5f, 7}, {0x60, 7}, {0x61, 7},
     {0x62, 7}, {0x63, 7}, {0x64, 7},   {0x65, 7}, {0x66, 7}, {0x67, 7},
     {0x68, 7}, {0x69, 7}, {0x6a, 7},   {0x6b, 7}, {0x6c, 7}, {0x6d, 7},
@@ -47,6 +47,40 @@ static const b64_huff_sym huff_alphabet[64] = {
     {0x2, 5},  {0x19, 6}, {0x1a, 6},   {0x1b, 6}, {0x1c, 6}, {0x1d, 6},
     {0x1e, 6}, {0x1f, 6}, {0x7fb, 11}, {0x18, 6}};
 
+namespace {
+/* Each 12 bit value covers two base64 characters, so tables indexed by it
+   encode a triplet with two lookups rather than four */
+
+/* Both characters of each pair */
+struct b64_pair_table {
+  char chars[4096][2]{};
+  constexpr b64_pair_table() {
+    for (int i = 0; i < 4096; i++) {
+      chars[i][0] = alphabet[i >> 6];
+      chars[i][1] = alphabet[i & 0x3f];
+    }
+  }
+};
+
+/* Both huffman codes of each pair, concatenated and shifted up to leave the
+   low 8 bits for their total length (at most 22) */
+struct b64_huff_pair_table {
+  uint32_t codes[4096]{};
+  constexpr b64_huff_pair_table() {
+    for (int i = 0; i < 4096; i++) {
+      const b64_huff_sym a = huff_alphabet[i >> 6];
+      const b64_huff_sym b = huff_alphabet[i & 0x3f];
+      const uint32_t bits =
+          (static_cast<uint32_t>(a.bits) << b.length) | b.bits;
+      codes[i] = (bits << 8) | static_cast<uint32_t>(a.length + b.length);
+    }
+  }
+};
+
+constexpr b64_pair_table b64_pairs;
+constexpr b64_huff_pair_table b64_huff_pairs;
+}  // namespace
+
 static const uint8_t tail_xtra[3] = {0, 2, 3};
 
 grpc_slice grpc_chttp2_base64_encode(const grpc_slice& input) {
@@ -61,10 +95,10 @@ grpc_slice grpc_chttp2_base64_encode(const grpc_slice& input) {
 
   /* encode full triplets */
   for (i = 0; i < input_triplets; i++) {
-    out[0] = alphabet[in[0] >> 2];
-    out[1] = alphabet[((in[0] & 0x3) << 4) | (in[1] >> 4)];
-    out[2] = alphabet[((in[1] & 0xf) << 2) | (in[2] >> 6)];
-    out[3] = alphabet[in[2] & 0x3f];
+    const uint32_t triplet = (static_cast<uint32_t>(in[0]) << 16) |
+                             (static_cast<uint32_t>(in[1]) << 8) | in[2];
+    memcpy(out, b64_pairs.chars[triplet >> 12], 2);
+    memcpy(out + 2, b64_pairs.chars[triplet & 0xfff], 2);
     out += 4;
     in += 3;
   }
@@ -111,17 +145,29 @@ grpc_slice grpc_chttp2_huffman_compress(const grpc_slice& input) {
   out = GRPC_SLICE_START_PTR(output);
   for (in = GRPC_SLICE_START_PTR(input); in != GRPC_SLICE_END_PTR(input);
        ++in) {
-    int sym = *in;
-    temp <<= grpc_chttp2_huffsyms[sym].length;
-    temp |= grpc_chttp2_huffsyms[sym].bits;
-    temp_length += grpc_chttp2_huffsyms[sym].length;
-
-    while (temp_length > 8) {
-      temp_length -= 8;
-      *out++ = static_cast<uint8_t>(temp >> temp_length);
+    const grpc_chttp2_huffsym& sym = grpc_chttp2_huffsyms[*in];
+    temp = (temp << sym.length) | sym.bits;
+    temp_length += sym.length;
+
+    /* symbols are at most 30 bits long, so up to 31 pending bits plus one more
+       symbol always fit in temp: write whole 32 bit words rather than single
+       bytes */
+    if (temp_length >= 32) {
+      temp_length -= 32;
+      const uint32_t word = static_cast<uint32_t>(temp >> temp_length);
+      out[0] = static_cast<uint8_t>(word >> 24);
+      out[1] = static_cast<uint8_t>(word >> 16);
+      out[2] = static_cast<uint8_t>(word >> 8);
+      out[3] = static_cast<uint8_t>(word);
+      out += 4;
     }
   }
 
+  while (temp_length > 8) {
+    temp_length -= 8;
+    *out++ = static_cast<uint8_t>(temp >> temp_length);
+  }
+
   if (temp_length) {
     /* NB: the following integer arithmetic operation needs to be in its
      * expanded form due to the "integral promotion" performed (see section
@@ -138,32 +184,34 @@ grpc_slice grpc_chttp2_huffman_compress(const grpc_slice& input) {
 }
 
 struct huff_out {
-  uint32_t temp;
+  uint64_t temp;
   uint32_t temp_length;
   uint8_t* out;
 };
-static void enc_flush_some(huff_out* out) {
-  while (out->temp_length > 8) {
-    out->temp_length -= 8;
-    *out->out++ = static_cast<uint8_t>(out->temp >> out->temp_length);
+static void enc_add(huff_out* out, uint32_t bits, uint32_t length) {
+  out->temp = (out->temp << length) | bits;
+  out->temp_length += length;
+  /* codes added are at most 22 bits long, so up to 31 pending bits plus one
+     more code always fit in temp: write whole 32 bit words at a time */
+  if (out->temp_length >= 32) {
+    out->temp_length -= 32;
+    const uint32_t word = static_cast<uint32_t>(out->temp >> out->temp_length);
+    out->out[0] = static_cast<uint8_t>(word >> 24);
+    out->out[1] = static_cast<uint8_t>(word >> 16);
+    out->out[2] = static_cast<uint8_t>(word >> 8);
+    out->out[3] = static_cast<uint8_t>(word);
+    out->out += 4;
   }
 }
 
-static void enc_add2(huff_out* out, uint8_t a, uint8_t b) {
-  b64_huff_sym sa = huff_alphabet[a];
-  b64_huff_sym sb = huff_alphabet[b];
-  out->temp = (out->temp << (sa.length + sb.length)) |
-              (static_cast<uint32_t>(sa.bits) << sb.length) | sb.bits;
-  out->temp_length +=
-      static_cast<uint32_t>(sa.length) + static_cast<uint32_t>(sb.length);
-  enc_flush_some(out);
+static void enc_add2(huff_out* out, uint32_t pair) {
+  const uint32_t code = b64_huff_pairs.codes[pair];
+  enc_add(out, code >> 8, code & 0xff);
 }
 
 static void enc_add1(huff_out* out, uint8_t a) {
   b64_huff_sym sa = huff_alphabet[a];
-  out->temp = (out->temp << sa.length) | sa.bits;
-  out->temp_length += sa.length;
-  enc_flush_some(out);
+  enc_add(out, sa.bits, sa.length);
 }
 
 grpc_slice grpc_chttp2_base64_encode_and_huffman_compress(
@@ -186,13 +234,10 @@ grpc_slice grpc_chttp2_base64_encode_and_huffman_compress(
 
   /* encode full triplets */
   for (i = 0; i < input_triplets; i++) {
-    const uint8_t low_to_high = static_cast<uint8_t>((in[0] & 0x3) << 4);
-    const uint8_t high_to_low = in[1] >> 4;
-    enc_add2(&out, in[0] >> 2, low_to_high | high_to_low);
-
-    const uint8_t a = static_cast<uint8_t>((in[1] & 0xf) << 2);
-    const uint8_t b = (in[2] >> 6);
-    enc_add2(&out, a | b, in[2] & 0x3f);
+    const uint32_t triplet = (static_cast<uint32_t>(in[0]) << 16) |
+                             (static_cast<uint32_t>(in[1]) << 8) | in[2];
+    enc_add2(&out, triplet >> 12);
+    enc_add2(&out, triplet & 0xfff);
     in += 3;
   }
 
@@ -201,17 +246,19 @@ grpc_slice grpc_chttp2_base64_encode_and_huffman_compress(
     case 0:
       break;
     case 1:
-      enc_add2(&out, in[0] >> 2, static_cast<uint8_t>((in[0] & 0x3) << 4));
+      enc_add2(&out, static_cast<uint32_t>(in[0]) << 4);
       in += 1;
       break;
-    case 2: {
-      const uint8_t low_to_high = static_cast<uint8_t>((in[0] & 0x3) << 4);
-      const uint8_t high_to_low = in[1] >> 4;
-      enc_add2(&out, in[0] >> 2, low_to_high | high_to_low);
+    case 2:
+      enc_add2(&out, (static_cast<uint32_t>(in[0]) << 4) | (in[1] >> 4));
       enc_add1(&out, static_cast<uint8_t>((in[1] & 0xf) << 2));
       in += 2;
       break;
-    }
+  }
+
+  while (out.temp_length > 8) {
+    out.temp_length -= 8;
+    *out.out++ = static_cast<uint8_t>(out.temp >> out.temp_length);
   }
 
   if (out.temp_length) {
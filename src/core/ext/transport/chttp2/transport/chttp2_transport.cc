@@ -46,6 +46,7 @@
 #include <grpc/support/alloc.h>
 #include <grpc/support/atm.h>
 #include <grpc/support/log.h>
+#include <grpc/support/time.h>
 
 #include "src/core/ext/transport/chttp2/transport/context_list.h"
 #include "src/core/ext/transport/chttp2/transport/flow_control.h"
@@ -137,6 +138,9 @@ static void write_action_begin_locked(void* t, grpc_error_handle error);
 static void write_action(void* t, grpc_error_handle error);
 static void write_action_end(void* t, grpc_error_handle error);
 static void write_action_end_locked(void* t, grpc_error_handle error);
+static void write_coalescing_timer_expired(void* t, grpc_error_handle error);
+static void write_coalescing_timer_expired_locked(void* t,
+                                                  grpc_error_handle error);
 
 static void read_action(void* t, grpc_error_handle error);
 static void read_action_locked(void* t, grpc_error_handle error);
@@ -313,6 +317,14 @@ static void read_channel_args(grpc_chttp2_transport* t,
   t->write_buffer_size =
       std::max(0, channel_args.GetInt(GRPC_ARG_HTTP2_WRITE_BUFFER_SIZE)
                       .value_or(grpc_core::chttp2::kDefaultWindow));
+  t->write_coalescing_window = std::max(
+      grpc_core::Duration::Zero(),
+      channel_args
+          .GetDurationFromIntMillis(GRPC_ARG_HTTP2_WRITE_COALESCING_WINDOW_MS)
+          .value_or(grpc_core::Duration::Zero()));
+  t->write_coalescing_bytes =
+      std::max(0, channel_args.GetInt(GRPC_ARG_HTTP2_WRITE_COALESCING_BYTES)
+                      .value_or(64 * 1024));
   t->keepalive_time =
       std::max(grpc_core::Duration::Milliseconds(1),
                channel_args.GetDurationFromIntMillis(GRPC_ARG_KEEPALIVE_TIME_MS)
@@ -574,6 +586,10 @@ static void close_transport_locked(grpc_chttp2_transport* t,
       }
       t->close_transport_on_writes_finished =
           grpc_error_add_child(t->close_transport_on_writes_finished, error);
+      // Don't keep the close waiting on a write held for coalescing.
+      if (t->write_coalescing_timer_pending) {
+        grpc_timer_cancel(&t->write_coalescing_timer);
+      }
       return;
     }
     GPR_ASSERT(!GRPC_ERROR_IS_NONE(error));
@@ -782,6 +798,29 @@ static void set_write_state(grpc_chttp2_transport* t,
   }
 }
 
+// Can a write initiated for this reason be held back for other streams to
+// join? Only writes carrying new stream data, or the window updates that go
+// with it (a call reading its own new stream asks for one right away), are:
+// everything else (acks, pings, connection window updates, resets...) is
+// either time sensitive or unblocks the whole connection.
+static bool write_may_coalesce(grpc_chttp2_transport* t,
+                               grpc_chttp2_initiate_write_reason reason) {
+  if (t->write_coalescing_window <= grpc_core::Duration::Zero() ||
+      t->write_coalescing_pending_bytes >= t->write_coalescing_bytes) {
+    return false;
+  }
+  switch (reason) {
+    case GRPC_CHTTP2_INITIATE_WRITE_START_NEW_STREAM:
+    case GRPC_CHTTP2_INITIATE_WRITE_SEND_MESSAGE:
+    case GRPC_CHTTP2_INITIATE_WRITE_SEND_INITIAL_METADATA:
+    case GRPC_CHTTP2_INITIATE_WRITE_SEND_TRAILING_METADATA:
+    case GRPC_CHTTP2_INITIATE_WRITE_STREAM_FLOW_CONTROL:
+      return true;
+    default:
+      return false;
+  }
+}
+
 void grpc_chttp2_initiate_write(grpc_chttp2_transport* t,
                                 grpc_chttp2_initiate_write_reason reason) {
   switch (t->write_state) {
@@ -789,6 +828,22 @@ void grpc_chttp2_initiate_write(grpc_chttp2_transport* t,
       set_write_state(t, GRPC_CHTTP2_WRITE_STATE_WRITING,
                       grpc_chttp2_initiate_write_reason_string(reason));
       GRPC_CHTTP2_REF_TRANSPORT(t, "writing");
+      if (write_may_coalesce(t, reason)) {
+        // Hold the write for up to write_coalescing_window so that streams
+        // becoming writable in the meantime share its syscall. The "writing"
+        // ref is handed to the timer, which starts the write when it fires
+        // or is cancelled to flush early.
+        t->write_coalescing_timer_pending = true;
+        t->write_coalescing_start = gpr_now(GPR_CLOCK_MONOTONIC);
+        GRPC_CLOSURE_INIT(&t->write_coalescing_timer_expired_locked,
+                          write_coalescing_timer_expired, t,
+                          grpc_schedule_on_exec_ctx);
+        grpc_timer_init(
+            &t->write_coalescing_timer,
+            grpc_core::ExecCtx::Get()->Now() + t->write_coalescing_window,
+            &t->write_coalescing_timer_expired_locked);
+        break;
+      }
       // Note that the 'write_action_begin_locked' closure is being scheduled
       // on the 'finally_scheduler' of t->combiner. This means that
       // 'write_action_begin_locked' is called only *after* all the other
@@ -811,6 +866,14 @@ void grpc_chttp2_initiate_write(grpc_chttp2_transport* t,
           GRPC_ERROR_NONE);
       break;
     case GRPC_CHTTP2_WRITE_STATE_WRITING:
+      if (t->write_coalescing_timer_pending) {
+        // The held write has not begun yet and will pick this up; just
+        // decide whether it has waited long enough.
+        if (!write_may_coalesce(t, reason)) {
+          grpc_timer_cancel(&t->write_coalescing_timer);
+        }
+        break;
+      }
       set_write_state(t, GRPC_CHTTP2_WRITE_STATE_WRITING_WITH_MORE,
                       grpc_chttp2_initiate_write_reason_string(reason));
       break;
@@ -819,6 +882,29 @@ void grpc_chttp2_initiate_write(grpc_chttp2_transport* t,
   }
 }
 
+static void write_coalescing_timer_expired(void* tp, grpc_error_handle error) {
+  grpc_chttp2_transport* t = static_cast<grpc_chttp2_transport*>(tp);
+  t->combiner->Run(
+      GRPC_CLOSURE_INIT(&t->write_coalescing_timer_expired_locked,
+                        write_coalescing_timer_expired_locked, t, nullptr),
+      GRPC_ERROR_REF(error));
+}
+
+// Runs both when the coalescing window ends and when the timer is cancelled
+// to flush early: either way the held write starts now.
+static void write_coalescing_timer_expired_locked(
+    void* tp, grpc_error_handle /*error*/) {
+  grpc_chttp2_transport* t = static_cast<grpc_chttp2_transport*>(tp);
+  GPR_ASSERT(t->write_coalescing_timer_pending);
+  t->write_coalescing_timer_pending = false;
+  GRPC_STATS_INC_HTTP2_WRITE_COALESCING_DELAY(gpr_timespec_to_micros(
+      gpr_time_sub(gpr_now(GPR_CLOCK_MONOTONIC), t->write_coalescing_start)));
+  t->combiner->FinallyRun(
+      GRPC_CLOSURE_INIT(&t->write_action_begin_locked,
+                        write_action_begin_locked, t, nullptr),
+      GRPC_ERROR_NONE);
+}
+
 void grpc_chttp2_mark_stream_writable(grpc_chttp2_transport* t,
                                       grpc_chttp2_stream* s) {
   if (GRPC_ERROR_IS_NONE(t->closed_with_error) &&
@@ -839,6 +925,7 @@ static void write_action_begin_locked(void* gt,
                                       grpc_error_handle /*error_ignored*/) {
   grpc_chttp2_transport* t = static_cast<grpc_chttp2_transport*>(gt);
   GPR_ASSERT(t->write_state != GRPC_CHTTP2_WRITE_STATE_IDLE);
+  t->write_coalescing_pending_bytes = 0;
   grpc_chttp2_begin_write_result r;
   if (!GRPC_ERROR_IS_NONE(t->closed_with_error)) {
     r.writing = false;
@@ -1298,6 +1385,13 @@ static void perform_stream_op_locked(void* stream_op,
     t->num_messages_in_next_write++;
     GRPC_STATS_INC_HTTP2_SEND_MESSAGE_SIZE(
         op->payload->send_message.send_message->Length());
+    if (t->write_coalescing_window > grpc_core::Duration::Zero()) {
+      t->write_coalescing_pending_bytes =
+          static_cast<uint32_t>(std::min<uint64_t>(
+              uint64_t{t->write_coalescing_pending_bytes} +
+                  op->payload->send_message.send_message->Length(),
+              t->write_coalescing_bytes));
+    }
     on_complete->next_data.scratch |= CLOSURE_BARRIER_MAY_COVER_WRITE;
     s->send_message_finished = add_closure_barrier(op->on_complete);
     const uint32_t flags = op_payload->send_message.flags;
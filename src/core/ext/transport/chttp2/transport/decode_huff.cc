@@ -284,4 +284,688 @@ const uint8_t HuffDecoderCommon::table29_0_inner_[9] = {
     0x03, 0x0b, 0x13, 0x1b, 0x23, 0x2b, 0x33, 0x3c, 0x44};
 const uint8_t HuffDecoderCommon::table29_0_outer_[16] = {
     0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 8};
+const uint32_t HuffDecoderCommon::fast_ops_[4096] = {
+    0x002a3030, 0x002a3030, 0x002a3030, 0x002a3030, 0x002a3130, 0x002a3130,
+    0x002a3130, 0x002a3130, 0x002a3230, 0x002a3230, 0x002a3230, 0x002a3230,
+    0x002a6130, 0x002a6130, 0x002a6130, 0x002a6130, 0x002a6330, 0x002a6330,
+    0x002a6330, 0x002a6330, 0x002a6530, 0x002a6530, 0x002a6530, 0x002a6530,
+    0x002a6930, 0x002a6930, 0x002a6930, 0x002a6930, 0x002a6f30, 0x002a6f30,
+    0x002a6f30, 0x002a6f30, 0x002a7330, 0x002a7330, 0x002a7330, 0x002a7330,
+    0x002a7430, 0x002a7430, 0x002a7430, 0x002a7430, 0x002e2030, 0x002e2030,
+    0x002e2530, 0x002e2530, 0x002e2d30, 0x002e2d30, 0x002e2e30, 0x002e2e30,
+    0x002e2f30, 0x002e2f30, 0x002e3330, 0x002e3330, 0x002e3430, 0x002e3430,
+    0x002e3530, 0x002e3530, 0x002e3630, 0x002e3630, 0x002e3730, 0x002e3730,
+    0x002e3830, 0x002e3830, 0x002e3930, 0x002e3930, 0x002e3d30, 0x002e3d30,
+    0x002e4130, 0x002e4130, 0x002e5f30, 0x002e5f30, 0x002e6230, 0x002e6230,
+    0x002e6430, 0x002e6430, 0x002e6630, 0x002e6630, 0x002e6730, 0x002e6730,
+    0x002e6830, 0x002e6830, 0x002e6c30, 0x002e6c30, 0x002e6d30, 0x002e6d30,
+    0x002e6e30, 0x002e6e30, 0x002e7030, 0x002e7030, 0x002e7230, 0x002e7230,
+    0x002e7530, 0x002e7530, 0x00323a30, 0x00324230, 0x00324330, 0x00324430,
+    0x00324530, 0x00324630, 0x00324730, 0x00324830, 0x00324930, 0x00324a30,
+    0x00324b30, 0x00324c30, 0x00324d30, 0x00324e30, 0x00324f30, 0x00325030,
+    0x00325130, 0x00325230, 0x00325330, 0x00325430, 0x00325530, 0x00325630,
+    0x00325730, 0x00325930, 0x00326a30, 0x00326b30, 0x00327130, 0x00327630,
+    0x00327730, 0x00327830, 0x00327930, 0x00327a30, 0x00150030, 0x00150030,
+    0x00150030, 0x00150030, 0x002a3031, 0x002a3031, 0x002a3031, 0x002a3031,
+    0x002a3131, 0x002a3131, 0x002a3131, 0x002a3131, 0x002a3231, 0x002a3231,
+    0x002a3231, 0x002a3231, 0x002a6131, 0x002a6131, 0x002a6131, 0x002a6131,
+    0x002a6331, 0x002a6331, 0x002a6331, 0x002a6331, 0x002a6531, 0x002a6531,
+    0x002a6531, 0x002a6531, 0x002a6931, 0x002a6931, 0x002a6931, 0x002a6931,
+    0x002a6f31, 0x002a6f31, 0x002a6f31, 0x002a6f31, 0x002a7331, 0x002a7331,
+    0x002a7331, 0x002a7331, 0x002a7431, 0x002a7431, 0x002a7431, 0x002a7431,
+    0x002e2031, 0x002e2031, 0x002e2531, 0x002e2531, 0x002e2d31, 0x002e2d31,
+    0x002e2e31, 0x002e2e31, 0x002e2f31, 0x002e2f31, 0x002e3331, 0x002e3331,
+    0x002e3431, 0x002e3431, 0x002e3531, 0x002e3531, 0x002e3631, 0x002e3631,
+    0x002e3731, 0x002e3731, 0x002e3831, 0x002e3831, 0x002e3931, 0x002e3931,
+    0x002e3d31, 0x002e3d31, 0x002e4131, 0x002e4131, 0x002e5f31, 0x002e5f31,
+    0x002e6231, 0x002e6231, 0x002e6431, 0x002e6431, 0x002e6631, 0x002e6631,
+    0x002e6731, 0x002e6731, 0x002e6831, 0x002e6831, 0x002e6c31, 0x002e6c31,
+    0x002e6d31, 0x002e6d31, 0x002e6e31, 0x002e6e31, 0x002e7031, 0x002e7031,
+    0x002e7231, 0x002e7231, 0x002e7531, 0x002e7531, 0x00323a31, 0x00324231,
+    0x00324331, 0x00324431, 0x00324531, 0x00324631, 0x00324731, 0x00324831,
+    0x00324931, 0x00324a31, 0x00324b31, 0x00324c31, 0x00324d31, 0x00324e31,
+    0x00324f31, 0x00325031, 0x00325131, 0x00325231, 0x00325331, 0x00325431,
+    0x00325531, 0x00325631, 0x00325731, 0x00325931, 0x00326a31, 0x00326b31,
+    0x00327131, 0x00327631, 0x00327731, 0x00327831, 0x00327931, 0x00327a31,
+    0x00150031, 0x00150031, 0x00150031, 0x00150031, 0x002a3032, 0x002a3032,
+    0x002a3032, 0x002a3032, 0x002a3132, 0x002a3132, 0x002a3132, 0x002a3132,
+    0x002a3232, 0x002a3232, 0x002a3232, 0x002a3232, 0x002a6132, 0x002a6132,
+    0x002a6132, 0x002a6132, 0x002a6332, 0x002a6332, 0x002a6332, 0x002a6332,
+    0x002a6532, 0x002a6532, 0x002a6532, 0x002a6532, 0x002a6932, 0x002a6932,
+    0x002a6932, 0x002a6932, 0x002a6f32, 0x002a6f32, 0x002a6f32, 0x002a6f32,
+    0x002a7332, 0x002a7332, 0x002a7332, 0x002a7332, 0x002a7432, 0x002a7432,
+    0x002a7432, 0x002a7432, 0x002e2032, 0x002e2032, 0x002e2532, 0x002e2532,
+    0x002e2d32, 0x002e2d32, 0x002e2e32, 0x002e2e32, 0x002e2f32, 0x002e2f32,
+    0x002e3332, 0x002e3332, 0x002e3432, 0x002e3432, 0x002e3532, 0x002e3532,
+    0x002e3632, 0x002e3632, 0x002e3732, 0x002e3732, 0x002e3832, 0x002e3832,
+    0x002e3932, 0x002e3932, 0x002e3d32, 0x002e3d32, 0x002e4132, 0x002e4132,
+    0x002e5f32, 0x002e5f32, 0x002e6232, 0x002e6232, 0x002e6432, 0x002e6432,
+    0x002e6632, 0x002e6632, 0x002e6732, 0x002e6732, 0x002e6832, 0x002e6832,
+    0x002e6c32, 0x002e6c32, 0x002e6d32, 0x002e6d32, 0x002e6e32, 0x002e6e32,
+    0x002e7032, 0x002e7032, 0x002e7232, 0x002e7232, 0x002e7532, 0x002e7532,
+    0x00323a32, 0x00324232, 0x00324332, 0x00324432, 0x00324532, 0x00324632,
+    0x00324732, 0x00324832, 0x00324932, 0x00324a32, 0x00324b32, 0x00324c32,
+    0x00324d32, 0x00324e32, 0x00324f32, 0x00325032, 0x00325132, 0x00325232,
+    0x00325332, 0x00325432, 0x00325532, 0x00325632, 0x00325732, 0x00325932,
+    0x00326a32, 0x00326b32, 0x00327132, 0x00327632, 0x00327732, 0x00327832,
+    0x00327932, 0x00327a32, 0x00150032, 0x00150032, 0x00150032, 0x00150032,
+    0x002a3061, 0x002a3061, 0x002a3061, 0x002a3061, 0x002a3161, 0x002a3161,
+    0x002a3161, 0x002a3161, 0x002a3261, 0x002a3261, 0x002a3261, 0x002a3261,
+    0x002a6161, 0x002a6161, 0x002a6161, 0x002a6161, 0x002a6361, 0x002a6361,
+    0x002a6361, 0x002a6361, 0x002a6561, 0x002a6561, 0x002a6561, 0x002a6561,
+    0x002a6961, 0x002a6961, 0x002a6961, 0x002a6961, 0x002a6f61, 0x002a6f61,
+    0x002a6f61, 0x002a6f61, 0x002a7361, 0x002a7361, 0x002a7361, 0x002a7361,
+    0x002a7461, 0x002a7461, 0x002a7461, 0x002a7461, 0x002e2061, 0x002e2061,
+    0x002e2561, 0x002e2561, 0x002e2d61, 0x002e2d61, 0x002e2e61, 0x002e2e61,
+    0x002e2f61, 0x002e2f61, 0x002e3361, 0x002e3361, 0x002e3461, 0x002e3461,
+    0x002e3561, 0x002e3561, 0x002e3661, 0x002e3661, 0x002e3761, 0x002e3761,
+    0x002e3861, 0x002e3861, 0x002e3961, 0x002e3961, 0x002e3d61, 0x002e3d61,
+    0x002e4161, 0x002e4161, 0x002e5f61, 0x002e5f61, 0x002e6261, 0x002e6261,
+    0x002e6461, 0x002e6461, 0x002e6661, 0x002e6661, 0x002e6761, 0x002e6761,
+    0x002e6861, 0x002e6861, 0x002e6c61, 0x002e6c61, 0x002e6d61, 0x002e6d61,
+    0x002e6e61, 0x002e6e61, 0x002e7061, 0x002e7061, 0x002e7261, 0x002e7261,
+    0x002e7561, 0x002e7561, 0x00323a61, 0x00324261, 0x00324361, 0x00324461,
+    0x00324561, 0x00324661, 0x00324761, 0x00324861, 0x00324961, 0x00324a61,
+    0x00324b61, 0x00324c61, 0x00324d61, 0x00324e61, 0x00324f61, 0x00325061,
+    0x00325161, 0x00325261, 0x00325361, 0x00325461, 0x00325561, 0x00325661,
+    0x00325761, 0x00325961, 0x00326a61, 0x00326b61, 0x00327161, 0x00327661,
+    0x00327761, 0x00327861, 0x00327961, 0x00327a61, 0x00150061, 0x00150061,
+    0x00150061, 0x00150061, 0x002a3063, 0x002a3063, 0x002a3063, 0x002a3063,
+    0x002a3163, 0x002a3163, 0x002a3163, 0x002a3163, 0x002a3263, 0x002a3263,
+    0x002a3263, 0x002a3263, 0x002a6163, 0x002a6163, 0x002a6163, 0x002a6163,
+    0x002a6363, 0x002a6363, 0x002a6363, 0x002a6363, 0x002a6563, 0x002a6563,
+    0x002a6563, 0x002a6563, 0x002a6963, 0x002a6963, 0x002a6963, 0x002a6963,
+    0x002a6f63, 0x002a6f63, 0x002a6f63, 0x002a6f63, 0x002a7363, 0x002a7363,
+    0x002a7363, 0x002a7363, 0x002a7463, 0x002a7463, 0x002a7463, 0x002a7463,
+    0x002e2063, 0x002e2063, 0x002e2563, 0x002e2563, 0x002e2d63, 0x002e2d63,
+    0x002e2e63, 0x002e2e63, 0x002e2f63, 0x002e2f63, 0x002e3363, 0x002e3363,
+    0x002e3463, 0x002e3463, 0x002e3563, 0x002e3563, 0x002e3663, 0x002e3663,
+    0x002e3763, 0x002e3763, 0x002e3863, 0x002e3863, 0x002e3963, 0x002e3963,
+    0x002e3d63, 0x002e3d63, 0x002e4163, 0x002e4163, 0x002e5f63, 0x002e5f63,
+    0x002e6263, 0x002e6263, 0x002e6463, 0x002e6463, 0x002e6663, 0x002e6663,
+    0x002e6763, 0x002e6763, 0x002e6863, 0x002e6863, 0x002e6c63, 0x002e6c63,
+    0x002e6d63, 0x002e6d63, 0x002e6e63, 0x002e6e63, 0x002e7063, 0x002e7063,
+    0x002e7263, 0x002e7263, 0x002e7563, 0x002e7563, 0x00323a63, 0x00324263,
+    0x00324363, 0x00324463, 0x00324563, 0x00324663, 0x00324763, 0x00324863,
+    0x00324963, 0x00324a63, 0x00324b63, 0x00324c63, 0x00324d63, 0x00324e63,
+    0x00324f63, 0x00325063, 0x00325163, 0x00325263, 0x00325363, 0x00325463,
+    0x00325563, 0x00325663, 0x00325763, 0x00325963, 0x00326a63, 0x00326b63,
+    0x00327163, 0x00327663, 0x00327763, 0x00327863, 0x00327963, 0x00327a63,
+    0x00150063, 0x00150063, 0x00150063, 0x00150063, 0x002a3065, 0x002a3065,
+    0x002a3065, 0x002a3065, 0x002a3165, 0x002a3165, 0x002a3165, 0x002a3165,
+    0x002a3265, 0x002a3265, 0x002a3265, 0x002a3265, 0x002a6165, 0x002a6165,
+    0x002a6165, 0x002a6165, 0x002a6365, 0x002a6365, 0x002a6365, 0x002a6365,
+    0x002a6565, 0x002a6565, 0x002a6565, 0x002a6565, 0x002a6965, 0x002a6965,
+    0x002a6965, 0x002a6965, 0x002a6f65, 0x002a6f65, 0x002a6f65, 0x002a6f65,
+    0x002a7365, 0x002a7365, 0x002a7365, 0x002a7365, 0x002a7465, 0x002a7465,
+    0x002a7465, 0x002a7465, 0x002e2065, 0x002e2065, 0x002e2565, 0x002e2565,
+    0x002e2d65, 0x002e2d65, 0x002e2e65, 0x002e2e65, 0x002e2f65, 0x002e2f65,
+    0x002e3365, 0x002e3365, 0x002e3465, 0x002e3465, 0x002e3565, 0x002e3565,
+    0x002e3665, 0x002e3665, 0x002e3765, 0x002e3765, 0x002e3865, 0x002e3865,
+    0x002e3965, 0x002e3965, 0x002e3d65, 0x002e3d65, 0x002e4165, 0x002e4165,
+    0x002e5f65, 0x002e5f65, 0x002e6265, 0x002e6265, 0x002e6465, 0x002e6465,
+    0x002e6665, 0x002e6665, 0x002e6765, 0x002e6765, 0x002e6865, 0x002e6865,
+    0x002e6c65, 0x002e6c65, 0x002e6d65, 0x002e6d65, 0x002e6e65, 0x002e6e65,
+    0x002e7065, 0x002e7065, 0x002e7265, 0x002e7265, 0x002e7565, 0x002e7565,
+    0x00323a65, 0x00324265, 0x00324365, 0x00324465, 0x00324565, 0x00324665,
+    0x00324765, 0x00324865, 0x00324965, 0x00324a65, 0x00324b65, 0x00324c65,
+    0x00324d65, 0x00324e65, 0x00324f65, 0x00325065, 0x00325165, 0x00325265,
+    0x00325365, 0x00325465, 0x00325565, 0x00325665, 0x00325765, 0x00325965,
+    0x00326a65, 0x00326b65, 0x00327165, 0x00327665, 0x00327765, 0x00327865,
+    0x00327965, 0x00327a65, 0x00150065, 0x00150065, 0x00150065, 0x00150065,
+    0x002a3069, 0x002a3069, 0x002a3069, 0x002a3069, 0x002a3169, 0x002a3169,
+    0x002a3169, 0x002a3169, 0x002a3269, 0x002a3269, 0x002a3269, 0x002a3269,
+    0x002a6169, 0x002a6169, 0x002a6169, 0x002a6169, 0x002a6369, 0x002a6369,
+    0x002a6369, 0x002a6369, 0x002a6569, 0x002a6569, 0x002a6569, 0x002a6569,
+    0x002a6969, 0x002a6969, 0x002a6969, 0x002a6969, 0x002a6f69, 0x002a6f69,
+    0x002a6f69, 0x002a6f69, 0x002a7369, 0x002a7369, 0x002a7369, 0x002a7369,
+    0x002a7469, 0x002a7469, 0x002a7469, 0x002a7469, 0x002e2069, 0x002e2069,
+    0x002e2569, 0x002e2569, 0x002e2d69, 0x002e2d69, 0x002e2e69, 0x002e2e69,
+    0x002e2f69, 0x002e2f69, 0x002e3369, 0x002e3369, 0x002e3469, 0x002e3469,
+    0x002e3569, 0x002e3569, 0x002e3669, 0x002e3669, 0x002e3769, 0x002e3769,
+    0x002e3869, 0x002e3869, 0x002e3969, 0x002e3969, 0x002e3d69, 0x002e3d69,
+    0x002e4169, 0x002e4169, 0x002e5f69, 0x002e5f69, 0x002e6269, 0x002e6269,
+    0x002e6469, 0x002e6469, 0x002e6669, 0x002e6669, 0x002e6769, 0x002e6769,
+    0x002e6869, 0x002e6869, 0x002e6c69, 0x002e6c69, 0x002e6d69, 0x002e6d69,
+    0x002e6e69, 0x002e6e69, 0x002e7069, 0x002e7069, 0x002e7269, 0x002e7269,
+    0x002e7569, 0x002e7569, 0x00323a69, 0x00324269, 0x00324369, 0x00324469,
+    0x00324569, 0x00324669, 0x00324769, 0x00324869, 0x00324969, 0x00324a69,
+    0x00324b69, 0x00324c69, 0x00324d69, 0x00324e69, 0x00324f69, 0x00325069,
+    0x00325169, 0x00325269, 0x00325369, 0x00325469, 0x00325569, 0x00325669,
+    0x00325769, 0x00325969, 0x00326a69, 0x00326b69, 0x00327169, 0x00327669,
+    0x00327769, 0x00327869, 0x00327969, 0x00327a69, 0x00150069, 0x00150069,
+    0x00150069, 0x00150069, 0x002a306f, 0x002a306f, 0x002a306f, 0x002a306f,
+    0x002a316f, 0x002a316f, 0x002a316f, 0x002a316f, 0x002a326f, 0x002a326f,
+    0x002a326f, 0x002a326f, 0x002a616f, 0x002a616f, 0x002a616f, 0x002a616f,
+    0x002a636f, 0x002a636f, 0x002a636f, 0x002a636f, 0x002a656f, 0x002a656f,
+    0x002a656f, 0x002a656f, 0x002a696f, 0x002a696f, 0x002a696f, 0x002a696f,
+    0x002a6f6f, 0x002a6f6f, 0x002a6f6f, 0x002a6f6f, 0x002a736f, 0x002a736f,
+    0x002a736f, 0x002a736f, 0x002a746f, 0x002a746f, 0x002a746f, 0x002a746f,
+    0x002e206f, 0x002e206f, 0x002e256f, 0x002e256f, 0x002e2d6f, 0x002e2d6f,
+    0x002e2e6f, 0x002e2e6f, 0x002e2f6f, 0x002e2f6f, 0x002e336f, 0x002e336f,
+    0x002e346f, 0x002e346f, 0x002e356f, 0x002e356f, 0x002e366f, 0x002e366f,
+    0x002e376f, 0x002e376f, 0x002e386f, 0x002e386f, 0x002e396f, 0x002e396f,
+    0x002e3d6f, 0x002e3d6f, 0x002e416f, 0x002e416f, 0x002e5f6f, 0x002e5f6f,
+    0x002e626f, 0x002e626f, 0x002e646f, 0x002e646f, 0x002e666f, 0x002e666f,
+    0x002e676f, 0x002e676f, 0x002e686f, 0x002e686f, 0x002e6c6f, 0x002e6c6f,
+    0x002e6d6f, 0x002e6d6f, 0x002e6e6f, 0x002e6e6f, 0x002e706f, 0x002e706f,
+    0x002e726f, 0x002e726f, 0x002e756f, 0x002e756f, 0x00323a6f, 0x0032426f,
+    0x0032436f, 0x0032446f, 0x0032456f, 0x0032466f, 0x0032476f, 0x0032486f,
+    0x0032496f, 0x00324a6f, 0x00324b6f, 0x00324c6f, 0x00324d6f, 0x00324e6f,
+    0x00324f6f, 0x0032506f, 0x0032516f, 0x0032526f, 0x0032536f, 0x0032546f,
+    0x0032556f, 0x0032566f, 0x0032576f, 0x0032596f, 0x00326a6f, 0x00326b6f,
+    0x0032716f, 0x0032766f, 0x0032776f, 0x0032786f, 0x0032796f, 0x00327a6f,
+    0x0015006f, 0x0015006f, 0x0015006f, 0x0015006f, 0x002a3073, 0x002a3073,
+    0x002a3073, 0x002a3073, 0x002a3173, 0x002a3173, 0x002a3173, 0x002a3173,
+    0x002a3273, 0x002a3273, 0x002a3273, 0x002a3273, 0x002a6173, 0x002a6173,
+    0x002a6173, 0x002a6173, 0x002a6373, 0x002a6373, 0x002a6373, 0x002a6373,
+    0x002a6573, 0x002a6573, 0x002a6573, 0x002a6573, 0x002a6973, 0x002a6973,
+    0x002a6973, 0x002a6973, 0x002a6f73, 0x002a6f73, 0x002a6f73, 0x002a6f73,
+    0x002a7373, 0x002a7373, 0x002a7373, 0x002a7373, 0x002a7473, 0x002a7473,
+    0x002a7473, 0x002a7473, 0x002e2073, 0x002e2073, 0x002e2573, 0x002e2573,
+    0x002e2d73, 0x002e2d73, 0x002e2e73, 0x002e2e73, 0x002e2f73, 0x002e2f73,
+    0x002e3373, 0x002e3373, 0x002e3473, 0x002e3473, 0x002e3573, 0x002e3573,
+    0x002e3673, 0x002e3673, 0x002e3773, 0x002e3773, 0x002e3873, 0x002e3873,
+    0x002e3973, 0x002e3973, 0x002e3d73, 0x002e3d73, 0x002e4173, 0x002e4173,
+    0x002e5f73, 0x002e5f73, 0x002e6273, 0x002e6273, 0x002e6473, 0x002e6473,
+    0x002e6673, 0x002e6673, 0x002e6773, 0x002e6773, 0x002e6873, 0x002e6873,
+    0x002e6c73, 0x002e6c73, 0x002e6d73, 0x002e6d73, 0x002e6e73, 0x002e6e73,
+    0x002e7073, 0x002e7073, 0x002e7273, 0x002e7273, 0x002e7573, 0x002e7573,
+    0x00323a73, 0x00324273, 0x00324373, 0x00324473, 0x00324573, 0x00324673,
+    0x00324773, 0x00324873, 0x00324973, 0x00324a73, 0x00324b73, 0x00324c73,
+    0x00324d73, 0x00324e73, 0x00324f73, 0x00325073, 0x00325173, 0x00325273,
+    0x00325373, 0x00325473, 0x00325573, 0x00325673, 0x00325773, 0x00325973,
+    0x00326a73, 0x00326b73, 0x00327173, 0x00327673, 0x00327773, 0x00327873,
+    0x00327973, 0x00327a73, 0x00150073, 0x00150073, 0x00150073, 0x00150073,
+    0x002a3074, 0x002a3074, 0x002a3074, 0x002a3074, 0x002a3174, 0x002a3174,
+    0x002a3174, 0x002a3174, 0x002a3274, 0x002a3274, 0x002a3274, 0x002a3274,
+    0x002a6174, 0x002a6174, 0x002a6174, 0x002a6174, 0x002a6374, 0x002a6374,
+    0x002a6374, 0x002a6374, 0x002a6574, 0x002a6574, 0x002a6574, 0x002a6574,
+    0x002a6974, 0x002a6974, 0x002a6974, 0x002a6974, 0x002a6f74, 0x002a6f74,
+    0x002a6f74, 0x002a6f74, 0x002a7374, 0x002a7374, 0x002a7374, 0x002a7374,
+    0x002a7474, 0x002a7474, 0x002a7474, 0x002a7474, 0x002e2074, 0x002e2074,
+    0x002e2574, 0x002e2574, 0x002e2d74, 0x002e2d74, 0x002e2e74, 0x002e2e74,
+    0x002e2f74, 0x002e2f74, 0x002e3374, 0x002e3374, 0x002e3474, 0x002e3474,
+    0x002e3574, 0x002e3574, 0x002e3674, 0x002e3674, 0x002e3774, 0x002e3774,
+    0x002e3874, 0x002e3874, 0x002e3974, 0x002e3974, 0x002e3d74, 0x002e3d74,
+    0x002e4174, 0x002e4174, 0x002e5f74, 0x002e5f74, 0x002e6274, 0x002e6274,
+    0x002e6474, 0x002e6474, 0x002e6674, 0x002e6674, 0x002e6774, 0x002e6774,
+    0x002e6874, 0x002e6874, 0x002e6c74, 0x002e6c74, 0x002e6d74, 0x002e6d74,
+    0x002e6e74, 0x002e6e74, 0x002e7074, 0x002e7074, 0x002e7274, 0x002e7274,
+    0x002e7574, 0x002e7574, 0x00323a74, 0x00324274, 0x00324374, 0x00324474,
+    0x00324574, 0x00324674, 0x00324774, 0x00324874, 0x00324974, 0x00324a74,
+    0x00324b74, 0x00324c74, 0x00324d74, 0x00324e74, 0x00324f74, 0x00325074,
+    0x00325174, 0x00325274, 0x00325374, 0x00325474, 0x00325574, 0x00325674,
+    0x00325774, 0x00325974, 0x00326a74, 0x00326b74, 0x00327174, 0x00327674,
+    0x00327774, 0x00327874, 0x00327974, 0x00327a74, 0x00150074, 0x00150074,
+    0x00150074, 0x00150074, 0x002e3020, 0x002e3020, 0x002e3120, 0x002e3120,
+    0x002e3220, 0x002e3220, 0x002e6120, 0x002e6120, 0x002e6320, 0x002e6320,
+    0x002e6520, 0x002e6520, 0x002e6920, 0x002e6920, 0x002e6f20, 0x002e6f20,
+    0x002e7320, 0x002e7320, 0x002e7420, 0x002e7420, 0x00322020, 0x00322520,
+    0x00322d20, 0x00322e20, 0x00322f20, 0x00323320, 0x00323420, 0x00323520,
+    0x00323620, 0x00323720, 0x00323820, 0x00323920, 0x00323d20, 0x00324120,
+    0x00325f20, 0x00326220, 0x00326420, 0x00326620, 0x00326720, 0x00326820,
+    0x00326c20, 0x00326d20, 0x00326e20, 0x00327020, 0x00327220, 0x00327520,
+    0x00190020, 0x00190020, 0x00190020, 0x00190020, 0x00190020, 0x00190020,
+    0x00190020, 0x00190020, 0x00190020, 0x00190020, 0x00190020, 0x00190020,
+    0x00190020, 0x00190020, 0x00190020, 0x00190020, 0x00190020, 0x00190020,
+    0x002e3025, 0x002e3025, 0x002e3125, 0x002e3125, 0x002e3225, 0x002e3225,
+    0x002e6125, 0x002e6125, 0x002e6325, 0x002e6325, 0x002e6525, 0x002e6525,
+    0x002e6925, 0x002e6925, 0x002e6f25, 0x002e6f25, 0x002e7325, 0x002e7325,
+    0x002e7425, 0x002e7425, 0x00322025, 0x00322525, 0x00322d25, 0x00322e25,
+    0x00322f25, 0x00323325, 0x00323425, 0x00323525, 0x00323625, 0x00323725,
+    0x00323825, 0x00323925, 0x00323d25, 0x00324125, 0x00325f25, 0x00326225,
+    0x00326425, 0x00326625, 0x00326725, 0x00326825, 0x00326c25, 0x00326d25,
+    0x00326e25, 0x00327025, 0x00327225, 0x00327525, 0x00190025, 0x00190025,
+    0x00190025, 0x00190025, 0x00190025, 0x00190025, 0x00190025, 0x00190025,
+    0x00190025, 0x00190025, 0x00190025, 0x00190025, 0x00190025, 0x00190025,
+    0x00190025, 0x00190025, 0x00190025, 0x00190025, 0x002e302d, 0x002e302d,
+    0x002e312d, 0x002e312d, 0x002e322d, 0x002e322d, 0x002e612d, 0x002e612d,
+    0x002e632d, 0x002e632d, 0x002e652d, 0x002e652d, 0x002e692d, 0x002e692d,
+    0x002e6f2d, 0x002e6f2d, 0x002e732d, 0x002e732d, 0x002e742d, 0x002e742d,
+    0x0032202d, 0x0032252d, 0x00322d2d, 0x00322e2d, 0x00322f2d, 0x0032332d,
+    0x0032342d, 0x0032352d, 0x0032362d, 0x0032372d, 0x0032382d, 0x0032392d,
+    0x00323d2d, 0x0032412d, 0x00325f2d, 0x0032622d, 0x0032642d, 0x0032662d,
+    0x0032672d, 0x0032682d, 0x00326c2d, 0x00326d2d, 0x00326e2d, 0x0032702d,
+    0x0032722d, 0x0032752d, 0x0019002d, 0x0019002d, 0x0019002d, 0x0019002d,
+    0x0019002d, 0x0019002d, 0x0019002d, 0x0019002d, 0x0019002d, 0x0019002d,
+    0x0019002d, 0x0019002d, 0x0019002d, 0x0019002d, 0x0019002d, 0x0019002d,
+    0x0019002d, 0x0019002d, 0x002e302e, 0x002e302e, 0x002e312e, 0x002e312e,
+    0x002e322e, 0x002e322e, 0x002e612e, 0x002e612e, 0x002e632e, 0x002e632e,
+    0x002e652e, 0x002e652e, 0x002e692e, 0x002e692e, 0x002e6f2e, 0x002e6f2e,
+    0x002e732e, 0x002e732e, 0x002e742e, 0x002e742e, 0x0032202e, 0x0032252e,
+    0x00322d2e, 0x00322e2e, 0x00322f2e, 0x0032332e, 0x0032342e, 0x0032352e,
+    0x0032362e, 0x0032372e, 0x0032382e, 0x0032392e, 0x00323d2e, 0x0032412e,
+    0x00325f2e, 0x0032622e, 0x0032642e, 0x0032662e, 0x0032672e, 0x0032682e,
+    0x00326c2e, 0x00326d2e, 0x00326e2e, 0x0032702e, 0x0032722e, 0x0032752e,
+    0x0019002e, 0x0019002e, 0x0019002e, 0x0019002e, 0x0019002e, 0x0019002e,
+    0x0019002e, 0x0019002e, 0x0019002e, 0x0019002e, 0x0019002e, 0x0019002e,
+    0x0019002e, 0x0019002e, 0x0019002e, 0x0019002e, 0x0019002e, 0x0019002e,
+    0x002e302f, 0x002e302f, 0x002e312f, 0x002e312f, 0x002e322f, 0x002e322f,
+    0x002e612f, 0x002e612f, 0x002e632f, 0x002e632f, 0x002e652f, 0x002e652f,
+    0x002e692f, 0x002e692f, 0x002e6f2f, 0x002e6f2f, 0x002e732f, 0x002e732f,
+    0x002e742f, 0x002e742f, 0x0032202f, 0x0032252f, 0x00322d2f, 0x00322e2f,
+    0x00322f2f, 0x0032332f, 0x0032342f, 0x0032352f, 0x0032362f, 0x0032372f,
+    0x0032382f, 0x0032392f, 0x00323d2f, 0x0032412f, 0x00325f2f, 0x0032622f,
+    0x0032642f, 0x0032662f, 0x0032672f, 0x0032682f, 0x00326c2f, 0x00326d2f,
+    0x00326e2f, 0x0032702f, 0x0032722f, 0x0032752f, 0x0019002f, 0x0019002f,
+    0x0019002f, 0x0019002f, 0x0019002f, 0x0019002f, 0x0019002f, 0x0019002f,
+    0x0019002f, 0x0019002f, 0x0019002f, 0x0019002f, 0x0019002f, 0x0019002f,
+    0x0019002f, 0x0019002f, 0x0019002f, 0x0019002f, 0x002e3033, 0x002e3033,
+    0x002e3133, 0x002e3133, 0x002e3233, 0x002e3233, 0x002e6133, 0x002e6133,
+    0x002e6333, 0x002e6333, 0x002e6533, 0x002e6533, 0x002e6933, 0x002e6933,
+    0x002e6f33, 0x002e6f33, 0x002e7333, 0x002e7333, 0x002e7433, 0x002e7433,
+    0x00322033, 0x00322533, 0x00322d33, 0x00322e33, 0x00322f33, 0x00323333,
+    0x00323433, 0x00323533, 0x00323633, 0x00323733, 0x00323833, 0x00323933,
+    0x00323d33, 0x00324133, 0x00325f33, 0x00326233, 0x00326433, 0x00326633,
+    0x00326733, 0x00326833, 0x00326c33, 0x00326d33, 0x00326e33, 0x00327033,
+    0x00327233, 0x00327533, 0x00190033, 0x00190033, 0x00190033, 0x00190033,
+    0x00190033, 0x00190033, 0x00190033, 0x00190033, 0x00190033, 0x00190033,
+    0x00190033, 0x00190033, 0x00190033, 0x00190033, 0x00190033, 0x00190033,
+    0x00190033, 0x00190033, 0x002e3034, 0x002e3034, 0x002e3134, 0x002e3134,
+    0x002e3234, 0x002e3234, 0x002e6134, 0x002e6134, 0x002e6334, 0x002e6334,
+    0x002e6534, 0x002e6534, 0x002e6934, 0x002e6934, 0x002e6f34, 0x002e6f34,
+    0x002e7334, 0x002e7334, 0x002e7434, 0x002e7434, 0x00322034, 0x00322534,
+    0x00322d34, 0x00322e34, 0x00322f34, 0x00323334, 0x00323434, 0x00323534,
+    0x00323634, 0x00323734, 0x00323834, 0x00323934, 0x00323d34, 0x00324134,
+    0x00325f34, 0x00326234, 0x00326434, 0x00326634, 0x00326734, 0x00326834,
+    0x00326c34, 0x00326d34, 0x00326e34, 0x00327034, 0x00327234, 0x00327534,
+    0x00190034, 0x00190034, 0x00190034, 0x00190034, 0x00190034, 0x00190034,
+    0x00190034, 0x00190034, 0x00190034, 0x00190034, 0x00190034, 0x00190034,
+    0x00190034, 0x00190034, 0x00190034, 0x00190034, 0x00190034, 0x00190034,
+    0x002e3035, 0x002e3035, 0x002e3135, 0x002e3135, 0x002e3235, 0x002e3235,
+    0x002e6135, 0x002e6135, 0x002e6335, 0x002e6335, 0x002e6535, 0x002e6535,
+    0x002e6935, 0x002e6935, 0x002e6f35, 0x002e6f35, 0x002e7335, 0x002e7335,
+    0x002e7435, 0x002e7435, 0x00322035, 0x00322535, 0x00322d35, 0x00322e35,
+    0x00322f35, 0x00323335, 0x00323435, 0x00323535, 0x00323635, 0x00323735,
+    0x00323835, 0x00323935, 0x00323d35, 0x00324135, 0x00325f35, 0x00326235,
+    0x00326435, 0x00326635, 0x00326735, 0x00326835, 0x00326c35, 0x00326d35,
+    0x00326e35, 0x00327035, 0x00327235, 0x00327535, 0x00190035, 0x00190035,
+    0x00190035, 0x00190035, 0x00190035, 0x00190035, 0x00190035, 0x00190035,
+    0x00190035, 0x00190035, 0x00190035, 0x00190035, 0x00190035, 0x00190035,
+    0x00190035, 0x00190035, 0x00190035, 0x00190035, 0x002e3036, 0x002e3036,
+    0x002e3136, 0x002e3136, 0x002e3236, 0x002e3236, 0x002e6136, 0x002e6136,
+    0x002e6336, 0x002e6336, 0x002e6536, 0x002e6536, 0x002e6936, 0x002e6936,
+    0x002e6f36, 0x002e6f36, 0x002e7336, 0x002e7336, 0x002e7436, 0x002e7436,
+    0x00322036, 0x00322536, 0x00322d36, 0x00322e36, 0x00322f36, 0x00323336,
+    0x00323436, 0x00323536, 0x00323636, 0x00323736, 0x00323836, 0x00323936,
+    0x00323d36, 0x00324136, 0x00325f36, 0x00326236, 0x00326436, 0x00326636,
+    0x00326736, 0x00326836, 0x00326c36, 0x00326d36, 0x00326e36, 0x00327036,
+    0x00327236, 0x00327536, 0x00190036, 0x00190036, 0x00190036, 0x00190036,
+    0x00190036, 0x00190036, 0x00190036, 0x00190036, 0x00190036, 0x00190036,
+    0x00190036, 0x00190036, 0x00190036, 0x00190036, 0x00190036, 0x00190036,
+    0x00190036, 0x00190036, 0x002e3037, 0x002e3037, 0x002e3137, 0x002e3137,
+    0x002e3237, 0x002e3237, 0x002e6137, 0x002e6137, 0x002e6337, 0x002e6337,
+    0x002e6537, 0x002e6537, 0x002e6937, 0x002e6937, 0x002e6f37, 0x002e6f37,
+    0x002e7337, 0x002e7337, 0x002e7437, 0x002e7437, 0x00322037, 0x00322537,
+    0x00322d37, 0x00322e37, 0x00322f37, 0x00323337, 0x00323437, 0x00323537,
+    0x00323637, 0x00323737, 0x00323837, 0x00323937, 0x00323d37, 0x00324137,
+    0x00325f37, 0x00326237, 0x00326437, 0x00326637, 0x00326737, 0x00326837,
+    0x00326c37, 0x00326d37, 0x00326e37, 0x00327037, 0x00327237, 0x00327537,
+    0x00190037, 0x00190037, 0x00190037, 0x00190037, 0x00190037, 0x00190037,
+    0x00190037, 0x00190037, 0x00190037, 0x00190037, 0x00190037, 0x00190037,
+    0x00190037, 0x00190037, 0x00190037, 0x00190037, 0x00190037, 0x00190037,
+    0x002e3038, 0x002e3038, 0x002e3138, 0x002e3138, 0x002e3238, 0x002e3238,
+    0x002e6138, 0x002e6138, 0x002e6338, 0x002e6338, 0x002e6538, 0x002e6538,
+    0x002e6938, 0x002e6938, 0x002e6f38, 0x002e6f38, 0x002e7338, 0x002e7338,
+    0x002e7438, 0x002e7438, 0x00322038, 0x00322538, 0x00322d38, 0x00322e38,
+    0x00322f38, 0x00323338, 0x00323438, 0x00323538, 0x00323638, 0x00323738,
+    0x00323838, 0x00323938, 0x00323d38, 0x00324138, 0x00325f38, 0x00326238,
+    0x00326438, 0x00326638, 0x00326738, 0x00326838, 0x00326c38, 0x00326d38,
+    0x00326e38, 0x00327038, 0x00327238, 0x00327538, 0x00190038, 0x00190038,
+    0x00190038, 0x00190038, 0x00190038, 0x00190038, 0x00190038, 0x00190038,
+    0x00190038, 0x00190038, 0x00190038, 0x00190038, 0x00190038, 0x00190038,
+    0x00190038, 0x00190038, 0x00190038, 0x00190038, 0x002e3039, 0x002e3039,
+    0x002e3139, 0x002e3139, 0x002e3239, 0x002e3239, 0x002e6139, 0x002e6139,
+    0x002e6339, 0x002e6339, 0x002e6539, 0x002e6539, 0x002e6939, 0x002e6939,
+    0x002e6f39, 0x002e6f39, 0x002e7339, 0x002e7339, 0x002e7439, 0x002e7439,
+    0x00322039, 0x00322539, 0x00322d39, 0x00322e39, 0x00322f39, 0x00323339,
+    0x00323439, 0x00323539, 0x00323639, 0x00323739, 0x00323839, 0x00323939,
+    0x00323d39, 0x00324139, 0x00325f39, 0x00326239, 0x00326439, 0x00326639,
+    0x00326739, 0x00326839, 0x00326c39, 0x00326d39, 0x00326e39, 0x00327039,
+    0x00327239, 0x00327539, 0x00190039, 0x00190039, 0x00190039, 0x00190039,
+    0x00190039, 0x00190039, 0x00190039, 0x00190039, 0x00190039, 0x00190039,
+    0x00190039, 0x00190039, 0x00190039, 0x00190039, 0x00190039, 0x00190039,
+    0x00190039, 0x00190039, 0x002e303d, 0x002e303d, 0x002e313d, 0x002e313d,
+    0x002e323d, 0x002e323d, 0x002e613d, 0x002e613d, 0x002e633d, 0x002e633d,
+    0x002e653d, 0x002e653d, 0x002e693d, 0x002e693d, 0x002e6f3d, 0x002e6f3d,
+    0x002e733d, 0x002e733d, 0x002e743d, 0x002e743d, 0x0032203d, 0x0032253d,
+    0x00322d3d, 0x00322e3d, 0x00322f3d, 0x0032333d, 0x0032343d, 0x0032353d,
+    0x0032363d, 0x0032373d, 0x0032383d, 0x0032393d, 0x00323d3d, 0x0032413d,
+    0x00325f3d, 0x0032623d, 0x0032643d, 0x0032663d, 0x0032673d, 0x0032683d,
+    0x00326c3d, 0x00326d3d, 0x00326e3d, 0x0032703d, 0x0032723d, 0x0032753d,
+    0x0019003d, 0x0019003d, 0x0019003d, 0x0019003d, 0x0019003d, 0x0019003d,
+    0x0019003d, 0x0019003d, 0x0019003d, 0x0019003d, 0x0019003d, 0x0019003d,
+    0x0019003d, 0x0019003d, 0x0019003d, 0x0019003d, 0x0019003d, 0x0019003d,
+    0x002e3041, 0x002e3041, 0x002e3141, 0x002e3141, 0x002e3241, 0x002e3241,
+    0x002e6141, 0x002e6141, 0x002e6341, 0x002e6341, 0x002e6541, 0x002e6541,
+    0x002e6941, 0x002e6941, 0x002e6f41, 0x002e6f41, 0x002e7341, 0x002e7341,
+    0x002e7441, 0x002e7441, 0x00322041, 0x00322541, 0x00322d41, 0x00322e41,
+    0x00322f41, 0x00323341, 0x00323441, 0x00323541, 0x00323641, 0x00323741,
+    0x00323841, 0x00323941, 0x00323d41, 0x00324141, 0x00325f41, 0x00326241,
+    0x00326441, 0x00326641, 0x00326741, 0x00326841, 0x00326c41, 0x00326d41,
+    0x00326e41, 0x00327041, 0x00327241, 0x00327541, 0x00190041, 0x00190041,
+    0x00190041, 0x00190041, 0x00190041, 0x00190041, 0x00190041, 0x00190041,
+    0x00190041, 0x00190041, 0x00190041, 0x00190041, 0x00190041, 0x00190041,
+    0x00190041, 0x00190041, 0x00190041, 0x00190041, 0x002e305f, 0x002e305f,
+    0x002e315f, 0x002e315f, 0x002e325f, 0x002e325f, 0x002e615f, 0x002e615f,
+    0x002e635f, 0x002e635f, 0x002e655f, 0x002e655f, 0x002e695f, 0x002e695f,
+    0x002e6f5f, 0x002e6f5f, 0x002e735f, 0x002e735f, 0x002e745f, 0x002e745f,
+    0x0032205f, 0x0032255f, 0x00322d5f, 0x00322e5f, 0x00322f5f, 0x0032335f,
+    0x0032345f, 0x0032355f, 0x0032365f, 0x0032375f, 0x0032385f, 0x0032395f,
+    0x00323d5f, 0x0032415f, 0x00325f5f, 0x0032625f, 0x0032645f, 0x0032665f,
+    0x0032675f, 0x0032685f, 0x00326c5f, 0x00326d5f, 0x00326e5f, 0x0032705f,
+    0x0032725f, 0x0032755f, 0x0019005f, 0x0019005f, 0x0019005f, 0x0019005f,
+    0x0019005f, 0x0019005f, 0x0019005f, 0x0019005f, 0x0019005f, 0x0019005f,
+    0x0019005f, 0x0019005f, 0x0019005f, 0x0019005f, 0x0019005f, 0x0019005f,
+    0x0019005f, 0x0019005f, 0x002e3062, 0x002e3062, 0x002e3162, 0x002e3162,
+    0x002e3262, 0x002e3262, 0x002e6162, 0x002e6162, 0x002e6362, 0x002e6362,
+    0x002e6562, 0x002e6562, 0x002e6962, 0x002e6962, 0x002e6f62, 0x002e6f62,
+    0x002e7362, 0x002e7362, 0x002e7462, 0x002e7462, 0x00322062, 0x00322562,
+    0x00322d62, 0x00322e62, 0x00322f62, 0x00323362, 0x00323462, 0x00323562,
+    0x00323662, 0x00323762, 0x00323862, 0x00323962, 0x00323d62, 0x00324162,
+    0x00325f62, 0x00326262, 0x00326462, 0x00326662, 0x00326762, 0x00326862,
+    0x00326c62, 0x00326d62, 0x00326e62, 0x00327062, 0x00327262, 0x00327562,
+    0x00190062, 0x00190062, 0x00190062, 0x00190062, 0x00190062, 0x00190062,
+    0x00190062, 0x00190062, 0x00190062, 0x00190062, 0x00190062, 0x00190062,
+    0x00190062, 0x00190062, 0x00190062, 0x00190062, 0x00190062, 0x00190062,
+    0x002e3064, 0x002e3064, 0x002e3164, 0x002e3164, 0x002e3264, 0x002e3264,
+    0x002e6164, 0x002e6164, 0x002e6364, 0x002e6364, 0x002e6564, 0x002e6564,
+    0x002e6964, 0x002e6964, 0x002e6f64, 0x002e6f64, 0x002e7364, 0x002e7364,
+    0x002e7464, 0x002e7464, 0x00322064, 0x00322564, 0x00322d64, 0x00322e64,
+    0x00322f64, 0x00323364, 0x00323464, 0x00323564, 0x00323664, 0x00323764,
+    0x00323864, 0x00323964, 0x00323d64, 0x00324164, 0x00325f64, 0x00326264,
+    0x00326464, 0x00326664, 0x00326764, 0x00326864, 0x00326c64, 0x00326d64,
+    0x00326e64, 0x00327064, 0x00327264, 0x00327564, 0x00190064, 0x00190064,
+    0x00190064, 0x00190064, 0x00190064, 0x00190064, 0x00190064, 0x00190064,
+    0x00190064, 0x00190064, 0x00190064, 0x00190064, 0x00190064, 0x00190064,
+    0x00190064, 0x00190064, 0x00190064, 0x00190064, 0x002e3066, 0x002e3066,
+    0x002e3166, 0x002e3166, 0x002e3266, 0x002e3266, 0x002e6166, 0x002e6166,
+    0x002e6366, 0x002e6366, 0x002e6566, 0x002e6566, 0x002e6966, 0x002e6966,
+    0x002e6f66, 0x002e6f66, 0x002e7366, 0x002e7366, 0x002e7466, 0x002e7466,
+    0x00322066, 0x00322566, 0x00322d66, 0x00322e66, 0x00322f66, 0x00323366,
+    0x00323466, 0x00323566, 0x00323666, 0x00323766, 0x00323866, 0x00323966,
+    0x00323d66, 0x00324166, 0x00325f66, 0x00326266, 0x00326466, 0x00326666,
+    0x00326766, 0x00326866, 0x00326c66, 0x00326d66, 0x00326e66, 0x00327066,
+    0x00327266, 0x00327566, 0x00190066, 0x00190066, 0x00190066, 0x00190066,
+    0x00190066, 0x00190066, 0x00190066, 0x00190066, 0x00190066, 0x00190066,
+    0x00190066, 0x00190066, 0x00190066, 0x00190066, 0x00190066, 0x00190066,
+    0x00190066, 0x00190066, 0x002e3067, 0x002e3067, 0x002e3167, 0x002e3167,
+    0x002e3267, 0x002e3267, 0x002e6167, 0x002e6167, 0x002e6367, 0x002e6367,
+    0x002e6567, 0x002e6567, 0x002e6967, 0x002e6967, 0x002e6f67, 0x002e6f67,
+    0x002e7367, 0x002e7367, 0x002e7467, 0x002e7467, 0x00322067, 0x00322567,
+    0x00322d67, 0x00322e67, 0x00322f67, 0x00323367, 0x00323467, 0x00323567,
+    0x00323667, 0x00323767, 0x00323867, 0x00323967, 0x00323d67, 0x00324167,
+    0x00325f67, 0x00326267, 0x00326467, 0x00326667, 0x00326767, 0x00326867,
+    0x00326c67, 0x00326d67, 0x00326e67, 0x00327067, 0x00327267, 0x00327567,
+    0x00190067, 0x00190067, 0x00190067, 0x00190067, 0x00190067, 0x00190067,
+    0x00190067, 0x00190067, 0x00190067, 0x00190067, 0x00190067, 0x00190067,
+    0x00190067, 0x00190067, 0x00190067, 0x00190067, 0x00190067, 0x00190067,
+    0x002e3068, 0x002e3068, 0x002e3168, 0x002e3168, 0x002e3268, 0x002e3268,
+    0x002e6168, 0x002e6168, 0x002e6368, 0x002e6368, 0x002e6568, 0x002e6568,
+    0x002e6968, 0x002e6968, 0x002e6f68, 0x002e6f68, 0x002e7368, 0x002e7368,
+    0x002e7468, 0x002e7468, 0x00322068, 0x00322568, 0x00322d68, 0x00322e68,
+    0x00322f68, 0x00323368, 0x00323468, 0x00323568, 0x00323668, 0x00323768,
+    0x00323868, 0x00323968, 0x00323d68, 0x00324168, 0x00325f68, 0x00326268,
+    0x00326468, 0x00326668, 0x00326768, 0x00326868, 0x00326c68, 0x00326d68,
+    0x00326e68, 0x00327068, 0x00327268, 0x00327568, 0x00190068, 0x00190068,
+    0x00190068, 0x00190068, 0x00190068, 0x00190068, 0x00190068, 0x00190068,
+    0x00190068, 0x00190068, 0x00190068, 0x00190068, 0x00190068, 0x00190068,
+    0x00190068, 0x00190068, 0x00190068, 0x00190068, 0x002e306c, 0x002e306c,
+    0x002e316c, 0x002e316c, 0x002e326c, 0x002e326c, 0x002e616c, 0x002e616c,
+    0x002e636c, 0x002e636c, 0x002e656c, 0x002e656c, 0x002e696c, 0x002e696c,
+    0x002e6f6c, 0x002e6f6c, 0x002e736c, 0x002e736c, 0x002e746c, 0x002e746c,
+    0x0032206c, 0x0032256c, 0x00322d6c, 0x00322e6c, 0x00322f6c, 0x0032336c,
+    0x0032346c, 0x0032356c, 0x0032366c, 0x0032376c, 0x0032386c, 0x0032396c,
+    0x00323d6c, 0x0032416c, 0x00325f6c, 0x0032626c, 0x0032646c, 0x0032666c,
+    0x0032676c, 0x0032686c, 0x00326c6c, 0x00326d6c, 0x00326e6c, 0x0032706c,
+    0x0032726c, 0x0032756c, 0x0019006c, 0x0019006c, 0x0019006c, 0x0019006c,
+    0x0019006c, 0x0019006c, 0x0019006c, 0x0019006c, 0x0019006c, 0x0019006c,
+    0x0019006c, 0x0019006c, 0x0019006c, 0x0019006c, 0x0019006c, 0x0019006c,
+    0x0019006c, 0x0019006c, 0x002e306d, 0x002e306d, 0x002e316d, 0x002e316d,
+    0x002e326d, 0x002e326d, 0x002e616d, 0x002e616d, 0x002e636d, 0x002e636d,
+    0x002e656d, 0x002e656d, 0x002e696d, 0x002e696d, 0x002e6f6d, 0x002e6f6d,
+    0x002e736d, 0x002e736d, 0x002e746d, 0x002e746d, 0x0032206d, 0x0032256d,
+    0x00322d6d, 0x00322e6d, 0x00322f6d, 0x0032336d, 0x0032346d, 0x0032356d,
+    0x0032366d, 0x0032376d, 0x0032386d, 0x0032396d, 0x00323d6d, 0x0032416d,
+    0x00325f6d, 0x0032626d, 0x0032646d, 0x0032666d, 0x0032676d, 0x0032686d,
+    0x00326c6d, 0x00326d6d, 0x00326e6d, 0x0032706d, 0x0032726d, 0x0032756d,
+    0x0019006d, 0x0019006d, 0x0019006d, 0x0019006d, 0x0019006d, 0x0019006d,
+    0x0019006d, 0x0019006d, 0x0019006d, 0x0019006d, 0x0019006d, 0x0019006d,
+    0x0019006d, 0x0019006d, 0x0019006d, 0x0019006d, 0x0019006d, 0x0019006d,
+    0x002e306e, 0x002e306e, 0x002e316e, 0x002e316e, 0x002e326e, 0x002e326e,
+    0x002e616e, 0x002e616e, 0x002e636e, 0x002e636e, 0x002e656e, 0x002e656e,
+    0x002e696e, 0x002e696e, 0x002e6f6e, 0x002e6f6e, 0x002e736e, 0x002e736e,
+    0x002e746e, 0x002e746e, 0x0032206e, 0x0032256e, 0x00322d6e, 0x00322e6e,
+    0x00322f6e, 0x0032336e, 0x0032346e, 0x0032356e, 0x0032366e, 0x0032376e,
+    0x0032386e, 0x0032396e, 0x00323d6e, 0x0032416e, 0x00325f6e, 0x0032626e,
+    0x0032646e, 0x0032666e, 0x0032676e, 0x0032686e, 0x00326c6e, 0x00326d6e,
+    0x00326e6e, 0x0032706e, 0x0032726e, 0x0032756e, 0x0019006e, 0x0019006e,
+    0x0019006e, 0x0019006e, 0x0019006e, 0x0019006e, 0x0019006e, 0x0019006e,
+    0x0019006e, 0x0019006e, 0x0019006e, 0x0019006e, 0x0019006e, 0x0019006e,
+    0x0019006e, 0x0019006e, 0x0019006e, 0x0019006e, 0x002e3070, 0x002e3070,
+    0x002e3170, 0x002e3170, 0x002e3270, 0x002e3270, 0x002e6170, 0x002e6170,
+    0x002e6370, 0x002e6370, 0x002e6570, 0x002e6570, 0x002e6970, 0x002e6970,
+    0x002e6f70, 0x002e6f70, 0x002e7370, 0x002e7370, 0x002e7470, 0x002e7470,
+    0x00322070, 0x00322570, 0x00322d70, 0x00322e70, 0x00322f70, 0x00323370,
+    0x00323470, 0x00323570, 0x00323670, 0x00323770, 0x00323870, 0x00323970,
+    0x00323d70, 0x00324170, 0x00325f70, 0x00326270, 0x00326470, 0x00326670,
+    0x00326770, 0x00326870, 0x00326c70, 0x00326d70, 0x00326e70, 0x00327070,
+    0x00327270, 0x00327570, 0x00190070, 0x00190070, 0x00190070, 0x00190070,
+    0x00190070, 0x00190070, 0x00190070, 0x00190070, 0x00190070, 0x00190070,
+    0x00190070, 0x00190070, 0x00190070, 0x00190070, 0x00190070, 0x00190070,
+    0x00190070, 0x00190070, 0x002e3072, 0x002e3072, 0x002e3172, 0x002e3172,
+    0x002e3272, 0x002e3272, 0x002e6172, 0x002e6172, 0x002e6372, 0x002e6372,
+    0x002e6572, 0x002e6572, 0x002e6972, 0x002e6972, 0x002e6f72, 0x002e6f72,
+    0x002e7372, 0x002e7372, 0x002e7472, 0x002e7472, 0x00322072, 0x00322572,
+    0x00322d72, 0x00322e72, 0x00322f72, 0x00323372, 0x00323472, 0x00323572,
+    0x00323672, 0x00323772, 0x00323872, 0x00323972, 0x00323d72, 0x00324172,
+    0x00325f72, 0x00326272, 0x00326472, 0x00326672, 0x00326772, 0x00326872,
+    0x00326c72, 0x00326d72, 0x00326e72, 0x00327072, 0x00327272, 0x00327572,
+    0x00190072, 0x00190072, 0x00190072, 0x00190072, 0x00190072, 0x00190072,
+    0x00190072, 0x00190072, 0x00190072, 0x00190072, 0x00190072, 0x00190072,
+    0x00190072, 0x00190072, 0x00190072, 0x00190072, 0x00190072, 0x00190072,
+    0x002e3075, 0x002e3075, 0x002e3175, 0x002e3175, 0x002e3275, 0x002e3275,
+    0x002e6175, 0x002e6175, 0x002e6375, 0x002e6375, 0x002e6575, 0x002e6575,
+    0x002e6975, 0x002e6975, 0x002e6f75, 0x002e6f75, 0x002e7375, 0x002e7375,
+    0x002e7475, 0x002e7475, 0x00322075, 0x00322575, 0x00322d75, 0x00322e75,
+    0x00322f75, 0x00323375, 0x00323475, 0x00323575, 0x00323675, 0x00323775,
+    0x00323875, 0x00323975, 0x00323d75, 0x00324175, 0x00325f75, 0x00326275,
+    0x00326475, 0x00326675, 0x00326775, 0x00326875, 0x00326c75, 0x00326d75,
+    0x00326e75, 0x00327075, 0x00327275, 0x00327575, 0x00190075, 0x00190075,
+    0x00190075, 0x00190075, 0x00190075, 0x00190075, 0x00190075, 0x00190075,
+    0x00190075, 0x00190075, 0x00190075, 0x00190075, 0x00190075, 0x00190075,
+    0x00190075, 0x00190075, 0x00190075, 0x00190075, 0x0032303a, 0x0032313a,
+    0x0032323a, 0x0032613a, 0x0032633a, 0x0032653a, 0x0032693a, 0x00326f3a,
+    0x0032733a, 0x0032743a, 0x001d003a, 0x001d003a, 0x001d003a, 0x001d003a,
+    0x001d003a, 0x001d003a, 0x001d003a, 0x001d003a, 0x001d003a, 0x001d003a,
+    0x001d003a, 0x001d003a, 0x001d003a, 0x001d003a, 0x001d003a, 0x001d003a,
+    0x001d003a, 0x001d003a, 0x001d003a, 0x001d003a, 0x001d003a, 0x001d003a,
+    0x00323042, 0x00323142, 0x00323242, 0x00326142, 0x00326342, 0x00326542,
+    0x00326942, 0x00326f42, 0x00327342, 0x00327442, 0x001d0042, 0x001d0042,
+    0x001d0042, 0x001d0042, 0x001d0042, 0x001d0042, 0x001d0042, 0x001d0042,
+    0x001d0042, 0x001d0042, 0x001d0042, 0x001d0042, 0x001d0042, 0x001d0042,
+    0x001d0042, 0x001d0042, 0x001d0042, 0x001d0042, 0x001d0042, 0x001d0042,
+    0x001d0042, 0x001d0042, 0x00323043, 0x00323143, 0x00323243, 0x00326143,
+    0x00326343, 0x00326543, 0x00326943, 0x00326f43, 0x00327343, 0x00327443,
+    0x001d0043, 0x001d0043, 0x001d0043, 0x001d0043, 0x001d0043, 0x001d0043,
+    0x001d0043, 0x001d0043, 0x001d0043, 0x001d0043, 0x001d0043, 0x001d0043,
+    0x001d0043, 0x001d0043, 0x001d0043, 0x001d0043, 0x001d0043, 0x001d0043,
+    0x001d0043, 0x001d0043, 0x001d0043, 0x001d0043, 0x00323044, 0x00323144,
+    0x00323244, 0x00326144, 0x00326344, 0x00326544, 0x00326944, 0x00326f44,
+    0x00327344, 0x00327444, 0x001d0044, 0x001d0044, 0x001d0044, 0x001d0044,
+    0x001d0044, 0x001d0044, 0x001d0044, 0x001d0044, 0x001d0044, 0x001d0044,
+    0x001d0044, 0x001d0044, 0x001d0044, 0x001d0044, 0x001d0044, 0x001d0044,
+    0x001d0044, 0x001d0044, 0x001d0044, 0x001d0044, 0x001d0044, 0x001d0044,
+    0x00323045, 0x00323145, 0x00323245, 0x00326145, 0x00326345, 0x00326545,
+    0x00326945, 0x00326f45, 0x00327345, 0x00327445, 0x001d0045, 0x001d0045,
+    0x001d0045, 0x001d0045, 0x001d0045, 0x001d0045, 0x001d0045, 0x001d0045,
+    0x001d0045, 0x001d0045, 0x001d0045, 0x001d0045, 0x001d0045, 0x001d0045,
+    0x001d0045, 0x001d0045, 0x001d0045, 0x001d0045, 0x001d0045, 0x001d0045,
+    0x001d0045, 0x001d0045, 0x00323046, 0x00323146, 0x00323246, 0x00326146,
+    0x00326346, 0x00326546, 0x00326946, 0x00326f46, 0x00327346, 0x00327446,
+    0x001d0046, 0x001d0046, 0x001d0046, 0x001d0046, 0x001d0046, 0x001d0046,
+    0x001d0046, 0x001d0046, 0x001d0046, 0x001d0046, 0x001d0046, 0x001d0046,
+    0x001d0046, 0x001d0046, 0x001d0046, 0x001d0046, 0x001d0046, 0x001d0046,
+    0x001d0046, 0x001d0046, 0x001d0046, 0x001d0046, 0x00323047, 0x00323147,
+    0x00323247, 0x00326147, 0x00326347, 0x00326547, 0x00326947, 0x00326f47,
+    0x00327347, 0x00327447, 0x001d0047, 0x001d0047, 0x001d0047, 0x001d0047,
+    0x001d0047, 0x001d0047, 0x001d0047, 0x001d0047, 0x001d0047, 0x001d0047,
+    0x001d0047, 0x001d0047, 0x001d0047, 0x001d0047, 0x001d0047, 0x001d0047,
+    0x001d0047, 0x001d0047, 0x001d0047, 0x001d0047, 0x001d0047, 0x001d0047,
+    0x00323048, 0x00323148, 0x00323248, 0x00326148, 0x00326348, 0x00326548,
+    0x00326948, 0x00326f48, 0x00327348, 0x00327448, 0x001d0048, 0x001d0048,
+    0x001d0048, 0x001d0048, 0x001d0048, 0x001d0048, 0x001d0048, 0x001d0048,
+    0x001d0048, 0x001d0048, 0x001d0048, 0x001d0048, 0x001d0048, 0x001d0048,
+    0x001d0048, 0x001d0048, 0x001d0048, 0x001d0048, 0x001d0048, 0x001d0048,
+    0x001d0048, 0x001d0048, 0x00323049, 0x00323149, 0x00323249, 0x00326149,
+    0x00326349, 0x00326549, 0x00326949, 0x00326f49, 0x00327349, 0x00327449,
+    0x001d0049, 0x001d0049, 0x001d0049, 0x001d0049, 0x001d0049, 0x001d0049,
+    0x001d0049, 0x001d0049, 0x001d0049, 0x001d0049, 0x001d0049, 0x001d0049,
+    0x001d0049, 0x001d0049, 0x001d0049, 0x001d0049, 0x001d0049, 0x001d0049,
+    0x001d0049, 0x001d0049, 0x001d0049, 0x001d0049, 0x0032304a, 0x0032314a,
+    0x0032324a, 0x0032614a, 0x0032634a, 0x0032654a, 0x0032694a, 0x00326f4a,
+    0x0032734a, 0x0032744a, 0x001d004a, 0x001d004a, 0x001d004a, 0x001d004a,
+    0x001d004a, 0x001d004a, 0x001d004a, 0x001d004a, 0x001d004a, 0x001d004a,
+    0x001d004a, 0x001d004a, 0x001d004a, 0x001d004a, 0x001d004a, 0x001d004a,
+    0x001d004a, 0x001d004a, 0x001d004a, 0x001d004a, 0x001d004a, 0x001d004a,
+    0x0032304b, 0x0032314b, 0x0032324b, 0x0032614b, 0x0032634b, 0x0032654b,
+    0x0032694b, 0x00326f4b, 0x0032734b, 0x0032744b, 0x001d004b, 0x001d004b,
+    0x001d004b, 0x001d004b, 0x001d004b, 0x001d004b, 0x001d004b, 0x001d004b,
+    0x001d004b, 0x001d004b, 0x001d004b, 0x001d004b, 0x001d004b, 0x001d004b,
+    0x001d004b, 0x001d004b, 0x001d004b, 0x001d004b, 0x001d004b, 0x001d004b,
+    0x001d004b, 0x001d004b, 0x0032304c, 0x0032314c, 0x0032324c, 0x0032614c,
+    0x0032634c, 0x0032654c, 0x0032694c, 0x00326f4c, 0x0032734c, 0x0032744c,
+    0x001d004c, 0x001d004c, 0x001d004c, 0x001d004c, 0x001d004c, 0x001d004c,
+    0x001d004c, 0x001d004c, 0x001d004c, 0x001d004c, 0x001d004c, 0x001d004c,
+    0x001d004c, 0x001d004c, 0x001d004c, 0x001d004c, 0x001d004c, 0x001d004c,
+    0x001d004c, 0x001d004c, 0x001d004c, 0x001d004c, 0x0032304d, 0x0032314d,
+    0x0032324d, 0x0032614d, 0x0032634d, 0x0032654d, 0x0032694d, 0x00326f4d,
+    0x0032734d, 0x0032744d, 0x001d004d, 0x001d004d, 0x001d004d, 0x001d004d,
+    0x001d004d, 0x001d004d, 0x001d004d, 0x001d004d, 0x001d004d, 0x001d004d,
+    0x001d004d, 0x001d004d, 0x001d004d, 0x001d004d, 0x001d004d, 0x001d004d,
+    0x001d004d, 0x001d004d, 0x001d004d, 0x001d004d, 0x001d004d, 0x001d004d,
+    0x0032304e, 0x0032314e, 0x0032324e, 0x0032614e, 0x0032634e, 0x0032654e,
+    0x0032694e, 0x00326f4e, 0x0032734e, 0x0032744e, 0x001d004e, 0x001d004e,
+    0x001d004e, 0x001d004e, 0x001d004e, 0x001d004e, 0x001d004e, 0x001d004e,
+    0x001d004e, 0x001d004e, 0x001d004e, 0x001d004e, 0x001d004e, 0x001d004e,
+    0x001d004e, 0x001d004e, 0x001d004e, 0x001d004e, 0x001d004e, 0x001d004e,
+    0x001d004e, 0x001d004e, 0x0032304f, 0x0032314f, 0x0032324f, 0x0032614f,
+    0x0032634f, 0x0032654f, 0x0032694f, 0x00326f4f, 0x0032734f, 0x0032744f,
+    0x001d004f, 0x001d004f, 0x001d004f, 0x001d004f, 0x001d004f, 0x001d004f,
+    0x001d004f, 0x001d004f, 0x001d004f, 0x001d004f, 0x001d004f, 0x001d004f,
+    0x001d004f, 0x001d004f, 0x001d004f, 0x001d004f, 0x001d004f, 0x001d004f,
+    0x001d004f, 0x001d004f, 0x001d004f, 0x001d004f, 0x00323050, 0x00323150,
+    0x00323250, 0x00326150, 0x00326350, 0x00326550, 0x00326950, 0x00326f50,
+    0x00327350, 0x00327450, 0x001d0050, 0x001d0050, 0x001d0050, 0x001d0050,
+    0x001d0050, 0x001d0050, 0x001d0050, 0x001d0050, 0x001d0050, 0x001d0050,
+    0x001d0050, 0x001d0050, 0x001d0050, 0x001d0050, 0x001d0050, 0x001d0050,
+    0x001d0050, 0x001d0050, 0x001d0050, 0x001d0050, 0x001d0050, 0x001d0050,
+    0x00323051, 0x00323151, 0x00323251, 0x00326151, 0x00326351, 0x00326551,
+    0x00326951, 0x00326f51, 0x00327351, 0x00327451, 0x001d0051, 0x001d0051,
+    0x001d0051, 0x001d0051, 0x001d0051, 0x001d0051, 0x001d0051, 0x001d0051,
+    0x001d0051, 0x001d0051, 0x001d0051, 0x001d0051, 0x001d0051, 0x001d0051,
+    0x001d0051, 0x001d0051, 0x001d0051, 0x001d0051, 0x001d0051, 0x001d0051,
+    0x001d0051, 0x001d0051, 0x00323052, 0x00323152, 0x00323252, 0x00326152,
+    0x00326352, 0x00326552, 0x00326952, 0x00326f52, 0x00327352, 0x00327452,
+    0x001d0052, 0x001d0052, 0x001d0052, 0x001d0052, 0x001d0052, 0x001d0052,
+    0x001d0052, 0x001d0052, 0x001d0052, 0x001d0052, 0x001d0052, 0x001d0052,
+    0x001d0052, 0x001d0052, 0x001d0052, 0x001d0052, 0x001d0052, 0x001d0052,
+    0x001d0052, 0x001d0052, 0x001d0052, 0x001d0052, 0x00323053, 0x00323153,
+    0x00323253, 0x00326153, 0x00326353, 0x00326553, 0x00326953, 0x00326f53,
+    0x00327353, 0x00327453, 0x001d0053, 0x001d0053, 0x001d0053, 0x001d0053,
+    0x001d0053, 0x001d0053, 0x001d0053, 0x001d0053, 0x001d0053, 0x001d0053,
+    0x001d0053, 0x001d0053, 0x001d0053, 0x001d0053, 0x001d0053, 0x001d0053,
+    0x001d0053, 0x001d0053, 0x001d0053, 0x001d0053, 0x001d0053, 0x001d0053,
+    0x00323054, 0x00323154, 0x00323254, 0x00326154, 0x00326354, 0x00326554,
+    0x00326954, 0x00326f54, 0x00327354, 0x00327454, 0x001d0054, 0x001d0054,
+    0x001d0054, 0x001d0054, 0x001d0054, 0x001d0054, 0x001d0054, 0x001d0054,
+    0x001d0054, 0x001d0054, 0x001d0054, 0x001d0054, 0x001d0054, 0x001d0054,
+    0x001d0054, 0x001d0054, 0x001d0054, 0x001d0054, 0x001d0054, 0x001d0054,
+    0x001d0054, 0x001d0054, 0x00323055, 0x00323155, 0x00323255, 0x00326155,
+    0x00326355, 0x00326555, 0x00326955, 0x00326f55, 0x00327355, 0x00327455,
+    0x001d0055, 0x001d0055, 0x001d0055, 0x001d0055, 0x001d0055, 0x001d0055,
+    0x001d0055, 0x001d0055, 0x001d0055, 0x001d0055, 0x001d0055, 0x001d0055,
+    0x001d0055, 0x001d0055, 0x001d0055, 0x001d0055, 0x001d0055, 0x001d0055,
+    0x001d0055, 0x001d0055, 0x001d0055, 0x001d0055, 0x00323056, 0x00323156,
+    0x00323256, 0x00326156, 0x00326356, 0x00326556, 0x00326956, 0x00326f56,
+    0x00327356, 0x00327456, 0x001d0056, 0x001d0056, 0x001d0056, 0x001d0056,
+    0x001d0056, 0x001d0056, 0x001d0056, 0x001d0056, 0x001d0056, 0x001d0056,
+    0x001d0056, 0x001d0056, 0x001d0056, 0x001d0056, 0x001d0056, 0x001d0056,
+    0x001d0056, 0x001d0056, 0x001d0056, 0x001d0056, 0x001d0056, 0x001d0056,
+    0x00323057, 0x00323157, 0x00323257, 0x00326157, 0x00326357, 0x00326557,
+    0x00326957, 0x00326f57, 0x00327357, 0x00327457, 0x001d0057, 0x001d0057,
+    0x001d0057, 0x001d0057, 0x001d0057, 0x001d0057, 0x001d0057, 0x001d0057,
+    0x001d0057, 0x001d0057, 0x001d0057, 0x001d0057, 0x001d0057, 0x001d0057,
+    0x001d0057, 0x001d0057, 0x001d0057, 0x001d0057, 0x001d0057, 0x001d0057,
+    0x001d0057, 0x001d0057, 0x00323059, 0x00323159, 0x00323259, 0x00326159,
+    0x00326359, 0x00326559, 0x00326959, 0x00326f59, 0x00327359, 0x00327459,
+    0x001d0059, 0x001d0059, 0x001d0059, 0x001d0059, 0x001d0059, 0x001d0059,
+    0x001d0059, 0x001d0059, 0x001d0059, 0x001d0059, 0x001d0059, 0x001d0059,
+    0x001d0059, 0x001d0059, 0x001d0059, 0x001d0059, 0x001d0059, 0x001d0059,
+    0x001d0059, 0x001d0059, 0x001d0059, 0x001d0059, 0x0032306a, 0x0032316a,
+    0x0032326a, 0x0032616a, 0x0032636a, 0x0032656a, 0x0032696a, 0x00326f6a,
+    0x0032736a, 0x0032746a, 0x001d006a, 0x001d006a, 0x001d006a, 0x001d006a,
+    0x001d006a, 0x001d006a, 0x001d006a, 0x001d006a, 0x001d006a, 0x001d006a,
+    0x001d006a, 0x001d006a, 0x001d006a, 0x001d006a, 0x001d006a, 0x001d006a,
+    0x001d006a, 0x001d006a, 0x001d006a, 0x001d006a, 0x001d006a, 0x001d006a,
+    0x0032306b, 0x0032316b, 0x0032326b, 0x0032616b, 0x0032636b, 0x0032656b,
+    0x0032696b, 0x00326f6b, 0x0032736b, 0x0032746b, 0x001d006b, 0x001d006b,
+    0x001d006b, 0x001d006b, 0x001d006b, 0x001d006b, 0x001d006b, 0x001d006b,
+    0x001d006b, 0x001d006b, 0x001d006b, 0x001d006b, 0x001d006b, 0x001d006b,
+    0x001d006b, 0x001d006b, 0x001d006b, 0x001d006b, 0x001d006b, 0x001d006b,
+    0x001d006b, 0x001d006b, 0x00323071, 0x00323171, 0x00323271, 0x00326171,
+    0x00326371, 0x00326571, 0x00326971, 0x00326f71, 0x00327371, 0x00327471,
+    0x001d0071, 0x001d0071, 0x001d0071, 0x001d0071, 0x001d0071, 0x001d0071,
+    0x001d0071, 0x001d0071, 0x001d0071, 0x001d0071, 0x001d0071, 0x001d0071,
+    0x001d0071, 0x001d0071, 0x001d0071, 0x001d0071, 0x001d0071, 0x001d0071,
+    0x001d0071, 0x001d0071, 0x001d0071, 0x001d0071, 0x00323076, 0x00323176,
+    0x00323276, 0x00326176, 0x00326376, 0x00326576, 0x00326976, 0x00326f76,
+    0x00327376, 0x00327476, 0x001d0076, 0x001d0076, 0x001d0076, 0x001d0076,
+    0x001d0076, 0x001d0076, 0x001d0076, 0x001d0076, 0x001d0076, 0x001d0076,
+    0x001d0076, 0x001d0076, 0x001d0076, 0x001d0076, 0x001d0076, 0x001d0076,
+    0x001d0076, 0x001d0076, 0x001d0076, 0x001d0076, 0x001d0076, 0x001d0076,
+    0x00323077, 0x00323177, 0x00323277, 0x00326177, 0x00326377, 0x00326577,
+    0x00326977, 0x00326f77, 0x00327377, 0x00327477, 0x001d0077, 0x001d0077,
+    0x001d0077, 0x001d0077, 0x001d0077, 0x001d0077, 0x001d0077, 0x001d0077,
+    0x001d0077, 0x001d0077, 0x001d0077, 0x001d0077, 0x001d0077, 0x001d0077,
+    0x001d0077, 0x001d0077, 0x001d0077, 0x001d0077, 0x001d0077, 0x001d0077,
+    0x001d0077, 0x001d0077, 0x00323078, 0x00323178, 0x00323278, 0x00326178,
+    0x00326378, 0x00326578, 0x00326978, 0x00326f78, 0x00327378, 0x00327478,
+    0x001d0078, 0x001d0078, 0x001d0078, 0x001d0078, 0x001d0078, 0x001d0078,
+    0x001d0078, 0x001d0078, 0x001d0078, 0x001d0078, 0x001d0078, 0x001d0078,
+    0x001d0078, 0x001d0078, 0x001d0078, 0x001d0078, 0x001d0078, 0x001d0078,
+    0x001d0078, 0x001d0078, 0x001d0078, 0x001d0078, 0x00323079, 0x00323179,
+    0x00323279, 0x00326179, 0x00326379, 0x00326579, 0x00326979, 0x00326f79,
+    0x00327379, 0x00327479, 0x001d0079, 0x001d0079, 0x001d0079, 0x001d0079,
+    0x001d0079, 0x001d0079, 0x001d0079, 0x001d0079, 0x001d0079, 0x001d0079,
+    0x001d0079, 0x001d0079, 0x001d0079, 0x001d0079, 0x001d0079, 0x001d0079,
+    0x001d0079, 0x001d0079, 0x001d0079, 0x001d0079, 0x001d0079, 0x001d0079,
+    0x0032307a, 0x0032317a, 0x0032327a, 0x0032617a, 0x0032637a, 0x0032657a,
+    0x0032697a, 0x00326f7a, 0x0032737a, 0x0032747a, 0x001d007a, 0x001d007a,
+    0x001d007a, 0x001d007a, 0x001d007a, 0x001d007a, 0x001d007a, 0x001d007a,
+    0x001d007a, 0x001d007a, 0x001d007a, 0x001d007a, 0x001d007a, 0x001d007a,
+    0x001d007a, 0x001d007a, 0x001d007a, 0x001d007a, 0x001d007a, 0x001d007a,
+    0x001d007a, 0x001d007a, 0x00210026, 0x00210026, 0x00210026, 0x00210026,
+    0x00210026, 0x00210026, 0x00210026, 0x00210026, 0x00210026, 0x00210026,
+    0x00210026, 0x00210026, 0x00210026, 0x00210026, 0x00210026, 0x00210026,
+    0x0021002a, 0x0021002a, 0x0021002a, 0x0021002a, 0x0021002a, 0x0021002a,
+    0x0021002a, 0x0021002a, 0x0021002a, 0x0021002a, 0x0021002a, 0x0021002a,
+    0x0021002a, 0x0021002a, 0x0021002a, 0x0021002a, 0x0021002c, 0x0021002c,
+    0x0021002c, 0x0021002c, 0x0021002c, 0x0021002c, 0x0021002c, 0x0021002c,
+    0x0021002c, 0x0021002c, 0x0021002c, 0x0021002c, 0x0021002c, 0x0021002c,
+    0x0021002c, 0x0021002c, 0x0021003b, 0x0021003b, 0x0021003b, 0x0021003b,
+    0x0021003b, 0x0021003b, 0x0021003b, 0x0021003b, 0x0021003b, 0x0021003b,
+    0x0021003b, 0x0021003b, 0x0021003b, 0x0021003b, 0x0021003b, 0x0021003b,
+    0x00210058, 0x00210058, 0x00210058, 0x00210058, 0x00210058, 0x00210058,
+    0x00210058, 0x00210058, 0x00210058, 0x00210058, 0x00210058, 0x00210058,
+    0x00210058, 0x00210058, 0x00210058, 0x00210058, 0x0021005a, 0x0021005a,
+    0x0021005a, 0x0021005a, 0x0021005a, 0x0021005a, 0x0021005a, 0x0021005a,
+    0x0021005a, 0x0021005a, 0x0021005a, 0x0021005a, 0x0021005a, 0x0021005a,
+    0x0021005a, 0x0021005a, 0x00290021, 0x00290021, 0x00290021, 0x00290021,
+    0x00290022, 0x00290022, 0x00290022, 0x00290022, 0x00290028, 0x00290028,
+    0x00290028, 0x00290028, 0x00290029, 0x00290029, 0x00290029, 0x00290029,
+    0x0029003f, 0x0029003f, 0x0029003f, 0x0029003f, 0x002d0027, 0x002d0027,
+    0x002d002b, 0x002d002b, 0x002d007c, 0x002d007c, 0x00310023, 0x0031003e,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000};
 }  // namespace grpc_core
@@ -192,6 +192,7 @@ class HuffDecoderCommon {
   static inline uint64_t GetEmit29(size_t, size_t emit) {
     return table29_0_emit_[emit];
   }
+  static inline uint32_t GetFastOp(size_t i) { return fast_ops_[i]; }
 
  private:
   static const uint8_t table2_0_emit_[10];
@@ -272,6 +273,7 @@ class HuffDecoderCommon {
   static const uint8_t table29_0_emit_[9];
   static const uint8_t table29_0_inner_[9];
   static const uint8_t table29_0_outer_[16];
+  static const uint32_t fast_ops_[4096];
 };
 template <typename F>
 class HuffDecoder : public HuffDecoderCommon {
@@ -280,6 +282,7 @@ class HuffDecoder : public HuffDecoderCommon {
       : sink_(sink), begin_(begin), end_(end) {}
   bool Run() {
     while (!done_) {
+      DecodeFast();
       if (!RefillTo8()) {
         Done0();
         break;
@@ -1006,6 +1009,31 @@ class HuffDecoder : public HuffDecoderCommon {
       }
     }
   }
+  // Decode short symbols several at a time while at least 8 bytes of
+  // input remain, stopping before any symbol that the table can't
+  // decode.
+  void DecodeFast() {
+    while (end_ - begin_ >= 8) {
+      const int bytes = (63 - buffer_len_) / 8;
+      uint64_t input = 0;
+      for (int i = 0; i < 8; i++) input = (input << 8) | begin_[i];
+      buffer_ = (buffer_ << (8 * bytes)) | (input >> 1 >> (63 - 8 * bytes));
+      begin_ += bytes;
+      buffer_len_ += 8 * bytes;
+      const auto next = GetFastOp((buffer_ >> (buffer_len_ - 12)) & 0xfff);
+      if (((next >> 16) & 3) == 0) return;
+      uint8_t emit[8];
+      int emit_len = 0;
+      for (int i = 0; i < 4; i++) {
+        const auto op = GetFastOp((buffer_ >> (buffer_len_ - 12)) & 0xfff);
+        emit[emit_len] = static_cast<uint8_t>(op);
+        emit[emit_len + 1] = static_cast<uint8_t>(op >> 8);
+        emit_len += (op >> 16) & 3;
+        buffer_len_ -= op >> 18;
+      }
+      for (int i = 0; i < emit_len; i++) sink_(emit[i]);
+    }
+  }
   F sink_;
   const uint8_t* begin_;
   const uint8_t* const end_;
@@ -23,6 +23,10 @@
 #include <algorithm>
 #include <cstdint>
 #include <memory>
+#include <utility>
+
+#include "absl/hash/hash.h"
+#include "absl/memory/memory.h"
 
 #include <grpc/slice.h>
 #include <grpc/slice_buffer.h>
@@ -309,6 +313,16 @@ void HPackCompressor::Framer::EmitLitHdrWithNonBinaryStringKeyNotIdx(
   Add(emit.data());
 }
 
+void HPackCompressor::Framer::EmitLitHdrWithNonBinaryStringKeyNeverIdx(
+    Slice key_slice, Slice value_slice) {
+  StringKey key(std::move(key_slice));
+  key.WritePrefix(0x10, AddTiny(key.prefix_length()));
+  Add(key.key());
+  NonBinaryStringValue emit(std::move(value_slice));
+  emit.WritePrefix(AddTiny(emit.prefix_length()));
+  Add(emit.data());
+}
+
 void HPackCompressor::Framer::AdvertiseTableSizeChange() {
   VarintWriter<3> w(compressor_->table_.max_size());
   w.Write(0x20, AddTiny(w.length()));
@@ -360,12 +374,114 @@ void HPackCompressor::SliceIndex::EmitTo(absl::string_view key,
   values_.emplace_back(value.Ref(), index);
 }
 
-void HPackCompressor::Framer::Encode(const Slice& key, const Slice& value) {
-  if (absl::EndsWith(key.as_string_view(), "-bin")) {
-    EmitLitHdrWithBinaryStringKeyNotIdx(key.Ref(), value.Ref());
+namespace {
+
+// Keys whose values are credentials, which must never be indexed.
+bool IsSensitiveKey(absl::string_view key) {
+  return key == "authorization" || key == "proxy-authorization" ||
+         key == "cookie" || key == "set-cookie";
+}
+
+} /* namespace */
+
+bool HPackCompressor::CustomMetadataIndex::Admit(size_t hash,
+                                                 size_t transport_length,
+                                                 uint32_t max_table_size) {
+  uint8_t& frequency = frequencies_[(hash >> 16) % kNumFrequencies];
+  if (frequency < kMaxFrequency) ++frequency;
+  if (++sightings_ == kAgingPeriod) {
+    sightings_ = 0;
+    for (uint8_t& f : frequencies_) f /= 2;
+  }
+  // size_t may be 32 bits wide, so take the admission bits from the top of
+  // the low half, clear of the bits that pick entries and frequencies.
+  const uint32_t admission_bits =
+      static_cast<uint32_t>(hash) >> (32 - kMaxAdmitShift);
+  return frequency >= kAdmitFrequency &&
+         (admission_bits & ((1u << admit_shift_) - 1)) == 0 &&
+         transport_length <= max_table_size / kMaxEntryFraction &&
+         transport_length <= HPackEncoderTable::MaxEntrySize();
+}
+
+void HPackCompressor::CustomMetadataIndex::EmitTo(const Slice& key,
+                                                  const Slice& value,
+                                                  Framer* framer) {
+  if (IsSensitiveKey(key.as_string_view())) {
+    framer->EmitLitHdrWithNonBinaryStringKeyNeverIdx(key.Ref(), value.Ref());
+    return;
+  }
+  auto& table = framer->compressor_->table_;
+  const bool is_binary = absl::EndsWith(key.as_string_view(), "-bin");
+  // The table size of a base64 encoded element depends on whether the peer
+  // decodes it before sizing it, so only index binary values sent verbatim
+  // to a peer that is known to be gRPC.
+  if (is_binary && !framer->use_true_binary_metadata_) {
+    framer->EmitLitHdrWithBinaryStringKeyNotIdx(key.Ref(), value.Ref());
+    return;
+  }
+  const size_t hash =
+      absl::Hash<std::pair<absl::string_view, absl::string_view>>()(
+          {key.as_string_view(), value.as_string_view()});
+  // Each element may live in one of two entries, and never displaces another
+  // element that is still in the table.
+  Entry* const candidates[] = {&entries_[hash % kNumEntries],
+                               &entries_[(hash >> 16) % kNumEntries]};
+  Entry* free_entry = nullptr;
+  for (Entry* entry : candidates) {
+    const bool matches =
+        entry->index != 0 && entry->hash == hash && entry->key == key &&
+        entry->value == value;
+    if (entry->index != 0 && !table.ConvertableToDynamicIndex(entry->index)) {
+      if (matches) {
+        // Evicted before it was reused: admit fewer elements.
+        hits_ = 0;
+        if (admit_shift_ < kMaxAdmitShift) ++admit_shift_;
+      }
+      entry->index = 0;
+    }
+    if (entry->index == 0) {
+      if (free_entry == nullptr) free_entry = entry;
+      continue;
+    }
+    if (matches) {
+      framer->EmitIndexed(table.DynamicIndex(entry->index));
+      if (admit_shift_ > 0 && ++hits_ == kHitsToWidenAdmission) {
+        hits_ = 0;
+        --admit_shift_;
+      }
+      return;
+    }
+  }
+  const size_t transport_length =
+      hpack_constants::SizeForEntry(key.size(), value.size());
+  if (!Admit(hash, transport_length, table.max_size()) ||
+      free_entry == nullptr) {
+    if (is_binary) {
+      framer->EmitLitHdrWithBinaryStringKeyNotIdx(key.Ref(), value.Ref());
+    } else {
+      framer->EmitLitHdrWithNonBinaryStringKeyNotIdx(key.Ref(), value.Ref());
+    }
+    return;
+  }
+  free_entry->hash = hash;
+  // The metadata may reference memory owned by the call, so keep our own copy
+  // for comparison with later calls.
+  free_entry->key = key.AsOwned();
+  free_entry->value = value.AsOwned();
+  free_entry->index = table.AllocateIndex(transport_length);
+  if (is_binary) {
+    framer->EmitLitHdrWithBinaryStringKeyIncIdx(key.Ref(), value.Ref());
   } else {
-    EmitLitHdrWithNonBinaryStringKeyNotIdx(key.Ref(), value.Ref());
+    framer->EmitLitHdrWithNonBinaryStringKeyIncIdx(key.Ref(), value.Ref());
+  }
+}
+
+void HPackCompressor::Framer::Encode(const Slice& key, const Slice& value) {
+  if (compressor_->custom_metadata_index_ == nullptr) {
+    compressor_->custom_metadata_index_ =
+        absl::make_unique<CustomMetadataIndex>();
   }
+  compressor_->custom_metadata_index_->EmitTo(key, value, this);
 }
 
 void HPackCompressor::Framer::Encode(HttpPathMetadata, const Slice& value) {
@@ -24,6 +24,7 @@
 #include <stddef.h>
 
 #include <cstdint>
+#include <memory>
 #include <utility>
 #include <vector>
 
@@ -50,6 +51,7 @@ namespace grpc_core {
 
 class HPackCompressor {
   class SliceIndex;
+  class CustomMetadataIndex;
 
  public:
   HPackCompressor() = default;
@@ -123,6 +125,7 @@ class HPackCompressor {
 
    private:
     friend class SliceIndex;
+    friend class CustomMetadataIndex;
 
     struct FramePrefix {
       // index (in output_) of the header for the frame
@@ -148,6 +151,8 @@ class HPackCompressor {
                                              Slice value_slice);
     void EmitLitHdrWithNonBinaryStringKeyNotIdx(Slice key_slice,
                                                 Slice value_slice);
+    void EmitLitHdrWithNonBinaryStringKeyNeverIdx(Slice key_slice,
+                                                  Slice value_slice);
 
     void EncodeAlwaysIndexed(uint32_t* index, absl::string_view key,
                              Slice value, uint32_t transport_length);
@@ -201,6 +206,66 @@ class HPackCompressor {
     std::vector<ValueIndex> values_;
   };
 
+  // Admits custom (application defined) metadata into the table once it has
+  // been seen often enough on this connection to be worth the space, and
+  // remembers where admitted elements are.
+  //
+  // The table evicts in insertion order, so admission is the only lever on
+  // what stays in it: each admitted element pushes out the oldest entries,
+  // which may well be the always indexed grpc headers. Elements are admitted
+  // after kAdmitFrequency sightings, and no element may take more than
+  // 1/kMaxEntryFraction of the table. An element lives in one of two entries
+  // picked by its hash, and is sent as a literal rather than displace another
+  // element that is still in the table.
+  //
+  // When more elements are frequent than fit, admitted elements get evicted
+  // before they are reused and every insertion is wasted. Each such eviction
+  // halves the share of elements considered for admission, chosen by hash so
+  // that the same elements stay admitted; the share doubles again after a run
+  // of reuses without one.
+  //
+  // Credentials such as authorization and cookie values are never indexed:
+  // compressing them against headers an attacker can influence would leak
+  // them through the size of the compressed output (RFC 7541 section 7.1).
+  class CustomMetadataIndex {
+   public:
+    void EmitTo(const Slice& key, const Slice& value, Framer* framer);
+
+   private:
+    static constexpr size_t kNumEntries = 64;
+    static constexpr size_t kNumFrequencies = 1024;
+    static constexpr uint8_t kAdmitFrequency = 2;
+    static constexpr uint8_t kMaxFrequency = 15;
+    static constexpr uint32_t kMaxEntryFraction = 8;
+    // Frequencies are halved every kAgingPeriod sightings, so that elements
+    // that are no longer sent are forgotten.
+    static constexpr uint32_t kAgingPeriod = 16 * kNumFrequencies;
+    // At most 1 in 2^kMaxAdmitShift elements are considered when churning.
+    static constexpr uint32_t kMaxAdmitShift = 6;
+    // Reuses without a wasted insertion needed to double the share again.
+    static constexpr uint32_t kHitsToWidenAdmission = 256;
+
+    struct Entry {
+      size_t hash = 0;
+      Slice key;
+      Slice value;
+      uint32_t index = 0;
+    };
+
+    // Counts a sighting of the element with hash, and returns true if the
+    // element should be inserted into the table.
+    bool Admit(size_t hash, size_t transport_length, uint32_t max_table_size);
+
+    Entry entries_[kNumEntries];
+    uint8_t frequencies_[kNumFrequencies] = {};
+    uint32_t sightings_ = 0;
+    // Only elements whose admission bits (the top kMaxAdmitShift bits of the
+    // low 32 bits of their hash) have their low admit_shift_ bits clear are
+    // considered for admission.
+    uint32_t admit_shift_ = 0;
+    uint32_t hits_ = 0;
+  };
+
   struct PreviousTimeout {
     Timeout timeout;
     uint32_t index;
@@ -229,6 +294,8 @@ class HPackCompressor {
   SliceIndex path_index_;
   SliceIndex authority_index_;
   std::vector<PreviousTimeout> previous_timeouts_;
+  // Created on first use: most connections send no custom metadata.
+  std::unique_ptr<CustomMetadataIndex> custom_metadata_index_;
 };
 
 }  // namespace grpc_core
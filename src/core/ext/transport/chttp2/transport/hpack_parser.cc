@@ -758,6 +758,7 @@ class HPackParser::String {
  private:
   void AppendBytes(const uint8_t* data, size_t length);
   explicit String(std::vector<uint8_t> v) : value_(std::move(v)) {}
+  explicit String(Slice s) : value_(std::move(s)) {}
   explicit String(absl::Span<const uint8_t> v) : value_(v) {}
   String(grpc_slice_refcount* r, const uint8_t* begin, const uint8_t* end)
       : value_(Slice::FromRefcountAndBytes(r, begin, end)) {}
@@ -819,7 +820,7 @@ class HPackParser::String {
   // Turn base64 encoded bytes into not base64 encoded bytes.
   // Only takes input to set an error on failure.
   static absl::optional<String> Unbase64(Input* input, String s) {
-    absl::optional<std::vector<uint8_t>> result;
+    absl::optional<Slice> result;
     if (auto* p = absl::get_if<Slice>(&s.value_)) {
       result = Unbase64Loop(p->begin(), p->end());
     }
@@ -841,85 +842,63 @@ class HPackParser::String {
   }
 
   // Main loop for Unbase64
-  static absl::optional<std::vector<uint8_t>> Unbase64Loop(const uint8_t* cur,
-                                                           const uint8_t* end) {
+  // Decodes straight into a slice of the final size, so the value needn't be
+  // copied again when it's taken.
+  static absl::optional<Slice> Unbase64Loop(const uint8_t* cur,
+                                            const uint8_t* end) {
     while (cur != end && end[-1] == '=') {
       --end;
     }
 
-    std::vector<uint8_t> out;
-    out.reserve(3 * (end - cur) / 4 + 3);
+    // Every 4 bytes decode to 3, and a trailing 2 or 3 to 1 or 2.
+    const size_t tail = (end - cur) % 4;
+    if (tail == 1) return {};
+    MutableSlice out = MutableSlice::CreateUninitialized(
+        (end - cur) / 4 * 3 + (tail == 0 ? 0 : tail - 1));
+    uint8_t* p = out.begin();
 
-    // Decode 4 bytes at a time while we can
+    // Decode 4 bytes at a time while we can. Invalid bytes decode to more than
+    // 63, so one check covers all 4.
     while (end - cur >= 4) {
-      uint32_t bits = kBase64InverseTable.table[*cur];
-      if (bits > 63) return {};
-      uint32_t buffer = bits << 18;
-      ++cur;
-
-      bits = kBase64InverseTable.table[*cur];
-      if (bits > 63) return {};
-      buffer |= bits << 12;
-      ++cur;
-
-      bits = kBase64InverseTable.table[*cur];
-      if (bits > 63) return {};
-      buffer |= bits << 6;
-      ++cur;
-
-      bits = kBase64InverseTable.table[*cur];
-      if (bits > 63) return {};
-      buffer |= bits;
-      ++cur;
-
-      out.insert(out.end(), {static_cast<uint8_t>(buffer >> 16),
-                             static_cast<uint8_t>(buffer >> 8),
-                             static_cast<uint8_t>(buffer)});
+      const uint32_t a = kBase64InverseTable.table[cur[0]];
+      const uint32_t b = kBase64InverseTable.table[cur[1]];
+      const uint32_t c = kBase64InverseTable.table[cur[2]];
+      const uint32_t d = kBase64InverseTable.table[cur[3]];
+      if ((a | b | c | d) > 63) return {};
+      const uint32_t buffer = (a << 18) | (b << 12) | (c << 6) | d;
+      p[0] = static_cast<uint8_t>(buffer >> 16);
+      p[1] = static_cast<uint8_t>(buffer >> 8);
+      p[2] = static_cast<uint8_t>(buffer);
+      cur += 4;
+      p += 3;
     }
-    // Deal with the last 0, 1, 2, or 3 bytes.
-    switch (end - cur) {
+    // Deal with the last 0, 2, or 3 bytes.
+    switch (tail) {
       case 0:
-        return out;
-      case 1:
-        return {};
+        break;
       case 2: {
-        uint32_t bits = kBase64InverseTable.table[*cur];
-        if (bits > 63) return {};
-        uint32_t buffer = bits << 18;
-
-        ++cur;
-        bits = kBase64InverseTable.table[*cur];
-        if (bits > 63) return {};
-        buffer |= bits << 12;
-
+        const uint32_t a = kBase64InverseTable.table[cur[0]];
+        const uint32_t b = kBase64InverseTable.table[cur[1]];
+        if ((a | b) > 63) return {};
+        const uint32_t buffer = (a << 18) | (b << 12);
         if (buffer & 0xffff) return {};
-        out.push_back(static_cast<uint8_t>(buffer >> 16));
-        return out;
+        p[0] = static_cast<uint8_t>(buffer >> 16);
+        break;
       }
       case 3: {
-        uint32_t bits = kBase64InverseTable.table[*cur];
-        if (bits > 63) return {};
-        uint32_t buffer = bits << 18;
-
-        ++cur;
-        bits = kBase64InverseTable.table[*cur];
-        if (bits > 63) return {};
-        buffer |= bits << 12;
-
-        ++cur;
-        bits = kBase64InverseTable.table[*cur];
-        if (bits > 63) return {};
-        buffer |= bits << 6;
-
-        ++cur;
+        const uint32_t a = kBase64InverseTable.table[cur[0]];
+        const uint32_t b = kBase64InverseTable.table[cur[1]];
+        const uint32_t c = kBase64InverseTable.table[cur[2]];
+        if ((a | b | c) > 63) return {};
+        const uint32_t buffer = (a << 18) | (b << 12) | (c << 6);
         if (buffer & 0xff) return {};
-        out.push_back(static_cast<uint8_t>(buffer >> 16));
-        out.push_back(static_cast<uint8_t>(buffer >> 8));
-        return out;
+        p[0] = static_cast<uint8_t>(buffer >> 16);
+        p[1] = static_cast<uint8_t>(buffer >> 8);
+        break;
       }
     }
 
-    GPR_UNREACHABLE_CODE(return out;);
+    return Slice(std::move(out));
   }
 
   absl::variant<Slice, absl::Span<const uint8_t>, std::vector<uint8_t>> value_;
@@ -32,6 +32,7 @@
 #include <grpc/event_engine/memory_allocator.h>
 #include <grpc/impl/codegen/grpc_types.h>
 #include <grpc/slice.h>
+#include <grpc/support/time.h>
 
 #include "src/core/ext/transport/chttp2/transport/flow_control.h"
 #include "src/core/ext/transport/chttp2/transport/frame.h"
@@ -308,6 +309,21 @@ struct grpc_chttp2_transport {
    */
   uint32_t write_buffer_size = grpc_core::chttp2::kDefaultWindow;
 
+  /* write coalescing */
+  /** how long a write carrying new stream data may be held so that other
+      streams can join it; zero disables coalescing */
+  grpc_core::Duration write_coalescing_window;
+  /** flush a held write once this many message bytes are waiting in it */
+  uint32_t write_coalescing_bytes = 64 * 1024;
+  /** message bytes queued since the last write began */
+  uint32_t write_coalescing_pending_bytes = 0;
+  /** is a write being held by write_coalescing_timer? */
+  bool write_coalescing_timer_pending = false;
+  /** when the held write was started, for stats */
+  gpr_timespec write_coalescing_start;
+  grpc_timer write_coalescing_timer;
+  grpc_closure write_coalescing_timer_expired_locked;
+
   /** Set to a grpc_error object if a goaway frame is received. By default, set
    * to GRPC_ERROR_NONE */
   grpc_error_handle goaway_error = GRPC_ERROR_NONE;
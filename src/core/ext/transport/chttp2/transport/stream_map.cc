@@ -20,11 +20,75 @@
 
 #include "src/core/ext/transport/chttp2/transport/stream_map.h"
 
+#include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include <grpc/support/alloc.h>
 #include <grpc/support/log.h>
 
+/* Fibonacci hashing: the top index_bits bits of the product spread both
+   consecutive stream ids and ids sharing their low bits over the index. */
+static size_t index_slot(const grpc_chttp2_stream_map* map, uint32_t key) {
+  return static_cast<uint32_t>(key * 0x9e3779b9u) >> (32 - map->index_bits);
+}
+
+static size_t index_mask(const grpc_chttp2_stream_map* map) {
+  return (static_cast<size_t>(1) << map->index_bits) - 1;
+}
+
+static void index_insert(grpc_chttp2_stream_map* map, size_t pos) {
+  size_t mask = index_mask(map);
+  size_t slot = index_slot(map, map->keys[pos]);
+  while (map->index[slot] != 0) slot = (slot + 1) & mask;
+  map->index[slot] = static_cast<uint32_t>(pos + 1);
+}
+
+/* Return the index slot holding key, or SIZE_MAX if key is not live */
+static size_t index_find(grpc_chttp2_stream_map* map, uint32_t key) {
+  size_t mask = index_mask(map);
+  for (size_t slot = index_slot(map, key);; slot = (slot + 1) & mask) {
+    uint32_t entry = map->index[slot];
+    if (entry == 0) return SIZE_MAX;
+    if (map->keys[entry - 1] == key) return slot;
+  }
+}
+
+/* Empty an index slot, shifting back later entries of the same probe run so
+   that lookups never need tombstones */
+static void index_remove(grpc_chttp2_stream_map* map, size_t slot) {
+  size_t mask = index_mask(map);
+  size_t hole = slot;
+  for (size_t next = (hole + 1) & mask; map->index[next] != 0;
+       next = (next + 1) & mask) {
+    size_t home = index_slot(map, map->keys[map->index[next] - 1]);
+    /* the entry at next may move into the hole iff its home slot is not
+       cyclically within (hole, next] */
+    if (((next - home) & mask) >= ((next - hole) & mask)) {
+      map->index[hole] = map->index[next];
+      hole = next;
+    }
+  }
+  map->index[hole] = 0;
+}
+
+/* (Re)allocate the index for the current capacity and fill it with every
+   live entry */
+static void index_rebuild(grpc_chttp2_stream_map* map) {
+  uint32_t bits = map->index_bits;
+  while ((static_cast<size_t>(1) << bits) < 2 * map->capacity) bits++;
+  if (map->index == nullptr || bits != map->index_bits) {
+    gpr_free(map->index);
+    map->index_bits = bits;
+    map->index = static_cast<uint32_t*>(
+        gpr_malloc(sizeof(uint32_t) << map->index_bits));
+  }
+  memset(map->index, 0, sizeof(uint32_t) << map->index_bits);
+  for (size_t i = 0; i < map->count; i++) {
+    if (map->values[i]) index_insert(map, i);
+  }
+}
+
 void grpc_chttp2_stream_map_init(grpc_chttp2_stream_map* map,
                                  size_t initial_capacity) {
   GPR_DEBUG_ASSERT(initial_capacity > 1);
@@ -35,11 +99,15 @@ void grpc_chttp2_stream_map_init(grpc_chttp2_stream_map* map,
   map->count = 0;
   map->free = 0;
   map->capacity = initial_capacity;
+  map->index = nullptr;
+  map->index_bits = 1;
+  index_rebuild(map);
 }
 
 void grpc_chttp2_stream_map_destroy(grpc_chttp2_stream_map* map) {
   gpr_free(map->keys);
   gpr_free(map->values);
+  gpr_free(map->index);
 }
 
 static size_t compact(uint32_t* keys, void** values, size_t count) {
@@ -77,7 +145,7 @@ void grpc_chttp2_stream_map_add(grpc_chttp2_stream_map* map, uint32_t key,
 
   if (count == capacity) {
     if (map->free > capacity / 4) {
-      count = compact(keys, values, count);
+      map->count = count = compact(keys, values, count);
       map->free = 0;
     } else {
       /* resize when less than 25% of the table is free, because compaction
@@ -88,53 +156,28 @@ void grpc_chttp2_stream_map_add(grpc_chttp2_stream_map* map, uint32_t key,
       map->values = values =
           static_cast<void**>(gpr_realloc(values, capacity * sizeof(void*)));
     }
+    /* positions changed, or the index is now too small */
+    index_rebuild(map);
   }
 
   keys[count] = key;
   values[count] = value;
   map->count = count + 1;
-}
-
-template <bool strict_find>
-static void** find(grpc_chttp2_stream_map* map, uint32_t key) {
-  size_t min_idx = 0;
-  size_t max_idx = map->count;
-  size_t mid_idx;
-  uint32_t* keys = map->keys;
-  void** values = map->values;
-  uint32_t mid_key;
-
-  GPR_DEBUG_ASSERT(!strict_find || max_idx > 0);
-  if (!strict_find && max_idx == 0) return nullptr;
-
-  while (min_idx < max_idx) {
-    /* find the midpoint, avoiding overflow */
-    mid_idx = min_idx + ((max_idx - min_idx) / 2);
-    mid_key = keys[mid_idx];
-
-    if (mid_key < key) {
-      min_idx = mid_idx + 1;
-    } else if (mid_key > key) {
-      max_idx = mid_idx;
-    } else /* mid_key == key */
-    {
-      return &values[mid_idx];
-    }
-  }
-
-  GPR_DEBUG_ASSERT(!strict_find);
-  return nullptr;
+  index_insert(map, count);
 }
 
 void* grpc_chttp2_stream_map_delete(grpc_chttp2_stream_map* map, uint32_t key) {
-  void** pvalue = find<true>(map, key);
-  GPR_DEBUG_ASSERT(pvalue != nullptr);
+  size_t slot = index_find(map, key);
+  GPR_DEBUG_ASSERT(slot != SIZE_MAX);
+  if (slot == SIZE_MAX) return nullptr;
+  void** pvalue = &map->values[map->index[slot] - 1];
   void* out = *pvalue;
   GPR_DEBUG_ASSERT(out != nullptr);
+  index_remove(map, slot);
   *pvalue = nullptr;
   map->free++;
   /* recognize complete emptyness and ensure we can skip
-     defragmentation later */
+     defragmentation later; the index is already empty */
   if (map->free == map->count) {
     map->free = map->count = 0;
   }
@@ -143,8 +186,8 @@ void* grpc_chttp2_stream_map_delete(grpc_chttp2_stream_map* map, uint32_t key) {
 }
 
 void* grpc_chttp2_stream_map_find(grpc_chttp2_stream_map* map, uint32_t key) {
-  void** pvalue = find<false>(map, key);
-  return pvalue != nullptr ? *pvalue : nullptr;
+  size_t slot = index_find(map, key);
+  return slot != SIZE_MAX ? map->values[map->index[slot] - 1] : nullptr;
 }
 
 size_t grpc_chttp2_stream_map_size(grpc_chttp2_stream_map* map) {
@@ -159,6 +202,7 @@ void* grpc_chttp2_stream_map_rand(grpc_chttp2_stream_map* map) {
     map->count = compact(map->keys, map->values, map->count);
     map->free = 0;
     GPR_ASSERT(map->count > 0);
+    index_rebuild(map);
   }
   return map->values[(static_cast<size_t>(rand())) % map->count];
 }
@@ -27,15 +27,22 @@
 /* Data structure to map a uint32_t to a data object (represented by a void*)
 
    Represented as a sorted array of keys, and a corresponding array of values.
-   Lookups are performed with binary search.
    Adds are restricted to strictly higher keys than previously seen (this is
-   guaranteed by http2). */
+   guaranteed by http2), so appending keeps the array sorted.
+   Lookups go through an open addressing hash index (linear probing) from key
+   to array position, so they take constant time even with many thousands of
+   concurrent streams. The index only holds live keys, and it is rebuilt
+   whenever the array is compacted or grown. */
 struct grpc_chttp2_stream_map {
   uint32_t* keys;
   void** values;
   size_t count;
   size_t free;
   size_t capacity;
+  /* Hash index: each slot is 0 when empty, or 1 + the position of a live key
+     in keys/values. It has 2^index_bits slots, at least twice capacity. */
+  uint32_t* index;
+  uint32_t index_bits;
 };
 void grpc_chttp2_stream_map_init(grpc_chttp2_stream_map* map,
                                  size_t initial_capacity);
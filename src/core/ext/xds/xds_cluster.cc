@@ -52,6 +52,7 @@
 #include "src/core/ext/xds/xds_resource_type.h"
 #include "src/core/lib/debug/trace.h"
 #include "src/core/lib/gprpp/host_port.h"
+#include "src/core/lib/gprpp/prime.h"
 #include "src/core/lib/gprpp/time.h"
 
 namespace grpc_core {
@@ -91,6 +92,10 @@ std::string XdsClusterResource::ToString() const {
   if (lb_policy == "RING_HASH") {
     contents.push_back(absl::StrCat("min_ring_size=", min_ring_size));
     contents.push_back(absl::StrCat("max_ring_size=", max_ring_size));
+  } else if (lb_policy == "MAGLEV") {
+    contents.push_back(absl::StrCat("table_size=", table_size));
+  } else if (lb_policy == "LEAST_REQUEST") {
+    contents.push_back(absl::StrCat("choice_count=", choice_count));
   }
   contents.push_back(
       absl::StrCat("max_concurrent_requests=", max_concurrent_requests));
@@ -336,6 +341,43 @@ absl::StatusOr<XdsClusterResource> CdsResourceParse(
         errors.emplace_back("ring hash lb config has invalid hash function.");
       }
     }
+  } else if (envoy_config_cluster_v3_Cluster_lb_policy(cluster) ==
+             envoy_config_cluster_v3_Cluster_MAGLEV) {
+    cds_update.lb_policy = "MAGLEV";
+    // Record maglev lb config
+    auto* maglev_config =
+        envoy_config_cluster_v3_Cluster_maglev_lb_config(cluster);
+    if (maglev_config != nullptr) {
+      const google_protobuf_UInt64Value* table_size =
+          envoy_config_cluster_v3_Cluster_MaglevLbConfig_table_size(
+              maglev_config);
+      if (table_size != nullptr) {
+        cds_update.table_size = google_protobuf_UInt64Value_value(table_size);
+        if (cds_update.table_size > 5000011 ||
+            !IsPrime(cds_update.table_size)) {
+          errors.emplace_back(
+              "table_size must be a prime number no larger than 5000011.");
+        }
+      }
+    }
+  } else if (envoy_config_cluster_v3_Cluster_lb_policy(cluster) ==
+             envoy_config_cluster_v3_Cluster_LEAST_REQUEST) {
+    cds_update.lb_policy = "LEAST_REQUEST";
+    // Record least request lb config
+    auto* least_request_config =
+        envoy_config_cluster_v3_Cluster_least_request_lb_config(cluster);
+    if (least_request_config != nullptr) {
+      const google_protobuf_UInt32Value* choice_count =
+          envoy_config_cluster_v3_Cluster_LeastRequestLbConfig_choice_count(
+              least_request_config);
+      if (choice_count != nullptr) {
+        cds_update.choice_count =
+            google_protobuf_UInt32Value_value(choice_count);
+        if (cds_update.choice_count < 2) {
+          errors.emplace_back("choice_count must be at least 2.");
+        }
+      }
+    }
   } else {
     errors.emplace_back("LB policy is not supported.");
   }
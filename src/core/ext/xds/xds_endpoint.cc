@@ -18,12 +18,11 @@
 
 #include "src/core/ext/xds/xds_endpoint.h"
 
-#include <stdlib.h>
-
 #include <algorithm>
 #include <vector>
 
 #include "absl/memory/memory.h"
+#include "absl/random/random.h"
 #include "absl/status/status.h"
 #include "absl/status/statusor.h"
 #include "absl/strings/str_cat.h"
@@ -88,8 +87,10 @@ bool XdsEndpointResource::DropConfig::ShouldDrop(
     const std::string** category_name) const {
   for (size_t i = 0; i < drop_category_list_.size(); ++i) {
     const auto& drop_category = drop_category_list_[i];
-    // Generate a random number in [0, 1000000).
-    const uint32_t random = static_cast<uint32_t>(rand()) % 1000000;
+    // Generate a random number in [0, 1000000).  Each thread uses its own
+    // generator, since picks may run concurrently.
+    thread_local absl::InsecureBitGen bit_gen;
+    const uint32_t random = absl::Uniform<uint32_t>(bit_gen, 0, 1000000);
     if (random < drop_category.parts_per_million) {
       *category_name = &drop_category.name;
       return true;
@@ -88,7 +88,7 @@ struct XdsEndpointResource {
     }
 
     // The only method invoked from outside the WorkSerializer (used in
-    // the data plane).
+    // the data plane).  Must be safe to call concurrently.
     bool ShouldDrop(const std::string** category_name) const;
 
     const DropCategoryList& drop_category_list() const {
@@ -50,6 +50,8 @@ const char* grpc_stats_counter_name[GRPC_STATS_COUNTER_COUNT] = {
     "cq_pluck_creates",
     "cq_next_creates",
     "cq_callback_creates",
+    "server_calls_shed",
+    "server_queue_overloads",
 };
 const char* grpc_stats_counter_doc[GRPC_STATS_COUNTER_COUNT] = {
     "Number of client side calls created by this process",
@@ -75,11 +77,18 @@ const char* grpc_stats_counter_doc[GRPC_STATS_COUNTER_COUNT] = {
     "usage)",
     "Number of completion queues created for cq_callback (indicates callback "
     "api usage)",
+    "Number of server calls failed by queue delay admission control",
+    "Number of times queue delay admission control found a server overloaded",
 };
 const char* grpc_stats_histogram_name[GRPC_STATS_HISTOGRAM_COUNT] = {
-    "call_initial_size",       "tcp_write_size", "tcp_write_iov_size",
-    "tcp_read_size",           "tcp_read_offer", "tcp_read_offer_iov_size",
+    "call_initial_size",
+    "tcp_write_size",
+    "tcp_write_iov_size",
+    "tcp_read_size",
+    "tcp_read_offer",
+    "tcp_read_offer_iov_size",
     "http2_send_message_size",
+    "http2_write_coalescing_delay",
 };
 const char* grpc_stats_histogram_doc[GRPC_STATS_HISTOGRAM_COUNT] = {
     "Initial size of the grpc_call arena created at call start",
@@ -89,6 +98,8 @@ const char* grpc_stats_histogram_doc[GRPC_STATS_HISTOGRAM_COUNT] = {
     "Number of bytes offered to each syscall_read",
     "Number of byte segments offered to each syscall_read",
     "Size of messages received by HTTP2 transport",
+    "Number of microseconds HTTP2 writes were held to coalesce frames from "
+    "several streams",
 };
 const int grpc_stats_table_0[25] = {
     0,   1,   2,   4,    7,    11,   17,   26,   40,   61,    93,    142,  216,
@@ -174,17 +185,18 @@ int BucketForHistogramValue_80_10(int value) {
   }
 }
 }  // namespace grpc_core
-const int grpc_stats_histo_buckets[7] = {24, 20, 10, 20, 20, 10, 20};
-const int grpc_stats_histo_start[7] = {0, 24, 44, 54, 74, 94, 104};
-const int* const grpc_stats_histo_bucket_boundaries[7] = {
+const int grpc_stats_histo_buckets[8] = {24, 20, 10, 20, 20, 10, 20, 20};
+const int grpc_stats_histo_start[8] = {0, 24, 44, 54, 74, 94, 104, 124};
+const int* const grpc_stats_histo_bucket_boundaries[8] = {
     grpc_stats_table_0, grpc_stats_table_2, grpc_stats_table_4,
     grpc_stats_table_2, grpc_stats_table_2, grpc_stats_table_4,
-    grpc_stats_table_2};
-int (*const grpc_stats_get_bucket[7])(int value) = {
+    grpc_stats_table_2, grpc_stats_table_2};
+int (*const grpc_stats_get_bucket[8])(int value) = {
     grpc_core::BucketForHistogramValue_32768_24,
     grpc_core::BucketForHistogramValue_16777216_20,
     grpc_core::BucketForHistogramValue_80_10,
     grpc_core::BucketForHistogramValue_16777216_20,
     grpc_core::BucketForHistogramValue_16777216_20,
     grpc_core::BucketForHistogramValue_80_10,
+    grpc_core::BucketForHistogramValue_16777216_20,
     grpc_core::BucketForHistogramValue_16777216_20};
@@ -14,4 +14,6 @@ http2_transport_stalls_per_iteration:FLOAT,
 http2_stream_stalls_per_iteration:FLOAT,
 cq_pluck_creates_per_iteration:FLOAT,
 cq_next_creates_per_iteration:FLOAT,
-cq_callback_creates_per_iteration:FLOAT
+cq_callback_creates_per_iteration:FLOAT,
+server_calls_shed_per_iteration:FLOAT,
+server_queue_overloads_per_iteration:FLOAT
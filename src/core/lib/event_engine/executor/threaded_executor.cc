@@ -18,11 +18,13 @@
 
 #include <utility>
 
+#include "src/core/lib/experiments/experiments.h"
+
 namespace grpc_event_engine {
 namespace experimental {
 
 ThreadedExecutor::ThreadedExecutor(int reserve_threads)
-    : thread_pool_(reserve_threads){};
+    : thread_pool_(reserve_threads, grpc_core::IsWorkStealingEnabled()){};
 
 void ThreadedExecutor::Run(EventEngine::Closure* closure) {
   thread_pool_.Add([closure]() { closure->Run(); });
@@ -0,0 +1,727 @@
+// Copyright 2022 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/event_engine/posix_engine/ev_io_uring_linux.h"
+
+#include <stdint.h>
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <utility>
+
+#include "absl/memory/memory.h"
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/support/log.h>
+
+#include "src/core/lib/event_engine/poller.h"
+#include "src/core/lib/event_engine/time_util.h"
+#include "src/core/lib/iomgr/port.h"
+
+// This polling engine is only relevant on linux kernels supporting io_uring
+// with multishot poll requests (5.13+).
+#ifdef GRPC_IO_URING_POLLER
+#include <errno.h>
+#include <limits.h>
+#include <poll.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include "absl/synchronization/mutex.h"
+
+#include "src/core/lib/event_engine/posix_engine/event_poller.h"
+#include "src/core/lib/event_engine/posix_engine/lockfree_event.h"
+#include "src/core/lib/event_engine/posix_engine/posix_engine_closure.h"
+#include "src/core/lib/event_engine/posix_engine/wakeup_fd_posix.h"
+#include "src/core/lib/event_engine/posix_engine/wakeup_fd_posix_default.h"
+#include "src/core/lib/gprpp/fork.h"
+
+namespace grpc_event_engine {
+namespace posix_engine {
+
+using ::grpc_event_engine::experimental::EventEngine;
+using ::grpc_event_engine::experimental::Poller;
+using ::grpc_event_engine::posix_engine::LockfreeEvent;
+using ::grpc_event_engine::posix_engine::WakeupFd;
+
+namespace {
+
+// Completions carrying this user_data are acknowledgements of poll removal
+// requests and need no processing.
+constexpr uint64_t kIgnoredUserData = 0;
+
+// Events requested for every registered file descriptor. POLLERR and POLLHUP
+// are always reported by the kernel but are listed for clarity.
+constexpr uint32_t kHandlePollEvents =
+    POLLIN | POLLPRI | POLLOUT | POLLERR | POLLHUP;
+
+int IoUringSetup(unsigned entries, struct io_uring_params* p) {
+  return static_cast<int>(syscall(__NR_io_uring_setup, entries, p));
+}
+
+int IoUringEnter(int ring_fd, unsigned to_submit, unsigned min_complete,
+                 unsigned flags, void* arg, size_t arg_size) {
+  return static_cast<int>(syscall(__NR_io_uring_enter, ring_fd, to_submit,
+                                  min_complete, flags, arg, arg_size));
+}
+
+int IoUringRegister(int ring_fd, unsigned opcode, void* arg,
+                    unsigned nr_args) {
+  return static_cast<int>(
+      syscall(__NR_io_uring_register, ring_fd, opcode, arg, nr_args));
+}
+
+// Asks the kernel whether the ring supports the opcodes this poller submits.
+bool SupportsPollOps(int ring_fd) {
+  constexpr unsigned kMaxOps = 256;
+  std::unique_ptr<char[]> buf(new char[sizeof(struct io_uring_probe) +
+                                       kMaxOps *
+                                           sizeof(struct io_uring_probe_op)]());
+  auto* probe = reinterpret_cast<struct io_uring_probe*>(buf.get());
+  if (IoUringRegister(ring_fd, IORING_REGISTER_PROBE, probe, kMaxOps) < 0) {
+    return false;
+  }
+  auto supported = [probe](uint8_t op) {
+    return op <= probe->last_op && op < probe->ops_len &&
+           (probe->ops[op].flags & IO_URING_OP_SUPPORTED) != 0;
+  };
+  return supported(IORING_OP_POLL_ADD) && supported(IORING_OP_POLL_REMOVE);
+}
+
+unsigned LoadAcquire(unsigned* p) {
+  return __atomic_load_n(p, __ATOMIC_ACQUIRE);
+}
+
+void StoreRelease(unsigned* p, unsigned v) {
+  __atomic_store_n(p, v, __ATOMIC_RELEASE);
+}
+
+}  // namespace
+
+class IoUringEventHandle : public EventHandle {
+ public:
+  IoUringEventHandle(int fd, bool track_err, IoUringPoller* poller)
+      : fd_(fd),
+        track_err_(track_err),
+        poller_(poller),
+        read_closure_(absl::make_unique<LockfreeEvent>(poller->GetScheduler())),
+        write_closure_(
+            absl::make_unique<LockfreeEvent>(poller->GetScheduler())),
+        error_closure_(
+            absl::make_unique<LockfreeEvent>(poller->GetScheduler())) {
+    read_closure_->InitEvent();
+    write_closure_->InitEvent();
+    error_closure_->InitEvent();
+  }
+  void ReInit(int fd, bool track_err) {
+    fd_ = fd;
+    track_err_ = track_err;
+    orphaned_.store(false, std::memory_order_relaxed);
+    read_closure_->InitEvent();
+    write_closure_->InitEvent();
+    error_closure_->InitEvent();
+    pending_read_.store(false, std::memory_order_relaxed);
+    pending_write_.store(false, std::memory_order_relaxed);
+    pending_error_.store(false, std::memory_order_relaxed);
+  }
+  IoUringPoller* Poller() { return poller_; }
+  uint64_t UserData() { return reinterpret_cast<uintptr_t>(this); }
+  bool TrackErr() const { return track_err_; }
+  bool IsOrphaned() const { return orphaned_.load(std::memory_order_acquire); }
+  bool SetPendingActions(bool pending_read, bool pending_write,
+                         bool pending_error) {
+    // See Epoll1EventHandle::SetPendingActions for why these need to be
+    // atomic: ExecutePendingActions() of a previous Work(...) invocation may
+    // run in parallel with the current one.
+    if (pending_read) {
+      pending_read_.store(true, std::memory_order_release);
+    }
+    if (pending_write) {
+      pending_write_.store(true, std::memory_order_release);
+    }
+    if (pending_error) {
+      pending_error_.store(true, std::memory_order_release);
+    }
+    return pending_read || pending_write || pending_error;
+  }
+  int WrappedFd() override { return fd_; }
+  void OrphanHandle(PosixEngineClosure* on_done, int* release_fd,
+                    absl::string_view reason) override;
+  void ShutdownHandle(absl::Status why) override;
+  void NotifyOnRead(PosixEngineClosure* on_read) override;
+  void NotifyOnWrite(PosixEngineClosure* on_write) override;
+  void NotifyOnError(PosixEngineClosure* on_error) override;
+  void SetReadable() override;
+  void SetWritable() override;
+  void SetHasError() override;
+  bool IsHandleShutdown() override;
+  inline void ExecutePendingActions() {
+    if (pending_read_.exchange(false, std::memory_order_acq_rel)) {
+      read_closure_->SetReady();
+    }
+    if (pending_write_.exchange(false, std::memory_order_acq_rel)) {
+      write_closure_->SetReady();
+    }
+    if (pending_error_.exchange(false, std::memory_order_acq_rel)) {
+      error_closure_->SetReady();
+    }
+  }
+  ~IoUringEventHandle() override = default;
+
+ private:
+  void HandleShutdownInternal(absl::Status why, bool releasing_fd);
+  // See Epoll1EventHandle::ShutdownHandle for explanation on why a mutex is
+  // required.
+  absl::Mutex mu_;
+  int fd_;
+  bool track_err_;
+  // Set once the handle has been orphaned. Completions for an orphaned
+  // handle are dropped, and the handle is returned to the free list once the
+  // kernel reports that its poll request has terminated.
+  std::atomic<bool> orphaned_{false};
+  std::atomic<bool> pending_read_{false};
+  std::atomic<bool> pending_write_{false};
+  std::atomic<bool> pending_error_{false};
+  IoUringPoller* poller_;
+  std::unique_ptr<LockfreeEvent> read_closure_;
+  std::unique_ptr<LockfreeEvent> write_closure_;
+  std::unique_ptr<LockfreeEvent> error_closure_;
+};
+
+namespace {
+
+// Check the process level preconditions of this poller. Kernel support is
+// checked by IoUringPoller::Init and IoUringPoller::IsSupported.
+bool InitIoUringPollerLinux() {
+  if (!grpc_event_engine::posix_engine::SupportsWakeupFd()) {
+    return false;
+  }
+  // A ring is shared with forked children, which would then observe the
+  // parent's completions. Fork support is not implemented for this poller.
+  return !grpc_core::Fork::Enabled();
+}
+
+}  // namespace
+
+void IoUringEventHandle::OrphanHandle(PosixEngineClosure* on_done,
+                                      int* release_fd,
+                                      absl::string_view reason) {
+  bool is_release_fd = (release_fd != nullptr);
+  if (!read_closure_->IsShutdown()) {
+    HandleShutdownInternal(absl::Status(absl::StatusCode::kUnknown, reason),
+                           is_release_fd);
+  }
+  {
+    // The orphaned bit and the removal request must be published atomically
+    // with respect to ProcessCompletions, otherwise the handle could be
+    // recycled and re-armed before the removal request for its previous
+    // incarnation is queued.
+    absl::MutexLock lock(&poller_->mu_);
+    orphaned_.store(true, std::memory_order_release);
+    absl::MutexLock sq_lock(&poller_->sq_mu_);
+    while (!poller_->QueueSqe(IORING_OP_POLL_REMOVE, -1, kIgnoredUserData,
+                              UserData(), 0, 0)) {
+      poller_->SubmitNow();
+    }
+  }
+  // Submit the removal immediately so that the kernel drops its reference to
+  // the underlying file.
+  poller_->SubmitNow();
+
+  // If release_fd is not NULL, we should be relinquishing control of the file
+  // descriptor fd->fd (but we still own the grpc_fd structure).
+  if (is_release_fd) {
+    *release_fd = fd_;
+  } else {
+    close(fd_);
+  }
+  {
+    absl::MutexLock lock(&mu_);
+    read_closure_->DestroyEvent();
+    write_closure_->DestroyEvent();
+    error_closure_->DestroyEvent();
+  }
+  pending_read_.store(false, std::memory_order_release);
+  pending_write_.store(false, std::memory_order_release);
+  pending_error_.store(false, std::memory_order_release);
+  if (on_done != nullptr) {
+    on_done->SetStatus(absl::OkStatus());
+    poller_->GetScheduler()->Run(on_done);
+  }
+}
+
+// if 'releasing_fd' is true, it means that we are going to detach the internal
+// fd from grpc_fd structure (i.e which means we should not be calling
+// shutdown() syscall on that fd). The poll request itself is cancelled by
+// OrphanHandle.
+void IoUringEventHandle::HandleShutdownInternal(absl::Status why,
+                                                bool releasing_fd) {
+  if (read_closure_->SetShutdown(why)) {
+    if (!releasing_fd) {
+      shutdown(fd_, SHUT_RDWR);
+    }
+    write_closure_->SetShutdown(why);
+    error_closure_->SetShutdown(why);
+  }
+}
+
+IoUringPoller::IoUringPoller(Scheduler* scheduler)
+    : scheduler_(scheduler), was_kicked_(false) {}
+
+IoUringPoller* IoUringPoller::Create(Scheduler* scheduler) {
+  auto* poller = new IoUringPoller(scheduler);
+  if (!poller->Init()) {
+    delete poller;
+    return nullptr;
+  }
+  return poller;
+}
+
+// Requires:
+//  - IORING_FEAT_NODROP, so completions are never lost on CQ overflow.
+//  - IORING_FEAT_EXT_ARG, to wait with a timeout without an extra SQE.
+//  - IORING_OP_POLL_ADD and IORING_OP_POLL_REMOVE. Whether poll requests
+//    may be multishot is checked by IsSupported.
+bool IoUringPoller::Init() {
+  struct io_uring_params params;
+  memset(&params, 0, sizeof(params));
+  ring_.ring_fd = IoUringSetup(IO_URING_QUEUE_DEPTH, &params);
+  if (ring_.ring_fd < 0) {
+    gpr_log(GPR_ERROR, "io_uring_setup failed: %s", strerror(errno));
+    return false;
+  }
+  const uint32_t kRequiredFeatures = IORING_FEAT_NODROP | IORING_FEAT_EXT_ARG;
+  if ((params.features & kRequiredFeatures) != kRequiredFeatures ||
+      !SupportsPollOps(ring_.ring_fd)) {
+    return false;
+  }
+  gpr_log(GPR_INFO, "grpc io_uring fd: %d", ring_.ring_fd);
+  ring_.sq_ring_size =
+      params.sq_off.array + params.sq_entries * sizeof(unsigned);
+  ring_.cq_ring_size =
+      params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+  if (params.features & IORING_FEAT_SINGLE_MMAP) {
+    ring_.sq_ring_size = ring_.cq_ring_size =
+        std::max(ring_.sq_ring_size, ring_.cq_ring_size);
+  }
+  // Failed mappings are left as nullptr so that the destructor only unmaps
+  // what was mapped.
+  auto map = [this](size_t size, off_t offset) -> void* {
+    void* p = mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                   MAP_SHARED | MAP_POPULATE, ring_.ring_fd, offset);
+    return p == MAP_FAILED ? nullptr : p;
+  };
+  ring_.sq_ring_ptr = map(ring_.sq_ring_size, IORING_OFF_SQ_RING);
+  if (ring_.sq_ring_ptr == nullptr) return false;
+  if (params.features & IORING_FEAT_SINGLE_MMAP) {
+    ring_.cq_ring_ptr = ring_.sq_ring_ptr;
+  } else {
+    ring_.cq_ring_ptr = map(ring_.cq_ring_size, IORING_OFF_CQ_RING);
+    if (ring_.cq_ring_ptr == nullptr) return false;
+  }
+  ring_.sqes_size = params.sq_entries * sizeof(struct io_uring_sqe);
+  ring_.sqes = static_cast<struct io_uring_sqe*>(
+      map(ring_.sqes_size, IORING_OFF_SQES));
+  if (ring_.sqes == nullptr) return false;
+  char* sq = static_cast<char*>(ring_.sq_ring_ptr);
+  ring_.sq_head = reinterpret_cast<unsigned*>(sq + params.sq_off.head);
+  ring_.sq_tail = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+  ring_.sq_mask = reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+  ring_.sq_array = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+  char* cq = static_cast<char*>(ring_.cq_ring_ptr);
+  ring_.cq_head = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+  ring_.cq_tail = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+  ring_.cq_mask = reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+  ring_.cqes = reinterpret_cast<struct io_uring_cqe*>(cq + params.cq_off.cqes);
+
+  auto wakeup_fd = CreateWakeupFd();
+  if (!wakeup_fd.ok()) return false;
+  wakeup_fd_ = std::move(*wakeup_fd);
+  {
+    absl::MutexLock lock(&sq_mu_);
+    QueuePollAdd(wakeup_fd_->ReadFd(),
+                 reinterpret_cast<uintptr_t>(wakeup_fd_.get()), POLLIN);
+  }
+  SubmitNow();
+  return true;
+}
+
+void IoUringPoller::Shutdown() { delete this; }
+
+IoUringPoller::~IoUringPoller() {
+  // Closing the ring cancels every outstanding request.
+  if (ring_.ring_fd >= 0) {
+    close(ring_.ring_fd);
+    ring_.ring_fd = -1;
+  }
+  if (ring_.sqes != nullptr) {
+    munmap(ring_.sqes, ring_.sqes_size);
+  }
+  if (ring_.cq_ring_ptr != nullptr && ring_.cq_ring_ptr != ring_.sq_ring_ptr) {
+    munmap(ring_.cq_ring_ptr, ring_.cq_ring_size);
+  }
+  if (ring_.sq_ring_ptr != nullptr) {
+    munmap(ring_.sq_ring_ptr, ring_.sq_ring_size);
+  }
+  absl::MutexLock lock(&mu_);
+  free_io_uring_handles_list_.clear();
+  all_handles_.clear();
+}
+
+bool IoUringPoller::QueueSqe(uint8_t opcode, int fd, uint64_t user_data,
+                             uint64_t addr, uint32_t poll_events,
+                             uint32_t len) {
+  unsigned tail = *ring_.sq_tail;
+  if (tail - LoadAcquire(ring_.sq_head) >= IO_URING_QUEUE_DEPTH) {
+    return false;
+  }
+  unsigned index = tail & *ring_.sq_mask;
+  struct io_uring_sqe* sqe = &ring_.sqes[index];
+  memset(sqe, 0, sizeof(*sqe));
+  sqe->opcode = opcode;
+  sqe->fd = fd;
+  sqe->addr = addr;
+  sqe->len = len;
+  sqe->user_data = user_data;
+#if __BYTE_ORDER == __BIG_ENDIAN
+  poll_events = (poll_events << 16) | (poll_events >> 16);
+#endif
+  sqe->poll32_events = poll_events;
+  ring_.sq_array[index] = index;
+  // Publish the entry to the kernel.
+  StoreRelease(ring_.sq_tail, tail + 1);
+  return true;
+}
+
+void IoUringPoller::SubmitNow() {
+  int r;
+  do {
+    r = IoUringEnter(ring_.ring_fd, IO_URING_QUEUE_DEPTH, 0, 0, nullptr, 0);
+  } while (r < 0 && errno == EINTR);
+  if (r < 0 && errno != EAGAIN && errno != EBUSY) {
+    gpr_log(GPR_ERROR, "io_uring_enter failed: %s", strerror(errno));
+  }
+}
+
+void IoUringPoller::QueuePollAdd(int fd, uint64_t user_data,
+                                 uint32_t poll_events) {
+  while (!QueueSqe(IORING_OP_POLL_ADD, fd, user_data, 0, poll_events,
+                   IORING_POLL_ADD_MULTI)) {
+    // The submission ring is full: flush it and try again.
+    SubmitNow();
+  }
+}
+
+EventHandle* IoUringPoller::CreateHandle(int fd, absl::string_view /*name*/,
+                                         bool track_err) {
+  IoUringEventHandle* new_handle = nullptr;
+  {
+    absl::MutexLock lock(&mu_);
+    if (free_io_uring_handles_list_.empty()) {
+      all_handles_.push_back(
+          absl::make_unique<IoUringEventHandle>(fd, track_err, this));
+      new_handle = all_handles_.back().get();
+    } else {
+      new_handle = reinterpret_cast<IoUringEventHandle*>(
+          free_io_uring_handles_list_.front());
+      free_io_uring_handles_list_.pop_front();
+      new_handle->ReInit(fd, track_err);
+    }
+  }
+  // Registration is submitted right away so that events on the new fd are
+  // not delayed until the next call to Work(...).
+  {
+    absl::MutexLock lock(&sq_mu_);
+    QueuePollAdd(fd, new_handle->UserData(), kHandlePollEvents);
+  }
+  SubmitNow();
+  return new_handle;
+}
+
+unsigned IoUringPoller::NumReadyCompletions() {
+  return LoadAcquire(ring_.cq_tail) - *ring_.cq_head;
+}
+
+// Process all the completions available in the completion ring.
+// It returns true, it there was a Kick that forced invocation of this
+// function. It also returns the list of handles that became
+// readable/writable.
+bool IoUringPoller::ProcessCompletions(Events& pending_events) {
+  unsigned head = *ring_.cq_head;
+  unsigned tail = LoadAcquire(ring_.cq_tail);
+  bool was_kicked = false;
+  for (; head != tail; ++head) {
+    struct io_uring_cqe* cqe = &ring_.cqes[head & *ring_.cq_mask];
+    uint64_t user_data = cqe->user_data;
+    int32_t res = cqe->res;
+    bool more = (cqe->flags & IORING_CQE_F_MORE) != 0;
+    if (user_data == kIgnoredUserData) {
+      continue;
+    }
+    if (user_data == reinterpret_cast<uintptr_t>(wakeup_fd_.get())) {
+      if (res > 0) {
+        GPR_ASSERT(wakeup_fd_->ConsumeWakeup().ok());
+        was_kicked = true;
+      }
+      if (!more) {
+        absl::MutexLock lock(&sq_mu_);
+        QueuePollAdd(wakeup_fd_->ReadFd(), user_data, POLLIN);
+      }
+      continue;
+    }
+    IoUringEventHandle* handle =
+        reinterpret_cast<IoUringEventHandle*>(user_data);
+    if (handle->IsOrphaned()) {
+      if (!more) {
+        // The kernel no longer references the handle; it can be recycled.
+        free_io_uring_handles_list_.push_back(handle);
+      }
+      continue;
+    }
+    if (res > 0) {
+      uint32_t events = static_cast<uint32_t>(res);
+      bool track_err = handle->TrackErr();
+      bool cancel = (events & POLLHUP) != 0;
+      bool error = (events & POLLERR) != 0;
+      bool read_ev = (events & (POLLIN | POLLPRI)) != 0;
+      bool write_ev = (events & POLLOUT) != 0;
+      bool err_fallback = error && !track_err;
+      if (handle->SetPendingActions(read_ev || cancel || err_fallback,
+                                    write_ev || cancel || err_fallback,
+                                    error && !err_fallback)) {
+        pending_events.push_back(handle);
+      }
+    }
+    if (!more) {
+      // The multishot request terminated (e.g. the kernel ran out of
+      // overflow space). Re-arm it; it is submitted with the next wait.
+      absl::MutexLock lock(&sq_mu_);
+      QueuePollAdd(handle->WrappedFd(), user_data, kHandlePollEvents);
+    }
+  }
+  StoreRelease(ring_.cq_head, head);
+  return was_kicked;
+}
+
+// Submit any queued requests and wait for completions. This does not
+// "process" any of the completions yet; that is done in ProcessCompletions().
+// It returns the number of completions available in the ring.
+int IoUringPoller::DoIoUringWait(EventEngine::Duration timeout) {
+  int64_t timeout_ms = grpc_event_engine::experimental::Milliseconds(timeout);
+  struct __kernel_timespec ts;
+  struct io_uring_getevents_arg arg;
+  memset(&arg, 0, sizeof(arg));
+  if (timeout_ms >= 0) {
+    ts.tv_sec = timeout_ms / 1000;
+    ts.tv_nsec = (timeout_ms % 1000) * 1000000;
+    arg.ts = reinterpret_cast<uintptr_t>(&ts);
+  }
+  int r;
+  do {
+    r = IoUringEnter(ring_.ring_fd, IO_URING_QUEUE_DEPTH, 1,
+                     IORING_ENTER_GETEVENTS | IORING_ENTER_EXT_ARG, &arg,
+                     sizeof(arg));
+  } while (r < 0 && errno == EINTR);
+  if (r < 0 && errno != ETIME && errno != EAGAIN && errno != EBUSY) {
+    gpr_log(GPR_ERROR,
+            "(event_engine) IoUringPoller:%p encountered io_uring_enter "
+            "error: %s",
+            this, strerror(errno));
+    GPR_ASSERT(false);
+  }
+  return static_cast<int>(NumReadyCompletions());
+}
+
+// Might be called multiple times
+void IoUringEventHandle::ShutdownHandle(absl::Status why) {
+  absl::MutexLock lock(&mu_);
+  HandleShutdownInternal(why, false);
+}
+
+bool IoUringEventHandle::IsHandleShutdown() {
+  return read_closure_->IsShutdown();
+}
+
+void IoUringEventHandle::NotifyOnRead(PosixEngineClosure* on_read) {
+  read_closure_->NotifyOn(on_read);
+}
+
+void IoUringEventHandle::NotifyOnWrite(PosixEngineClosure* on_write) {
+  write_closure_->NotifyOn(on_write);
+}
+
+void IoUringEventHandle::NotifyOnError(PosixEngineClosure* on_error) {
+  error_closure_->NotifyOn(on_error);
+}
+
+void IoUringEventHandle::SetReadable() { read_closure_->SetReady(); }
+
+void IoUringEventHandle::SetWritable() { write_closure_->SetReady(); }
+
+void IoUringEventHandle::SetHasError() { error_closure_->SetReady(); }
+
+// Polls the registered Fds for events until timeout is reached or there is a
+// Kick(). Unlike the epoll1 poller, every completion available in the ring is
+// processed in a single invocation. If there is a Kick() and no fd became
+// ready, it returns Poller::WorkResult::Kicked{}
+Poller::WorkResult IoUringPoller::Work(
+    EventEngine::Duration timeout,
+    absl::FunctionRef<void()> schedule_poll_again) {
+  Events pending_events;
+  if (NumReadyCompletions() == 0) {
+    if (DoIoUringWait(timeout) == 0) {
+      return Poller::WorkResult::kDeadlineExceeded;
+    }
+  }
+  {
+    absl::MutexLock lock(&mu_);
+    if (ProcessCompletions(pending_events)) {
+      was_kicked_ = false;
+    }
+    if (pending_events.empty()) {
+      return Poller::WorkResult::kKicked;
+    }
+  }
+  // Run the provided callback.
+  schedule_poll_again();
+  // Process all pending events inline.
+  for (auto& it : pending_events) {
+    it->ExecutePendingActions();
+  }
+  return Poller::WorkResult::kOk;
+}
+
+void IoUringPoller::Kick() {
+  absl::MutexLock lock(&mu_);
+  if (was_kicked_) {
+    return;
+  }
+  was_kicked_ = true;
+  GPR_ASSERT(wakeup_fd_->Wakeup().ok());
+}
+
+// Probes a ring of the size used in production, whose only request is the
+// multishot poll of the wakeup fd:
+//  - Some io_uring implementations (e.g. gVisor) return immediately from
+//    io_uring_enter() instead of blocking until a completion arrives, so a
+//    wait before the wakeup fd is signalled must time out.
+//  - Once signalled, the poll must complete with IORING_CQE_F_MORE set,
+//    showing that the kernel kept the request armed. Kernels without
+//    multishot poll reject or complete the request for good instead.
+bool IoUringPoller::IsSupported() {
+  if (!InitIoUringPollerLinux()) {
+    return false;
+  }
+  std::unique_ptr<IoUringPoller> probe(Create(/*scheduler=*/nullptr));
+  if (probe == nullptr) {
+    return false;
+  }
+  auto wait = [&probe]() {
+    struct __kernel_timespec ts;
+    ts.tv_sec = 0;
+    ts.tv_nsec = 1000000;
+    struct io_uring_getevents_arg arg;
+    memset(&arg, 0, sizeof(arg));
+    arg.ts = reinterpret_cast<uintptr_t>(&ts);
+    int r;
+    do {
+      r = IoUringEnter(probe->ring_.ring_fd, IO_URING_QUEUE_DEPTH, 1,
+                       IORING_ENTER_GETEVENTS | IORING_ENTER_EXT_ARG, &arg,
+                       sizeof(arg));
+    } while (r < 0 && errno == EINTR);
+    return r;
+  };
+  if (wait() >= 0 || errno != ETIME || probe->NumReadyCompletions() != 0) {
+    return false;
+  }
+  if (!probe->wakeup_fd_->Wakeup().ok()) {
+    return false;
+  }
+  wait();
+  if (probe->NumReadyCompletions() == 0) {
+    return false;
+  }
+  const struct io_uring_cqe* cqe =
+      &probe->ring_.cqes[*probe->ring_.cq_head & *probe->ring_.cq_mask];
+  return cqe->user_data ==
+             reinterpret_cast<uintptr_t>(probe->wakeup_fd_.get()) &&
+         cqe->res > 0 && (cqe->flags & IORING_CQE_F_MORE) != 0;
+}
+
+IoUringPoller* GetIoUringPoller(Scheduler* scheduler) {
+  static bool kIoUringPollerSupported = IoUringPoller::IsSupported();
+  if (kIoUringPollerSupported) {
+    return IoUringPoller::Create(scheduler);
+  }
+  return nullptr;
+}
+
+}  // namespace posix_engine
+}  // namespace grpc_event_engine
+
+#else /* defined(GRPC_IO_URING_POLLER) */
+
+namespace grpc_event_engine {
+namespace posix_engine {
+
+using ::grpc_event_engine::experimental::EventEngine;
+using ::grpc_event_engine::experimental::Poller;
+
+class IoUringEventHandle {};
+
+IoUringPoller::IoUringPoller(Scheduler* /* engine */) {
+  GPR_ASSERT(false && "unimplemented");
+}
+
+IoUringPoller* IoUringPoller::Create(Scheduler* /*scheduler*/) {
+  return nullptr;
+}
+
+bool IoUringPoller::Init() { return false; }
+
+void IoUringPoller::Shutdown() { GPR_ASSERT(false && "unimplemented"); }
+
+IoUringPoller::~IoUringPoller() { GPR_ASSERT(false && "unimplemented"); }
+
+EventHandle* IoUringPoller::CreateHandle(int /*fd*/,
+                                         absl::string_view /*name*/,
+                                         bool /*track_err*/) {
+  GPR_ASSERT(false && "unimplemented");
+}
+
+Poller::WorkResult IoUringPoller::Work(
+    EventEngine::Duration /*timeout*/,
+    absl::FunctionRef<void()> /*schedule_poll_again*/) {
+  GPR_ASSERT(false && "unimplemented");
+}
+
+void IoUringPoller::Kick() { GPR_ASSERT(false && "unimplemented"); }
+
+bool IoUringPoller::IsSupported() { return false; }
+
+// If GRPC_IO_URING_POLLER is not defined, it means io_uring is not available.
+// Return nullptr.
+IoUringPoller* GetIoUringPoller(Scheduler* /*scheduler*/) { return nullptr; }
+
+}  // namespace posix_engine
+}  // namespace grpc_event_engine
+
+#endif /* !defined(GRPC_IO_URING_POLLER) */
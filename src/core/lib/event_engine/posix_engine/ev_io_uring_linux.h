@@ -0,0 +1,166 @@
+// Copyright 2022 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_EV_IO_URING_LINUX_H
+#define GRPC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_EV_IO_URING_LINUX_H
+#include <grpc/support/port_platform.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <list>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/container/inlined_vector.h"
+#include "absl/functional/function_ref.h"
+#include "absl/strings/string_view.h"
+#include "absl/synchronization/mutex.h"
+
+#include <grpc/event_engine/event_engine.h>
+
+#include "src/core/lib/event_engine/poller.h"
+#include "src/core/lib/event_engine/posix_engine/event_poller.h"
+#include "src/core/lib/event_engine/posix_engine/wakeup_fd_posix.h"
+#include "src/core/lib/iomgr/port.h"
+
+#ifdef GRPC_LINUX_IO_URING
+#include <linux/io_uring.h>
+// Multishot poll requests need kernel headers from Linux 5.13 or newer.
+#if defined(IORING_POLL_ADD_MULTI) && defined(IORING_FEAT_EXT_ARG)
+#define GRPC_IO_URING_POLLER 1
+#endif
+#endif
+
+// Number of submission queue entries requested from the kernel. The kernel
+// sizes the completion queue at twice this value.
+#define IO_URING_QUEUE_DEPTH 1024
+
+namespace grpc_event_engine {
+namespace posix_engine {
+
+class IoUringEventHandle;
+
+// Definition of an io_uring based poller.
+//
+// Every handle is registered with a single multishot IORING_OP_POLL_ADD
+// request, which gives edge-triggered readiness notifications equivalent to
+// EPOLLET. Re-arms and the wait for completions are submitted together in one
+// io_uring_enter() call, and each call to Work(...) drains every completion
+// available in the ring, so a single wakeup services many sockets.
+//
+// Only readiness goes through the ring: like with epoll1, the owner of a
+// handle still issues its own read and write syscalls once notified. This
+// replaces epoll_wait and epoll_ctl, not recvmsg and sendmsg.
+class IoUringPoller : public PosixEventPoller {
+ public:
+  // Returns nullptr if the ring cannot be set up, or lacks a feature this
+  // poller relies on.
+  static IoUringPoller* Create(Scheduler* scheduler);
+  EventHandle* CreateHandle(int fd, absl::string_view name,
+                            bool track_err) override;
+  Poller::WorkResult Work(
+      grpc_event_engine::experimental::EventEngine::Duration timeout,
+      absl::FunctionRef<void()> schedule_poll_again) override;
+  std::string Name() override { return "io_uring"; }
+  void Kick() override;
+  Scheduler* GetScheduler() { return scheduler_; }
+  void Shutdown() override;
+  // Returns true if the running kernel supports every io_uring feature this
+  // poller relies on.
+  static bool IsSupported();
+  ~IoUringPoller() override;
+
+ private:
+  explicit IoUringPoller(Scheduler* scheduler);
+  // Sets up the ring and registers the wakeup fd. Returns false on failure,
+  // leaving the poller safe to destroy.
+  bool Init();
+  // This initial vector size may need to be tuned
+  using Events = absl::InlinedVector<IoUringEventHandle*, 5>;
+  friend class IoUringEventHandle;
+#ifdef GRPC_IO_URING_POLLER
+  struct Ring {
+    int ring_fd = -1;
+    // Submission queue, as mapped from the kernel.
+    unsigned* sq_head = nullptr;
+    unsigned* sq_tail = nullptr;
+    unsigned* sq_mask = nullptr;
+    unsigned* sq_array = nullptr;
+    struct io_uring_sqe* sqes = nullptr;
+    // Completion queue, as mapped from the kernel.
+    unsigned* cq_head = nullptr;
+    unsigned* cq_tail = nullptr;
+    unsigned* cq_mask = nullptr;
+    struct io_uring_cqe* cqes = nullptr;
+    // Mappings to release on destruction.
+    void* sq_ring_ptr = nullptr;
+    size_t sq_ring_size = 0;
+    void* cq_ring_ptr = nullptr;
+    size_t cq_ring_size = 0;
+    size_t sqes_size = 0;
+  };
+#else
+  struct Ring {};
+#endif
+  // Queue a request on the submission ring. Returns false if the ring is
+  // full. It is the responsibility of the caller to make sure the request is
+  // eventually submitted with io_uring_enter().
+  bool QueueSqe(uint8_t opcode, int fd, uint64_t user_data, uint64_t addr,
+                uint32_t poll_events, uint32_t len)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(sq_mu_);
+  // Queue a multishot poll request for the fd, flushing the submission ring
+  // first if it is full.
+  void QueuePollAdd(int fd, uint64_t user_data, uint32_t poll_events)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(sq_mu_);
+  // Submit all queued requests without waiting for any completion.
+  void SubmitNow();
+  // Submit all queued requests and wait for at least one completion or until
+  // the timeout expires. Returns the number of completions available in the
+  // ring.
+  int DoIoUringWait(
+      grpc_event_engine::experimental::EventEngine::Duration timeout);
+  // Process all completions currently available in the ring. It returns true
+  // if there was a Kick that forced invocation of this function. It also
+  // returns the list of handles that have pending actions.
+  bool ProcessCompletions(Events& pending_events)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  unsigned NumReadyCompletions();
+
+  absl::Mutex mu_;
+  // Serializes writers of the submission ring.
+  absl::Mutex sq_mu_;
+  Scheduler* scheduler_;
+  Ring ring_;
+  bool was_kicked_ ABSL_GUARDED_BY(mu_);
+  std::list<EventHandle*> free_io_uring_handles_list_ ABSL_GUARDED_BY(mu_);
+  // All handles ever allocated by this poller. Orphaned handles may still be
+  // referenced by in-flight poll requests until the kernel acknowledges their
+  // cancellation, so handle memory is only reclaimed when the poller dies.
+  std::vector<std::unique_ptr<IoUringEventHandle>> all_handles_
+      ABSL_GUARDED_BY(mu_);
+  std::unique_ptr<WakeupFd> wakeup_fd_;
+};
+
+// Return an instance of an io_uring based poller tied to the specified
+// scheduler. Returns nullptr if the running kernel does not support the
+// io_uring features this poller requires.
+IoUringPoller* GetIoUringPoller(Scheduler* scheduler);
+
+}  // namespace posix_engine
+}  // namespace grpc_event_engine
+
+#endif  // GRPC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_EV_IO_URING_LINUX_H
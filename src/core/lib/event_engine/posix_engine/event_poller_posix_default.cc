@@ -18,6 +18,7 @@
 #include "absl/strings/string_view.h"
 
 #include "src/core/lib/event_engine/posix_engine/ev_epoll1_linux.h"
+#include "src/core/lib/event_engine/posix_engine/ev_io_uring_linux.h"
 #include "src/core/lib/event_engine/posix_engine/ev_poll_posix.h"
 #include "src/core/lib/event_engine/posix_engine/event_poller.h"
 #include "src/core/lib/gprpp/global_config.h"
@@ -45,6 +46,10 @@ PosixEventPoller* GetDefaultPoller(Scheduler* scheduler) {
        it++) {
     if (PollStrategyMatches(*it, "epoll1")) {
       poller = GetEpoll1Poller(scheduler);
+    } else if (PollStrategyMatches(*it, "io_uring")) {
+      // Not known to iomgr, so it is usually listed ahead of a fallback
+      // strategy, e.g. GRPC_POLL_STRATEGY=io_uring,epoll1.
+      poller = GetIoUringPoller(scheduler);
     } else if (PollStrategyMatches(*it, "poll")) {
       poller = GetPollPoller(scheduler, /*use_phony_poll=*/false);
     } else if (PollStrategyMatches(*it, "none")) {
@@ -28,6 +28,7 @@
 #include <grpc/support/cpu.h>
 
 #include "src/core/lib/event_engine/posix_engine/timer_heap.h"
+#include "src/core/lib/event_engine/posix_engine/timer_wheel.h"
 #include "src/core/lib/gpr/useful.h"
 #include "src/core/lib/gprpp/time.h"
 
@@ -40,6 +41,13 @@ static const double kMinQueueWindowDuration = 0.01;
 static const double kMaxQueueWindowDuration = 1.0;
 
 grpc_core::Timestamp TimerList::Shard::ComputeMinDeadline() {
+  if (wheel.has_value()) {
+    int64_t next_tick = wheel->NextTick();
+    return next_tick == std::numeric_limits<int64_t>::max()
+               ? grpc_core::Timestamp::InfFuture()
+               : grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(
+                     next_tick);
+  }
   return heap.is_empty()
              ? queue_deadline_cap + grpc_core::Duration::Epsilon()
              : grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(
@@ -49,6 +57,9 @@ grpc_core::Timestamp TimerList::Shard::ComputeMinDeadline() {
 TimerList::Shard::Shard() : stats(1.0 / kAddDeadlineScale, 0.1, 0.5) {}
 
 TimerList::TimerList(TimerListHost* host)
+    : TimerList(host, /*use_timer_wheel=*/false) {}
+
+TimerList::TimerList(TimerListHost* host, bool use_timer_wheel)
     : host_(host),
       num_shards_(grpc_core::Clamp(2 * gpr_cpu_num_cores(), 1u, 32u)),
       min_timer_(host_->Now().milliseconds_after_process_epoch()),
@@ -61,6 +72,9 @@ TimerList::TimerList(TimerListHost* host)
             min_timer_.load(std::memory_order_relaxed));
     shard.shard_queue_index = i;
     shard.list.next = shard.list.prev = &shard.list;
+    if (use_timer_wheel) {
+      shard.wheel.emplace(min_timer_.load(std::memory_order_relaxed));
+    }
     shard.min_deadline = shard.ComputeMinDeadline();
     shard_queue_[i] = &shard;
   }
@@ -124,13 +138,20 @@ void TimerList::TimerInit(Timer* timer, grpc_core::Timestamp deadline,
       deadline = now;
     }
 
-    shard->stats.AddSample((deadline - now).millis() / 1000.0);
-
-    if (deadline < shard->queue_deadline_cap) {
-      is_first_timer = shard->heap.Add(timer);
+    if (shard->wheel.has_value()) {
+      is_first_timer = shard->wheel->Add(timer);
+      // The shard needs attention at the wheel's next tick, which can be
+      // earlier than the deadline of the timer itself.
+      if (is_first_timer) deadline = shard->ComputeMinDeadline();
     } else {
-      timer->heap_index = kInvalidHeapIndex;
-      ListJoin(&shard->list, timer);
+      shard->stats.AddSample((deadline - now).millis() / 1000.0);
+
+      if (deadline < shard->queue_deadline_cap) {
+        is_first_timer = shard->heap.Add(timer);
+      } else {
+        timer->heap_index = kInvalidHeapIndex;
+        ListJoin(&shard->list, timer);
+      }
     }
   }
 
@@ -166,7 +187,9 @@ bool TimerList::TimerCancel(Timer* timer) {
 
   if (timer->pending) {
     timer->pending = false;
-    if (timer->heap_index == kInvalidHeapIndex) {
+    if (shard->wheel.has_value()) {
+      shard->wheel->Remove(timer);
+    } else if (timer->heap_index == kInvalidHeapIndex) {
       ListRemove(timer);
     } else {
       shard->heap.Remove(timer);
@@ -211,6 +234,11 @@ bool TimerList::Shard::RefillHeap(grpc_core::Timestamp now) {
    queue, or returns NULL if there isn't one. */
 Timer* TimerList::Shard::PopOne(grpc_core::Timestamp now) {
   Timer* timer;
+  if (wheel.has_value()) {
+    timer = wheel->PopOne(now.milliseconds_after_process_epoch());
+    if (timer != nullptr) timer->pending = false;
+    return timer;
+  }
   for (;;) {
     if (heap.is_empty()) {
       if (now < queue_deadline_cap) return nullptr;
@@ -34,6 +34,7 @@
 #include <grpc/event_engine/event_engine.h>
 
 #include "src/core/lib/event_engine/posix_engine/timer_heap.h"
+#include "src/core/lib/event_engine/posix_engine/timer_wheel.h"
 #include "src/core/lib/gprpp/sync.h"
 #include "src/core/lib/gprpp/time.h"
 #include "src/core/lib/gprpp/time_averaged_stats.h"
@@ -43,7 +44,8 @@ namespace posix_engine {
 
 struct Timer {
   int64_t deadline;
-  // kInvalidHeapIndex if not in heap.
+  // kInvalidHeapIndex if not in heap. When a TimerWheel is used, this is the
+  // index of the wheel slot holding the timer instead.
   size_t heap_index;
   bool pending;
   struct Timer* next;
@@ -73,6 +75,9 @@ class TimerListHost {
 class TimerList {
  public:
   explicit TimerList(TimerListHost* host);
+  // If use_timer_wheel is true, each shard keeps its timers in a TimerWheel,
+  // giving O(1) TimerInit and TimerCancel, instead of a heap and a list.
+  TimerList(TimerListHost* host, bool use_timer_wheel);
 
   TimerList(const TimerList&) = delete;
   TimerList& operator=(const TimerList&) = delete;
@@ -163,6 +168,8 @@ class TimerList {
     TimerHeap heap ABSL_GUARDED_BY(mu);
     /* This holds timers whose deadline is >= queue_deadline_cap. */
     Timer list ABSL_GUARDED_BY(mu);
+    /* If set, this holds all timers and heap and list are unused. */
+    absl::optional<TimerWheel> wheel ABSL_GUARDED_BY(mu);
   };
 
   void SwapAdjacentShardsInQueue(uint32_t first_shard_queue_index)
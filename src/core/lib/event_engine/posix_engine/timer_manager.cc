@@ -33,6 +33,7 @@
 #include <grpc/support/time.h>
 
 #include "src/core/lib/debug/trace.h"
+#include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/gprpp/thd.h"
 
 static thread_local bool g_timer_thread;
@@ -225,7 +226,8 @@ void TimerManager::Run(grpc_core::Thread thread) {
 bool TimerManager::IsTimerManagerThread() { return g_timer_thread; }
 
 TimerManager::TimerManager() : host_(this) {
-  timer_list_ = absl::make_unique<TimerList>(&host_);
+  timer_list_ = absl::make_unique<TimerList>(&host_,
+                                             grpc_core::IsTimerWheelEnabled());
   grpc_core::MutexLock lock(&mu_);
   StartThread();
 }
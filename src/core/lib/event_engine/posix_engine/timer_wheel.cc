@@ -0,0 +1,192 @@
+// Copyright 2022 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/event_engine/posix_engine/timer_wheel.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "src/core/lib/event_engine/posix_engine/timer.h"
+#include "src/core/lib/gpr/useful.h"
+
+namespace grpc_event_engine {
+namespace posix_engine {
+
+namespace {
+constexpr int64_t kInfinity = std::numeric_limits<int64_t>::max();
+
+// Index of the first set bit of x at or after bit start, wrapping around.
+// x must be non-zero.
+int FirstSetBitFrom(uint64_t x, int start) {
+  uint64_t rotated = start == 0 ? x : (x >> start) | (x << (64 - start));
+  return grpc_core::BitCount((rotated & (~rotated + 1)) - 1);
+}
+}  // namespace
+
+bool TimerWheel::Add(Timer* timer) {
+  const int64_t tick = Place(timer);
+  ++size_;
+  if (tick >= next_tick_) return false;
+  next_tick_ = tick;
+  return true;
+}
+
+void TimerWheel::Remove(Timer* timer) {
+  Unlink(timer);
+  --size_;
+}
+
+Timer* TimerWheel::PopOne(int64_t now) {
+  if (slots_[kExpiredSlot] == nullptr) Advance(now);
+  Timer* timer = slots_[kExpiredSlot];
+  if (timer != nullptr) Remove(timer);
+  // Expired timers are already due.
+  next_tick_ =
+      slots_[kExpiredSlot] != nullptr ? current_ - 1 : NextWheelTick();
+  return timer;
+}
+
+int64_t TimerWheel::NextWheelTick() const {
+  int64_t next = kInfinity;
+  for (int level = 0; level < kLevels; level++) {
+    if (occupied_[level] == 0) continue;
+    const int shift = level * kLevelBits;
+    // The first slot boundary of this level at or after current_.
+    const int64_t first_block = (current_ + (int64_t{1} << shift) - 1) >> shift;
+    const int offset = FirstSetBitFrom(
+        occupied_[level], static_cast<int>(first_block & (kSlotsPerLevel - 1)));
+    next = std::min(next, (first_block + offset) << shift);
+  }
+  if (slots_[kOverflowSlot] != nullptr) {
+    const int shift = (kLevels - 1) * kLevelBits;
+    next = std::min(next, ((current_ + (int64_t{1} << shift) - 1) >> shift)
+                              << shift);
+  }
+  return next;
+}
+
+int64_t TimerWheel::Place(Timer* timer) {
+  const int64_t deadline = std::max(timer->deadline, current_);
+  const uint64_t delta = static_cast<uint64_t>(deadline - current_);
+  for (int level = 0; level < kLevels; level++) {
+    const int shift = level * kLevelBits;
+    if (delta < (uint64_t{1} << (shift + kLevelBits))) {
+      Link(timer, level * kSlotsPerLevel +
+                      ((deadline >> shift) & (kSlotsPerLevel - 1)));
+      // The slot is processed when the wheel reaches its start, which is
+      // never before current_.
+      return (deadline >> shift) << shift;
+    }
+  }
+  Link(timer, kOverflowSlot);
+  const int shift = (kLevels - 1) * kLevelBits;
+  return ((current_ + (int64_t{1} << shift) - 1) >> shift) << shift;
+}
+
+void TimerWheel::Link(Timer* timer, size_t slot) {
+  timer->heap_index = slot;
+  timer->prev = nullptr;
+  timer->next = slots_[slot];
+  if (timer->next != nullptr) timer->next->prev = timer;
+  slots_[slot] = timer;
+  if (slot < kOverflowSlot) {
+    occupied_[slot / kSlotsPerLevel] |= uint64_t{1}
+                                        << (slot % kSlotsPerLevel);
+  }
+}
+
+void TimerWheel::Unlink(Timer* timer) {
+  const size_t slot = timer->heap_index;
+  if (timer->prev != nullptr) {
+    timer->prev->next = timer->next;
+  } else {
+    slots_[slot] = timer->next;
+  }
+  if (timer->next != nullptr) timer->next->prev = timer->prev;
+  if (slots_[slot] == nullptr && slot < kOverflowSlot) {
+    occupied_[slot / kSlotsPerLevel] &=
+        ~(uint64_t{1} << (slot % kSlotsPerLevel));
+  }
+}
+
+Timer* TimerWheel::TakeSlot(size_t slot) {
+  Timer* list = slots_[slot];
+  slots_[slot] = nullptr;
+  if (slot < kOverflowSlot) {
+    occupied_[slot / kSlotsPerLevel] &=
+        ~(uint64_t{1} << (slot % kSlotsPerLevel));
+  }
+  return list;
+}
+
+void TimerWheel::ProcessTick() {
+  const int64_t tick = current_;
+  const int64_t overflow_period = int64_t{1} << ((kLevels - 1) * kLevelBits);
+  if ((tick & (overflow_period - 1)) == 0) {
+    Timer* list = TakeSlot(kOverflowSlot);
+    while (list != nullptr) {
+      Timer* next = list->next;
+      Place(list);
+      list = next;
+    }
+  }
+  // Cascade from the top so that timers moving down several levels at once
+  // land in a slot that is processed later in this same tick.
+  for (int level = kLevels - 1; level > 0; level--) {
+    const int shift = level * kLevelBits;
+    if ((tick & ((int64_t{1} << shift) - 1)) != 0) continue;
+    Timer* list = TakeSlot(level * kSlotsPerLevel +
+                           ((tick >> shift) & (kSlotsPerLevel - 1)));
+    while (list != nullptr) {
+      Timer* next = list->next;
+      Place(list);
+      list = next;
+    }
+  }
+  Timer* list = TakeSlot(tick & (kSlotsPerLevel - 1));
+  while (list != nullptr) {
+    Timer* next = list->next;
+    Link(list, kExpiredSlot);
+    list = next;
+  }
+  current_ = tick + 1;
+}
+
+void TimerWheel::Advance(int64_t now) {
+  if (now == kInfinity) {
+    for (size_t slot = 0; slot < kExpiredSlot; slot++) {
+      Timer* list = TakeSlot(slot);
+      while (list != nullptr) {
+        Timer* next = list->next;
+        Link(list, kExpiredSlot);
+        list = next;
+      }
+    }
+    return;
+  }
+  while (current_ <= now) {
+    const int64_t next = NextWheelTick();
+    if (next > now) {
+      current_ = now + 1;
+      return;
+    }
+    current_ = next;
+    ProcessTick();
+  }
+}
+
+}  // namespace posix_engine
+}  // namespace grpc_event_engine
@@ -0,0 +1,94 @@
+// Copyright 2022 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_TIMER_WHEEL_H
+#define GRPC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_TIMER_WHEEL_H
+
+#include <grpc/support/port_platform.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <limits>
+
+namespace grpc_event_engine {
+namespace posix_engine {
+
+struct Timer;
+
+// A hierarchical timing wheel with millisecond ticks.
+//
+// Level L has 64 slots, each covering 64^L ticks, so four levels cover about
+// 4.6 hours; timers further out wait on an overflow list that is re-examined
+// every 64^3 ticks. Timers are kept in intrusive lists using Timer::next and
+// Timer::prev, with Timer::heap_index holding the slot number, which makes Add
+// and Remove O(1). A timer in an upper level is moved to a lower one when the
+// wheel reaches the start of its slot, so each timer is touched at most once
+// per level during its lifetime, and cancelled timers are never touched again.
+class TimerWheel {
+ public:
+  // now is in milliseconds after the process epoch.
+  explicit TimerWheel(int64_t now) : current_(now) {}
+
+  TimerWheel(const TimerWheel&) = delete;
+  TimerWheel& operator=(const TimerWheel&) = delete;
+
+  // Return true if the timer made NextTick() earlier.
+  bool Add(Timer* timer);
+  void Remove(Timer* timer);
+  // Return a timer whose deadline is <= now, or nullptr if there is none.
+  // A now of INT64_MAX pops every timer.
+  Timer* PopOne(int64_t now);
+  // A lower bound on the earliest tick at which PopOne() may return a timer,
+  // or INT64_MAX if the wheel is empty. Ticks at which timers move between
+  // levels are also reported, and the bound is only recomputed by PopOne(),
+  // so it may be stale after Remove().
+  int64_t NextTick() const { return next_tick_; }
+
+  bool is_empty() const { return size_ == 0; }
+
+ private:
+  static constexpr int kLevelBits = 6;
+  static constexpr size_t kSlotsPerLevel = 1 << kLevelBits;
+  static constexpr int kLevels = 4;
+  static constexpr size_t kOverflowSlot = kLevels * kSlotsPerLevel;
+  static constexpr size_t kExpiredSlot = kOverflowSlot + 1;
+  static constexpr size_t kNumSlots = kExpiredSlot + 1;
+
+  // Insert the timer in the slot matching its deadline relative to current_,
+  // and return the tick at which that slot will be processed.
+  int64_t Place(Timer* timer);
+  void Link(Timer* timer, size_t slot);
+  void Unlink(Timer* timer);
+  Timer* TakeSlot(size_t slot);
+  // Cascade the upper level slots that start at current_, move the expired
+  // level 0 slot to the expired list and advance current_ by one tick.
+  void ProcessTick();
+  // Process every tick up to and including now that has work to do.
+  void Advance(int64_t now);
+  int64_t NextWheelTick() const;
+
+  // The next tick to be processed.
+  int64_t current_;
+  int64_t next_tick_ = std::numeric_limits<int64_t>::max();
+  size_t size_ = 0;
+  // Bit i of occupied_[L] is set iff slot i of level L is non-empty.
+  uint64_t occupied_[kLevels] = {};
+  Timer* slots_[kNumSlots] = {};
+};
+
+}  // namespace posix_engine
+}  // namespace grpc_event_engine
+
+#endif  // GRPC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_TIMER_WHEEL_H
@@ -20,8 +20,10 @@
 
 #include "src/core/lib/event_engine/thread_pool.h"
 
+#include <algorithm>
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include "absl/time/clock.h"
 #include "absl/time/time.h"
@@ -37,8 +39,24 @@ namespace {
 // TODO(drfloob): Remove this, and replace it with the WorkQueue* for the
 // current thread (with nullptr indicating not a threadpool thread).
 thread_local bool g_threadpool_thread;
+// The WorkQueue owned by the current thread, if it belongs to a work stealing
+// pool, and the queue that it was registered with.
+thread_local WorkQueue* g_local_queue;
+thread_local const void* g_local_queue_owner;
+// The queue list that Steal() last scanned on this thread, and its version.
+thread_local std::shared_ptr<const std::vector<std::shared_ptr<WorkQueue>>>
+    g_steal_snapshot;
+thread_local uint64_t g_steal_snapshot_version;
 }  // namespace
 
+ThreadPool::State::State(int reserve_threads, bool work_stealing) {
+  if (work_stealing) {
+    queue = std::make_unique<WorkStealingQueue>(reserve_threads);
+  } else {
+    queue = std::make_unique<GlobalQueue>(reserve_threads);
+  }
+}
+
 void ThreadPool::StartThread(StatePtr state, bool throttled) {
   state->thread_count.Add();
   struct ThreadArg {
@@ -62,12 +80,14 @@ void ThreadPool::StartThread(StatePtr state, bool throttled) {
 }
 
 void ThreadPool::ThreadFunc(StatePtr state) {
-  while (state->queue.Step()) {
+  state->queue->ThreadStart();
+  while (state->queue->Step()) {
   }
+  state->queue->ThreadExit();
   state->thread_count.Remove();
 }
 
-bool ThreadPool::Queue::Step() {
+bool ThreadPool::GlobalQueue::Step() {
   grpc_core::ReleasableMutexLock lock(&mu_);
   // Wait until work is available or we are shutting down.
   while (state_ == State::kRunning && callbacks_.empty()) {
@@ -95,14 +115,18 @@ bool ThreadPool::Queue::Step() {
 }
 
 ThreadPool::ThreadPool(int reserve_threads)
-    : reserve_threads_(reserve_threads) {
+    : ThreadPool(reserve_threads, /*work_stealing=*/false) {}
+
+ThreadPool::ThreadPool(int reserve_threads, bool work_stealing)
+    : reserve_threads_(reserve_threads),
+      state_(std::make_shared<State>(reserve_threads, work_stealing)) {
   for (int i = 0; i < reserve_threads; i++) {
     StartThread(state_, /*throttled=*/false);
   }
 }
 
 ThreadPool::~ThreadPool() {
-  state_->queue.SetShutdown();
+  state_->queue->SetShutdown();
   // Wait until all threads are exited.
   // Note that if this is a threadpool thread then we won't exit this thread
   // until the callstack unwinds a little, so we need to wait for just one
@@ -112,7 +136,7 @@ ThreadPool::~ThreadPool() {
 }
 
 void ThreadPool::Add(absl::AnyInvocable<void()> callback) {
-  if (state_->queue.Add(std::move(callback))) {
+  if (state_->queue->Add(std::move(callback))) {
     if (!state_->currently_starting_one_thread.exchange(
             true, std::memory_order_relaxed)) {
       StartThread(state_, /*throttled=*/true);
@@ -120,7 +144,7 @@ void ThreadPool::Add(absl::AnyInvocable<void()> callback) {
   }
 }
 
-bool ThreadPool::Queue::Add(absl::AnyInvocable<void()> callback) {
+bool ThreadPool::GlobalQueue::Add(absl::AnyInvocable<void()> callback) {
   grpc_core::MutexLock lock(&mu_);
   // Add works to the callbacks list
   callbacks_.push(std::move(callback));
@@ -135,7 +159,7 @@ bool ThreadPool::Queue::Add(absl::AnyInvocable<void()> callback) {
   GPR_UNREACHABLE_CODE(return false);
 }
 
-void ThreadPool::Queue::SetState(State state) {
+void ThreadPool::GlobalQueue::SetState(State state) {
   grpc_core::MutexLock lock(&mu_);
   if (state == State::kRunning) {
     GPR_ASSERT(state_ != State::kRunning);
@@ -146,6 +170,138 @@ void ThreadPool::Queue::SetState(State state) {
   cv_.SignalAll();
 }
 
+template <typename F>
+void ThreadPool::WorkStealingQueue::UpdateThreadQueues(F f) {
+  grpc_core::MutexLock lock(&thread_queues_mu_);
+  auto queues = std::make_shared<std::vector<std::shared_ptr<WorkQueue>>>();
+  if (thread_queues_ != nullptr) *queues = *thread_queues_;
+  f(queues.get());
+  thread_queues_ = std::move(queues);
+  thread_queues_version_.fetch_add(1, std::memory_order_release);
+}
+
+void ThreadPool::WorkStealingQueue::ThreadStart() {
+  GPR_ASSERT(g_local_queue == nullptr);
+  auto queue = std::make_shared<WorkQueue>();
+  g_local_queue = queue.get();
+  g_local_queue_owner = this;
+  UpdateThreadQueues([&queue](std::vector<std::shared_ptr<WorkQueue>>* queues) {
+    queues->push_back(std::move(queue));
+  });
+}
+
+void ThreadPool::WorkStealingQueue::ThreadExit() {
+  // Only this thread adds to its own queue, and Step() only lets a thread exit
+  // once that queue is empty.
+  GPR_ASSERT(g_local_queue->Empty());
+  UpdateThreadQueues([](std::vector<std::shared_ptr<WorkQueue>>* queues) {
+    queues->erase(std::find_if(
+        queues->begin(), queues->end(),
+        [](const std::shared_ptr<WorkQueue>& q) {
+          return q.get() == g_local_queue;
+        }));
+  });
+  g_steal_snapshot.reset();
+  g_local_queue = nullptr;
+  g_local_queue_owner = nullptr;
+}
+
+bool ThreadPool::WorkStealingQueue::Step() {
+  EventEngine::Closure* closure = PopWork(g_local_queue);
+  if (closure == nullptr) {
+    grpc_core::MutexLock lock(&mu_);
+    // Publish that we are about to wait before checking for work again: an
+    // Add() that missed us here is guaranteed to see threads_waiting_ > 0 and
+    // signal.
+    threads_waiting_.fetch_add(1);
+    while ((closure = PopWork(g_local_queue)) == nullptr) {
+      // Pops give up when another thread holds the queue, and pending_ lags
+      // behind callbacks that are queued but not yet counted, so neither says
+      // for certain that there is no work. Our own queue is the exception:
+      // only this thread adds to it, so once it reads empty it stays empty.
+      if (pending_.load() > 0 || !g_local_queue->Empty()) {
+        // Back off until whoever holds the work lets go, rather than spin.
+        cv_.WaitWithTimeout(&mu_, absl::Milliseconds(1));
+        continue;
+      }
+      if (state_.load(std::memory_order_relaxed) != State::kRunning ||
+          threads_waiting_.load(std::memory_order_relaxed) > reserve_threads_) {
+        threads_waiting_.fetch_sub(1, std::memory_order_relaxed);
+        return false;
+      }
+      cv_.Wait(&mu_);
+    }
+    threads_waiting_.fetch_sub(1, std::memory_order_relaxed);
+  }
+  closure->Run();
+  return true;
+}
+
+EventEngine::Closure* ThreadPool::WorkStealingQueue::PopWork(WorkQueue* local) {
+  // The most recently added local callback is the most likely to be cache-hot.
+  EventEngine::Closure* closure = local->PopBack();
+  if (closure == nullptr) closure = global_queue_.PopFront();
+  if (closure == nullptr) closure = Steal(local);
+  if (closure != nullptr) pending_.fetch_sub(1);
+  return closure;
+}
+
+EventEngine::Closure* ThreadPool::WorkStealingQueue::Steal(WorkQueue* local) {
+  // Spread thieves across victims by starting each scan at a different queue.
+  thread_local size_t next_victim = 0;
+  // Only take thread_queues_mu_ when a thread has started or exited since the
+  // last refresh; otherwise scan the cached snapshot without locking.
+  const uint64_t version =
+      thread_queues_version_.load(std::memory_order_acquire);
+  if (g_steal_snapshot == nullptr || g_steal_snapshot_version != version) {
+    grpc_core::MutexLock lock(&thread_queues_mu_);
+    g_steal_snapshot = thread_queues_;
+    g_steal_snapshot_version =
+        thread_queues_version_.load(std::memory_order_relaxed);
+  }
+  const std::vector<std::shared_ptr<WorkQueue>>& queues = *g_steal_snapshot;
+  const size_t n = queues.size();
+  for (size_t i = 0; i < n; i++) {
+    WorkQueue* victim = queues[(next_victim + i) % n].get();
+    if (victim == local || victim->Empty()) continue;
+    EventEngine::Closure* closure = victim->PopFront();
+    if (closure != nullptr) {
+      next_victim += i;
+      return closure;
+    }
+  }
+  next_victim++;
+  return nullptr;
+}
+
+bool ThreadPool::WorkStealingQueue::Add(absl::AnyInvocable<void()> callback) {
+  if (g_local_queue_owner == this) {
+    g_local_queue->Add(std::move(callback));
+  } else {
+    global_queue_.Add(std::move(callback));
+  }
+  // Count the callback only once it is queued, so that a thread woken by a
+  // positive count always has something to pop.
+  pending_.fetch_add(1);
+  if (threads_waiting_.load() > 0) {
+    grpc_core::MutexLock lock(&mu_);
+    cv_.Signal();
+    return false;
+  }
+  return state_.load(std::memory_order_relaxed) != State::kForking;
+}
+
+void ThreadPool::WorkStealingQueue::SetState(State state) {
+  grpc_core::MutexLock lock(&mu_);
+  if (state == State::kRunning) {
+    GPR_ASSERT(state_.load(std::memory_order_relaxed) != State::kRunning);
+  } else {
+    GPR_ASSERT(state_.load(std::memory_order_relaxed) == State::kRunning);
+  }
+  state_.store(state, std::memory_order_relaxed);
+  cv_.SignalAll();
+}
+
 void ThreadPool::ThreadCount::Add() {
   grpc_core::MutexLock lock(&mu_);
   ++threads_;
@@ -175,7 +331,7 @@ void ThreadPool::ThreadCount::BlockUntilThreadCount(int threads,
 }
 
 void ThreadPool::PrepareFork() {
-  state_->queue.SetForking();
+  state_->queue->SetForking();
   state_->thread_count.BlockUntilThreadCount(0, "forking");
 }
 
@@ -184,7 +340,7 @@ void ThreadPool::PostforkParent() { Postfork(); }
 void ThreadPool::PostforkChild() { Postfork(); }
 
 void ThreadPool::Postfork() {
-  state_->queue.Reset();
+  state_->queue->Reset();
   for (int i = 0; i < reserve_threads_; i++) {
     StartThread(state_, /*throttled=*/false);
   }
@@ -21,14 +21,19 @@
 
 #include <grpc/support/port_platform.h>
 
+#include <stddef.h>
+#include <stdint.h>
+
 #include <atomic>
 #include <memory>
 #include <queue>
+#include <vector>
 
 #include "absl/base/thread_annotations.h"
 #include "absl/functional/any_invocable.h"
 
 #include "src/core/lib/event_engine/forkable.h"
+#include "src/core/lib/event_engine/work_queue.h"
 #include "src/core/lib/gprpp/sync.h"
 
 namespace grpc_event_engine {
@@ -37,6 +42,11 @@ namespace experimental {
 class ThreadPool final : public grpc_event_engine::experimental::Forkable {
  public:
   explicit ThreadPool(int reserve_threads);
+  // If work_stealing is true, each thread owns a WorkQueue. Callbacks added
+  // from a pool thread are queued on that thread's WorkQueue, and idle threads
+  // steal work from their peers. Otherwise all callbacks go through a single
+  // shared queue.
+  ThreadPool(int reserve_threads, bool work_stealing);
   // Ensures the thread pool is empty before destroying it.
   ~ThreadPool() override;
 
@@ -51,14 +61,32 @@ class ThreadPool final : public grpc_event_engine::experimental::Forkable {
  private:
   class Queue {
    public:
-    explicit Queue(int reserve_threads) : reserve_threads_(reserve_threads) {}
-    bool Step();
-    void SetShutdown() { SetState(State::kShutdown); }
-    void SetForking() { SetState(State::kForking); }
+    virtual ~Queue() = default;
+    // Called on a new pool thread before its first Step().
+    virtual void ThreadStart() {}
+    // Called on a pool thread after its last Step().
+    virtual void ThreadExit() {}
+    // Run one callback, waiting for one to become available if necessary.
+    // Return false if this thread should exit.
+    virtual bool Step() = 0;
+    virtual void SetShutdown() = 0;
+    virtual void SetForking() = 0;
     // Add a callback to the queue.
     // Return true if we should also spin up a new thread.
-    bool Add(absl::AnyInvocable<void()> callback);
-    void Reset() { SetState(State::kRunning); }
+    virtual bool Add(absl::AnyInvocable<void()> callback) = 0;
+    virtual void Reset() = 0;
+  };
+
+  // A single mutex-protected queue shared by all threads.
+  class GlobalQueue final : public Queue {
+   public:
+    explicit GlobalQueue(int reserve_threads)
+        : reserve_threads_(reserve_threads) {}
+    bool Step() override;
+    void SetShutdown() override { SetState(State::kShutdown); }
+    void SetForking() override { SetState(State::kForking); }
+    bool Add(absl::AnyInvocable<void()> callback) override;
+    void Reset() override { SetState(State::kRunning); }
 
    private:
     enum class State { kRunning, kShutdown, kForking };
@@ -73,6 +101,56 @@ class ThreadPool final : public grpc_event_engine::experimental::Forkable {
     State state_ ABSL_GUARDED_BY(mu_) = State::kRunning;
   };
 
+  // One WorkQueue per thread, plus a global WorkQueue for callbacks added from
+  // outside the pool. Threads run their own most recently added callback
+  // first, then the oldest global callback, and then try to steal the oldest
+  // callback of a peer before going to sleep.
+  class WorkStealingQueue final : public Queue {
+   public:
+    explicit WorkStealingQueue(int reserve_threads)
+        : reserve_threads_(reserve_threads) {}
+    void ThreadStart() override;
+    void ThreadExit() override;
+    bool Step() override;
+    void SetShutdown() override { SetState(State::kShutdown); }
+    void SetForking() override { SetState(State::kForking); }
+    bool Add(absl::AnyInvocable<void()> callback) override;
+    void Reset() override { SetState(State::kRunning); }
+
+   private:
+    enum class State { kRunning, kShutdown, kForking };
+
+    void SetState(State state);
+    // Find a callback to run, looking at the local, global and peer queues in
+    // that order. Returns nullptr if none was found.
+    EventEngine::Closure* PopWork(WorkQueue* local);
+    EventEngine::Closure* Steal(WorkQueue* local);
+    // Replace the published queue list with a copy edited by f.
+    template <typename F>
+    void UpdateThreadQueues(F f);
+
+    WorkQueue global_queue_;
+    // Number of callbacks queued and not yet popped, across all queues. This is
+    // incremented after the callback is queued, so a racing pop may briefly
+    // take it negative, but it is never positive without poppable work.
+    std::atomic<int64_t> pending_{0};
+    std::atomic<int> threads_waiting_{0};
+    const int reserve_threads_;
+    grpc_core::Mutex mu_;
+    grpc_core::CondVar cv_;
+    // Only modified with mu_ held, but read without it in Add().
+    std::atomic<State> state_{State::kRunning};
+    // An immutable snapshot of the queues of all live threads, for stealing.
+    // Thieves hold a reference to the snapshot they scan, so a queue outlives
+    // its thread until no thief can still be looking at it.
+    grpc_core::Mutex thread_queues_mu_;
+    std::shared_ptr<const std::vector<std::shared_ptr<WorkQueue>>>
+        thread_queues_ ABSL_GUARDED_BY(thread_queues_mu_);
+    // Bumped whenever thread_queues_ is replaced, so that thieves only take
+    // thread_queues_mu_ to refresh a stale snapshot.
+    std::atomic<uint64_t> thread_queues_version_{0};
+  };
+
   class ThreadCount {
    public:
     void Add();
@@ -86,8 +164,8 @@ class ThreadPool final : public grpc_event_engine::experimental::Forkable {
   };
 
   struct State {
-    explicit State(int reserve_threads) : queue(reserve_threads) {}
-    Queue queue;
+    State(int reserve_threads, bool work_stealing);
+    std::unique_ptr<Queue> queue;
     ThreadCount thread_count;
     // After pool creation we use this to rate limit creation of threads to one
     // at a time.
@@ -105,7 +183,7 @@ class ThreadPool final : public grpc_event_engine::experimental::Forkable {
   void Postfork();
 
   const int reserve_threads_;
-  const StatePtr state_ = std::make_shared<State>(reserve_threads_);
+  const StatePtr state_;
 };
 
 }  // namespace experimental
@@ -155,6 +155,7 @@ EventEngine::Closure* WorkQueue::PopLocked(bool front)
       ret = std::exchange(most_recent_element_, absl::nullopt);
     }
     most_recent_element_lock_.Unlock();
+    if (!ret.has_value()) return nullptr;
     return ret->closure();
   }
   // the queue has elements, let's pop one and update timestamps
@@ -48,6 +48,14 @@ const char* const description_event_engine_client =
     "Use EventEngine clients instead of iomgr's grpc_tcp_client";
 const char* const description_monitoring_experiment =
     "Placeholder experiment to prove/disprove our monitoring is working";
+const char* const description_work_stealing =
+    "If set, use a work stealing thread pool implementation in EventEngine";
+const char* const description_timer_wheel =
+    "Use a hierarchical timing wheel instead of a heap for timers, making "
+    "timer arm and cancel O(1).";
+const char* const description_small_slice_allocator =
+    "Serve small refcounted slices from per-cpu caches of fixed size blocks "
+    "instead of the system allocator.";
 #ifdef NDEBUG
 const bool kDefaultForDebugOnly = false;
 #else
@@ -73,6 +81,9 @@ const ExperimentMetadata g_experiment_metadata[] = {
      kDefaultForDebugOnly},
     {"event_engine_client", description_event_engine_client, false},
     {"monitoring_experiment", description_monitoring_experiment, true},
+    {"work_stealing", description_work_stealing, false},
+    {"timer_wheel", description_timer_wheel, false},
+    {"small_slice_allocator", description_small_slice_allocator, false},
 };
 
 }  // namespace grpc_core
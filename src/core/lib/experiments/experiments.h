@@ -42,6 +42,9 @@ inline bool IsUnconstrainedMaxQuotaBufferSizeEnabled() {
 inline bool IsNewHpackHuffmanDecoderEnabled() { return IsExperimentEnabled(8); }
 inline bool IsEventEngineClientEnabled() { return IsExperimentEnabled(9); }
 inline bool IsMonitoringExperimentEnabled() { return IsExperimentEnabled(10); }
+inline bool IsWorkStealingEnabled() { return IsExperimentEnabled(11); }
+inline bool IsTimerWheelEnabled() { return IsExperimentEnabled(12); }
+inline bool IsSmallSliceAllocatorEnabled() { return IsExperimentEnabled(13); }
 
 struct ExperimentMetadata {
   const char* name;
@@ -49,7 +52,7 @@ struct ExperimentMetadata {
   bool default_value;
 };
 
-constexpr const size_t kNumExperiments = 11;
+constexpr const size_t kNumExperiments = 14;
 extern const ExperimentMetadata g_experiment_metadata[kNumExperiments];
 
 }  // namespace grpc_core
@@ -38,6 +38,9 @@ typedef struct grpc_tcp_listener {
   unsigned fd_index;
   grpc_closure read_closure;
   grpc_closure destroyed_closure;
+  /* if listeners are sharded, the pollset that this listener's accepted
+     connections are bound to; otherwise nullptr */
+  grpc_pollset* pollset;
   struct grpc_tcp_listener* next;
   /* sibling is a linked list of all listeners for a given port. add_port and
      clone_port place all new listeners in the same sibling list. A member of
@@ -69,6 +72,9 @@ struct grpc_tcp_server {
   bool shutdown_listeners = false;
   /* use SO_REUSEPORT */
   bool so_reuseport = false;
+  /* bind connections to the pollset of the SO_REUSEPORT listener that
+     accepted them */
+  bool shard_listeners = false;
   /* expand wildcard addresses to a list of all local addresses */
   bool expand_wildcard_addrs = false;
 
@@ -116,6 +116,7 @@ static grpc_error_handle add_socket_to_server(grpc_tcp_server* s, int fd,
   sp->port = port;
   sp->port_index = port_index;
   sp->fd_index = fd_index;
+  sp->pollset = nullptr;
   sp->is_sibling = 0;
   sp->sibling = nullptr;
   GPR_ASSERT(sp->emfd);
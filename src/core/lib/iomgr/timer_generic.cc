@@ -30,6 +30,7 @@
 #include <grpc/support/sync.h>
 
 #include "src/core/lib/debug/trace.h"
+#include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/gpr/spinlock.h"
 #include "src/core/lib/gpr/useful.h"
 #include "src/core/lib/gprpp/manual_constructor.h"
@@ -39,6 +40,7 @@
 #include "src/core/lib/iomgr/port.h"
 #include "src/core/lib/iomgr/timer.h"
 #include "src/core/lib/iomgr/timer_heap.h"
+#include "src/core/lib/iomgr/timer_wheel.h"
 
 #define INVALID_HEAP_INDEX 0xffffffffu
 
@@ -57,6 +59,9 @@ grpc_core::TraceFlag grpc_timer_check_trace(false, "timer_check");
  * The 'queue_deadline_cap' gets recomputed periodically based on the timer
  * stats maintained in 'stats' and the relevant timers are then moved from the
  * 'list' to 'heap'.
+ *
+ * When the timer_wheel experiment is enabled, all timers of a shard are kept
+ * in 'wheel' instead and the heap, list and stats are unused.
  */
 struct timer_shard {
   gpr_mu mu;
@@ -72,8 +77,11 @@ struct timer_shard {
   grpc_timer_heap heap;
   /* This holds timers whose deadline is >= queue_deadline_cap. */
   grpc_timer list;
+  /* This holds all timers of the shard when g_use_timer_wheel is set. */
+  grpc_timer_wheel wheel;
 };
 static size_t g_num_shards;
+static bool g_use_timer_wheel;
 
 /* Array of timer shards. Whenever a timer (grpc_timer *) is added, its address
  * is hashed to select the timer shard to add the timer to */
@@ -234,6 +242,13 @@ static grpc_timer_check_result run_some_expired_timers(
     grpc_error_handle error);
 
 static grpc_core::Timestamp compute_min_deadline(timer_shard* shard) {
+  if (g_use_timer_wheel) {
+    int64_t next_tick = grpc_timer_wheel_next_tick(&shard->wheel);
+    return next_tick == INT64_MAX
+               ? grpc_core::Timestamp::InfFuture()
+               : grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(
+                     next_tick);
+  }
   return grpc_timer_heap_is_empty(&shard->heap)
              ? shard->queue_deadline_cap + grpc_core::Duration::Epsilon()
              : grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(
@@ -244,6 +259,7 @@ static void timer_list_init() {
   uint32_t i;
 
   g_num_shards = grpc_core::Clamp(2 * gpr_cpu_num_cores(), 1u, 32u);
+  g_use_timer_wheel = grpc_core::IsTimerWheelEnabled();
   g_shards =
       static_cast<timer_shard*>(gpr_zalloc(g_num_shards * sizeof(*g_shards)));
   g_shard_queue = static_cast<timer_shard**>(
@@ -264,6 +280,9 @@ static void timer_list_init() {
     shard->shard_queue_index = i;
     grpc_timer_heap_init(&shard->heap);
     shard->list.next = shard->list.prev = &shard->list;
+    grpc_timer_wheel_init(
+        &shard->wheel,
+        g_shared_mutables.min_timer.milliseconds_after_process_epoch());
     shard->min_deadline = compute_min_deadline(shard);
     g_shard_queue[i] = shard;
   }
@@ -366,15 +385,20 @@ static void timer_init(grpc_timer* timer, grpc_core::Timestamp deadline,
     return;
   }
 
-  shard->stats->AddSample((deadline - now).millis() / 1000.0);
-
   ADD_TO_HASH_TABLE(timer);
 
-  if (deadline < shard->queue_deadline_cap) {
-    is_first_timer = grpc_timer_heap_add(&shard->heap, timer);
+  if (g_use_timer_wheel) {
+    is_first_timer = grpc_timer_wheel_add(&shard->wheel, timer);
+    /* The shard may now wake up at a cascade tick before the deadline. */
+    if (is_first_timer) deadline = compute_min_deadline(shard);
   } else {
-    timer->heap_index = INVALID_HEAP_INDEX;
-    list_join(&shard->list, timer);
+    shard->stats->AddSample((deadline - now).millis() / 1000.0);
+    if (deadline < shard->queue_deadline_cap) {
+      is_first_timer = grpc_timer_heap_add(&shard->heap, timer);
+    } else {
+      timer->heap_index = INVALID_HEAP_INDEX;
+      list_join(&shard->list, timer);
+    }
   }
   if (GRPC_TRACE_FLAG_ENABLED(grpc_timer_trace)) {
     gpr_log(GPR_INFO,
@@ -452,7 +476,9 @@ static void timer_cancel(grpc_timer* timer) {
     grpc_core::ExecCtx::Run(DEBUG_LOCATION, timer->closure,
                             GRPC_ERROR_CANCELLED);
     timer->pending = false;
-    if (timer->heap_index == INVALID_HEAP_INDEX) {
+    if (g_use_timer_wheel) {
+      grpc_timer_wheel_remove(&shard->wheel, timer);
+    } else if (timer->heap_index == INVALID_HEAP_INDEX) {
       list_remove(timer);
     } else {
       grpc_timer_heap_remove(&shard->heap, timer);
@@ -510,6 +536,17 @@ static bool refill_heap(timer_shard* shard, grpc_core::Timestamp now) {
    REQUIRES: shard->mu locked */
 static grpc_timer* pop_one(timer_shard* shard, grpc_core::Timestamp now) {
   grpc_timer* timer;
+  if (g_use_timer_wheel) {
+    timer = grpc_timer_wheel_pop(&shard->wheel,
+                                 now.milliseconds_after_process_epoch());
+    if (timer == nullptr) return nullptr;
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_timer_trace)) {
+      gpr_log(GPR_INFO, "TIMER %p: FIRE %" PRId64 "ms late", timer,
+              now.milliseconds_after_process_epoch() - timer->deadline);
+    }
+    timer->pending = false;
+    return timer;
+  }
   for (;;) {
     if (GRPC_TRACE_FLAG_ENABLED(grpc_timer_check_trace)) {
       gpr_log(GPR_INFO, "  .. shard[%d]: heap_empty=%s",
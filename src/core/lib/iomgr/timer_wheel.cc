@@ -0,0 +1,214 @@
+/*
+ *
+ * Copyright 2022 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/iomgr/timer_wheel.h"
+
+#include <string.h>
+
+#include "src/core/lib/gpr/useful.h"
+
+#define SLOTS_PER_LEVEL (1 << GRPC_TIMER_WHEEL_LEVEL_BITS)
+#define OVERFLOW_SLOT (GRPC_TIMER_WHEEL_LEVELS * SLOTS_PER_LEVEL)
+#define EXPIRED_SLOT (OVERFLOW_SLOT + 1)
+
+/* Index of the first set bit of x at or after bit start, wrapping around.
+   x must be non-zero. */
+static int first_set_bit_from(uint64_t x, int start) {
+  uint64_t rotated = start == 0 ? x : (x >> start) | (x << (64 - start));
+  return grpc_core::BitCount((rotated & (~rotated + 1)) - 1);
+}
+
+static void link_timer(grpc_timer_wheel* wheel, grpc_timer* timer,
+                       uint32_t slot) {
+  timer->heap_index = slot;
+  timer->prev = nullptr;
+  timer->next = wheel->slots[slot];
+  if (timer->next != nullptr) timer->next->prev = timer;
+  wheel->slots[slot] = timer;
+  if (slot < OVERFLOW_SLOT) {
+    wheel->occupied[slot / SLOTS_PER_LEVEL] |= uint64_t{1}
+                                               << (slot % SLOTS_PER_LEVEL);
+  }
+}
+
+static void unlink_timer(grpc_timer_wheel* wheel, grpc_timer* timer) {
+  uint32_t slot = timer->heap_index;
+  if (timer->prev != nullptr) {
+    timer->prev->next = timer->next;
+  } else {
+    wheel->slots[slot] = timer->next;
+  }
+  if (timer->next != nullptr) timer->next->prev = timer->prev;
+  if (wheel->slots[slot] == nullptr && slot < OVERFLOW_SLOT) {
+    wheel->occupied[slot / SLOTS_PER_LEVEL] &=
+        ~(uint64_t{1} << (slot % SLOTS_PER_LEVEL));
+  }
+}
+
+static grpc_timer* take_slot(grpc_timer_wheel* wheel, uint32_t slot) {
+  grpc_timer* list = wheel->slots[slot];
+  wheel->slots[slot] = nullptr;
+  if (slot < OVERFLOW_SLOT) {
+    wheel->occupied[slot / SLOTS_PER_LEVEL] &=
+        ~(uint64_t{1} << (slot % SLOTS_PER_LEVEL));
+  }
+  return list;
+}
+
+/* Insert the timer in the slot matching its deadline relative to current, and
+   return the tick at which that slot will be processed. */
+static int64_t place_timer(grpc_timer_wheel* wheel, grpc_timer* timer) {
+  int64_t deadline =
+      timer->deadline > wheel->current ? timer->deadline : wheel->current;
+  uint64_t delta = static_cast<uint64_t>(deadline - wheel->current);
+  for (int level = 0; level < GRPC_TIMER_WHEEL_LEVELS; level++) {
+    int shift = level * GRPC_TIMER_WHEEL_LEVEL_BITS;
+    if (delta < (uint64_t{1} << (shift + GRPC_TIMER_WHEEL_LEVEL_BITS))) {
+      link_timer(wheel, timer,
+                 static_cast<uint32_t>(level * SLOTS_PER_LEVEL +
+                                       ((deadline >> shift) &
+                                        (SLOTS_PER_LEVEL - 1))));
+      /* never before current */
+      return (deadline >> shift) << shift;
+    }
+  }
+  link_timer(wheel, timer, OVERFLOW_SLOT);
+  int shift = (GRPC_TIMER_WHEEL_LEVELS - 1) * GRPC_TIMER_WHEEL_LEVEL_BITS;
+  return ((wheel->current + (int64_t{1} << shift) - 1) >> shift) << shift;
+}
+
+static void place_list(grpc_timer_wheel* wheel, grpc_timer* list) {
+  while (list != nullptr) {
+    grpc_timer* next = list->next;
+    place_timer(wheel, list);
+    list = next;
+  }
+}
+
+static void expire_list(grpc_timer_wheel* wheel, grpc_timer* list) {
+  while (list != nullptr) {
+    grpc_timer* next = list->next;
+    link_timer(wheel, list, EXPIRED_SLOT);
+    list = next;
+  }
+}
+
+static int64_t next_wheel_tick(grpc_timer_wheel* wheel) {
+  int64_t next = INT64_MAX;
+  for (int level = 0; level < GRPC_TIMER_WHEEL_LEVELS; level++) {
+    if (wheel->occupied[level] == 0) continue;
+    int shift = level * GRPC_TIMER_WHEEL_LEVEL_BITS;
+    /* the first slot boundary of this level at or after current */
+    int64_t first_block =
+        (wheel->current + (int64_t{1} << shift) - 1) >> shift;
+    int offset = first_set_bit_from(
+        wheel->occupied[level],
+        static_cast<int>(first_block & (SLOTS_PER_LEVEL - 1)));
+    int64_t tick = (first_block + offset) << shift;
+    if (tick < next) next = tick;
+  }
+  if (wheel->slots[OVERFLOW_SLOT] != nullptr) {
+    int shift = (GRPC_TIMER_WHEEL_LEVELS - 1) * GRPC_TIMER_WHEEL_LEVEL_BITS;
+    int64_t tick = ((wheel->current + (int64_t{1} << shift) - 1) >> shift)
+                   << shift;
+    if (tick < next) next = tick;
+  }
+  return next;
+}
+
+/* Cascade the upper level slots that start at current, move the expired level
+   0 slot to the expired list and advance current by one tick. */
+static void process_tick(grpc_timer_wheel* wheel) {
+  int64_t tick = wheel->current;
+  int top_shift = (GRPC_TIMER_WHEEL_LEVELS - 1) * GRPC_TIMER_WHEEL_LEVEL_BITS;
+  if ((tick & ((int64_t{1} << top_shift) - 1)) == 0) {
+    place_list(wheel, take_slot(wheel, OVERFLOW_SLOT));
+  }
+  /* cascade from the top so that timers moving down several levels at once
+     land in a slot that is processed later in this same tick */
+  for (int level = GRPC_TIMER_WHEEL_LEVELS - 1; level > 0; level--) {
+    int shift = level * GRPC_TIMER_WHEEL_LEVEL_BITS;
+    if ((tick & ((int64_t{1} << shift) - 1)) != 0) continue;
+    place_list(wheel, take_slot(wheel, static_cast<uint32_t>(
+                                           level * SLOTS_PER_LEVEL +
+                                           ((tick >> shift) &
+                                            (SLOTS_PER_LEVEL - 1)))));
+  }
+  expire_list(wheel, take_slot(wheel, static_cast<uint32_t>(
+                                          tick & (SLOTS_PER_LEVEL - 1))));
+  wheel->current = tick + 1;
+}
+
+/* Process every tick up to and including now that has work to do. */
+static void advance(grpc_timer_wheel* wheel, int64_t now) {
+  if (now == INT64_MAX) {
+    for (uint32_t slot = 0; slot < EXPIRED_SLOT; slot++) {
+      expire_list(wheel, take_slot(wheel, slot));
+    }
+    return;
+  }
+  while (wheel->current <= now) {
+    int64_t next = next_wheel_tick(wheel);
+    if (next > now) {
+      wheel->current = now + 1;
+      return;
+    }
+    wheel->current = next;
+    process_tick(wheel);
+  }
+}
+
+void grpc_timer_wheel_init(grpc_timer_wheel* wheel, int64_t now) {
+  memset(wheel, 0, sizeof(*wheel));
+  wheel->current = now;
+  wheel->next_tick = INT64_MAX;
+}
+
+bool grpc_timer_wheel_add(grpc_timer_wheel* wheel, grpc_timer* timer) {
+  int64_t tick = place_timer(wheel, timer);
+  ++wheel->size;
+  if (tick >= wheel->next_tick) return false;
+  wheel->next_tick = tick;
+  return true;
+}
+
+void grpc_timer_wheel_remove(grpc_timer_wheel* wheel, grpc_timer* timer) {
+  unlink_timer(wheel, timer);
+  --wheel->size;
+}
+
+grpc_timer* grpc_timer_wheel_pop(grpc_timer_wheel* wheel, int64_t now) {
+  if (wheel->slots[EXPIRED_SLOT] == nullptr) advance(wheel, now);
+  grpc_timer* timer = wheel->slots[EXPIRED_SLOT];
+  if (timer != nullptr) grpc_timer_wheel_remove(wheel, timer);
+  /* expired timers are already due */
+  wheel->next_tick = wheel->slots[EXPIRED_SLOT] != nullptr
+                         ? wheel->current - 1
+                         : next_wheel_tick(wheel);
+  return timer;
+}
+
+int64_t grpc_timer_wheel_next_tick(grpc_timer_wheel* wheel) {
+  return wheel->next_tick;
+}
+
+bool grpc_timer_wheel_is_empty(grpc_timer_wheel* wheel) {
+  return wheel->size == 0;
+}
@@ -0,0 +1,68 @@
+/*
+ *
+ * Copyright 2022 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef GRPC_CORE_LIB_IOMGR_TIMER_WHEEL_H
+#define GRPC_CORE_LIB_IOMGR_TIMER_WHEEL_H
+
+#include <grpc/support/port_platform.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "src/core/lib/iomgr/timer.h"
+
+#define GRPC_TIMER_WHEEL_LEVEL_BITS 6
+#define GRPC_TIMER_WHEEL_LEVELS 4
+/* One list per slot of every level, plus the overflow and expired lists. */
+#define GRPC_TIMER_WHEEL_NUM_SLOTS \
+  ((GRPC_TIMER_WHEEL_LEVELS << GRPC_TIMER_WHEEL_LEVEL_BITS) + 2)
+
+/* A hierarchical timing wheel with millisecond ticks: level L has 64 slots of
+   64^L ticks each, and timers beyond the last level wait on an overflow list.
+   Timers are linked through their next/prev fields and heap_index holds their
+   slot, so adding and removing a timer is O(1). See
+   src/core/lib/event_engine/posix_engine/timer_wheel.h for details. */
+struct grpc_timer_wheel {
+  /* The next tick to be processed. */
+  int64_t current;
+  /* See grpc_timer_wheel_next_tick. */
+  int64_t next_tick;
+  size_t size;
+  /* Bit i of occupied[L] is set iff slot i of level L is non-empty. */
+  uint64_t occupied[GRPC_TIMER_WHEEL_LEVELS];
+  grpc_timer* slots[GRPC_TIMER_WHEEL_NUM_SLOTS];
+};
+
+void grpc_timer_wheel_init(grpc_timer_wheel* wheel, int64_t now);
+
+/* return true if the new timer made grpc_timer_wheel_next_tick() earlier */
+bool grpc_timer_wheel_add(grpc_timer_wheel* wheel, grpc_timer* timer);
+void grpc_timer_wheel_remove(grpc_timer_wheel* wheel, grpc_timer* timer);
+
+/* return a timer with deadline <= now, or NULL if there is none; a now of
+   INT64_MAX pops every timer */
+grpc_timer* grpc_timer_wheel_pop(grpc_timer_wheel* wheel, int64_t now);
+
+/* a lower bound on the earliest tick at which grpc_timer_wheel_pop may return
+   a timer, or INT64_MAX if the wheel is empty; it is only recomputed by
+   grpc_timer_wheel_pop, so it may be stale after grpc_timer_wheel_remove */
+int64_t grpc_timer_wheel_next_tick(grpc_timer_wheel* wheel);
+
+bool grpc_timer_wheel_is_empty(grpc_timer_wheel* wheel);
+
+#endif /* GRPC_CORE_LIB_IOMGR_TIMER_WHEEL_H */
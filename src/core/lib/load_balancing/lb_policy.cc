@@ -67,11 +67,11 @@ LoadBalancingPolicy::PickResult LoadBalancingPolicy::QueuePicker::Pick(
   //    the time this function returns, the pick will already have
   //    been processed, and we'll be trying to re-process the same
   //    pick again, leading to a crash.
-  // 2. We are currently running in the data plane mutex, but we
-  //    need to bounce into the control plane work_serializer to call
-  //    ExitIdleLocked().
-  if (!exit_idle_called_ && parent_ != nullptr) {
-    exit_idle_called_ = true;
+  // 2. We are currently running on the data plane, possibly concurrently
+  //    with other picks, but we need to bounce into the control plane
+  //    work_serializer to call ExitIdleLocked().
+  if (parent_ != nullptr &&
+      !exit_idle_called_.exchange(true, std::memory_order_relaxed)) {
     auto* parent = parent_->Ref().release();  // ref held by lambda.
     ExecCtx::Run(DEBUG_LOCATION,
                  GRPC_CLOSURE_CREATE(
@@ -46,8 +46,10 @@ void* ArenaStorage(size_t initial_size) {
 
 namespace grpc_core {
 
-Arena::~Arena() {
-  Zone* z = last_zone_;
+Arena::~Arena() { FreeZones(); }
+
+void Arena::FreeZones() {
+  Zone* z = last_zone_.exchange(nullptr, std::memory_order_relaxed);
   while (z) {
     Zone* prev_z = z->prev;
     Destruct(z);
@@ -71,7 +73,7 @@ std::pair<Arena*, void*> Arena::CreateWithAlloc(
   return std::make_pair(new_arena, first_alloc);
 }
 
-size_t Arena::Destroy() {
+void Arena::DestroyManagedNewObjects() {
   ManagedNewObject* p;
   // Outer loop: clear the managed new object list.
   // We do this repeatedly in case a destructor ends up allocating something.
@@ -82,6 +84,10 @@ size_t Arena::Destroy() {
       Destruct(std::exchange(p, p->next));
     }
   }
+}
+
+size_t Arena::Destroy() {
+  DestroyManagedNewObjects();
   size_t size = total_used_.load(std::memory_order_relaxed);
   memory_allocator_->Release(total_allocated_.load(std::memory_order_relaxed));
   this->~Arena();
@@ -89,6 +95,22 @@ size_t Arena::Destroy() {
   return size;
 }
 
+size_t Arena::Recycle() {
+  DestroyManagedNewObjects();
+  FreeZones();
+  size_t allocated = total_allocated_.exchange(0, std::memory_order_relaxed);
+  if (allocated != 0) memory_allocator_->Release(allocated);
+  return total_used_.exchange(0, std::memory_order_relaxed);
+}
+
+void* Arena::ReuseWithAlloc(size_t alloc_size) {
+  static constexpr size_t base_size =
+      GPR_ROUND_UP_TO_ALIGNMENT_SIZE(sizeof(Arena));
+  total_used_.store(GPR_ROUND_UP_TO_ALIGNMENT_SIZE(alloc_size),
+                    std::memory_order_relaxed);
+  return reinterpret_cast<char*>(this) + base_size;
+}
+
 void* Arena::AllocZone(size_t size) {
   // If the allocation isn't able to end in the initial zone, create a new
   // zone for this allocation, and any unused space in the initial zone is
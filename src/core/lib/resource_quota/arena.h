@@ -89,6 +89,8 @@ class Arena {
   }
 
  private:
+  friend class ArenaPool;
+
   struct Zone {
     Zone* prev;
   };
@@ -127,6 +129,16 @@ class Arena {
   ~Arena();
 
   void* AllocZone(size_t size);
+  void DestroyManagedNewObjects();
+  void FreeZones();
+
+  // Return the arena to its freshly created state so that the initial zone can
+  // be reused by another call, returning the total number of bytes allocated.
+  // Used by ArenaPool.
+  size_t Recycle();
+  // Begin reusing a recycled arena, as though a call to Alloc() had already
+  // been made for alloc_size bytes; returns that allocation.
+  void* ReuseWithAlloc(size_t alloc_size);
 
   // Keep track of the total used size. We use this in our call sizing
   // hysteresis.
@@ -0,0 +1,136 @@
+// Copyright 2022 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/resource_quota/arena_pool.h"
+
+#include <algorithm>
+
+#include "absl/types/optional.h"
+
+#include "src/core/lib/gpr/alloc.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+
+namespace grpc_core {
+
+constexpr size_t ArenaPool::kMaxArenasPerCpu;
+
+ArenaPool::ArenaPool(MemoryOwner* memory_owner)
+    : state_(std::make_shared<State>(memory_owner)) {}
+
+ArenaPool::~ArenaPool() {
+  MutexLock lock(&state_->mu);
+  state_->shutdown = true;
+  state_->ReleaseAll();
+}
+
+size_t ArenaPool::PooledSize(Arena* arena) {
+  return GPR_ROUND_UP_TO_ALIGNMENT_SIZE(sizeof(Arena)) +
+         GPR_ROUND_UP_TO_ALIGNMENT_SIZE(arena->initial_zone_size_);
+}
+
+void ArenaPool::FreeArena(MemoryOwner* memory_owner, Arena* arena) {
+  const size_t pooled_size = PooledSize(arena);
+  arena->Destroy();
+  memory_owner->Release(pooled_size);
+}
+
+std::pair<Arena*, void*> ArenaPool::CreateWithAlloc(size_t initial_size,
+                                                    size_t alloc_size) {
+  MemoryOwner* memory_owner = state_->memory_owner;
+  if (ExecCtx::Get() != nullptr) {
+    Arena* arena = nullptr;
+    Shard& shard = state_->shards.this_cpu();
+    gpr_spinlock_lock(&shard.lock);
+    if (shard.count > 0) arena = shard.arenas[--shard.count];
+    gpr_spinlock_unlock(&shard.lock);
+    if (arena != nullptr) {
+      // Only reuse arenas that are big enough for the current estimate, but
+      // not so big that we'd waste most of the initial zone.
+      if (arena->initial_zone_size_ >= initial_size &&
+          arena->initial_zone_size_ <= 2 * initial_size &&
+          arena->initial_zone_size_ >= alloc_size) {
+        return std::make_pair(arena, arena->ReuseWithAlloc(alloc_size));
+      }
+      FreeArena(memory_owner, arena);
+    }
+  }
+  // Arenas created by the pool stay charged for their initial zone until they
+  // are finally freed, whether they are in use or idle in the pool.
+  auto arena_with_alloc =
+      Arena::CreateWithAlloc(initial_size, alloc_size, memory_owner);
+  memory_owner->Reserve(PooledSize(arena_with_alloc.first));
+  return arena_with_alloc;
+}
+
+size_t ArenaPool::Destroy(Arena* arena) {
+  size_t used = arena->Recycle();
+  bool pooled = false;
+  if (ExecCtx::Get() != nullptr) {
+    Shard& shard = state_->shards.this_cpu();
+    gpr_spinlock_lock(&shard.lock);
+    if (shard.count < kMaxArenasPerCpu) {
+      shard.arenas[shard.count++] = arena;
+      pooled = true;
+    }
+    gpr_spinlock_unlock(&shard.lock);
+  }
+  if (pooled) {
+    MaybePostReclaimer(state_);
+  } else {
+    FreeArena(state_->memory_owner, arena);
+  }
+  return used;
+}
+
+void ArenaPool::MaybePostReclaimer(const std::shared_ptr<State>& state) {
+  if (state->reclaimer_posted.load(std::memory_order_relaxed) ||
+      state->reclaimer_posted.exchange(true, std::memory_order_acq_rel)) {
+    return;
+  }
+  state->memory_owner->PostReclaimer(
+      ReclamationPass::kBenign,
+      [state](absl::optional<ReclamationSweep> sweep) {
+        MutexLock lock(&state->mu);
+        // Allow the next pooled arena to post a new reclaimer.
+        state->reclaimer_posted.store(false, std::memory_order_release);
+        if (!sweep.has_value() || state->shutdown) return;
+        state->ReleaseAll();
+      });
+}
+
+void ArenaPool::State::ReleaseAll() {
+  for (Shard& shard : shards) {
+    Arena* arenas[kMaxArenasPerCpu];
+    gpr_spinlock_lock(&shard.lock);
+    const size_t count = shard.count;
+    std::copy(shard.arenas, shard.arenas + count, arenas);
+    shard.count = 0;
+    gpr_spinlock_unlock(&shard.lock);
+    for (size_t i = 0; i < count; i++) FreeArena(memory_owner, arenas[i]);
+  }
+}
+
+size_t ArenaPool::TestOnlyPooledArenas() {
+  size_t n = 0;
+  for (Shard& shard : state_->shards) {
+    gpr_spinlock_lock(&shard.lock);
+    n += shard.count;
+    gpr_spinlock_unlock(&shard.lock);
+  }
+  return n;
+}
+
+}  // namespace grpc_core
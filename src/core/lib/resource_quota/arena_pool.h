@@ -0,0 +1,98 @@
+// Copyright 2022 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_CORE_LIB_RESOURCE_QUOTA_ARENA_POOL_H
+#define GRPC_CORE_LIB_RESOURCE_QUOTA_ARENA_POOL_H
+
+#include <grpc/support/port_platform.h>
+
+#include <stddef.h>
+
+#include <atomic>
+#include <memory>
+#include <utility>
+
+#include "absl/base/thread_annotations.h"
+
+#include "src/core/lib/gpr/spinlock.h"
+#include "src/core/lib/gprpp/per_cpu.h"
+#include "src/core/lib/gprpp/sync.h"
+#include "src/core/lib/resource_quota/arena.h"
+#include "src/core/lib/resource_quota/memory_quota.h"
+
+namespace grpc_core {
+
+// Keeps a small per-cpu free list of recycled arenas so that short lived calls
+// can avoid a malloc/free pair for their initial zone.
+// The initial zone of every arena created by the pool is charged to the memory
+// owner until the arena is freed; idle arenas are freed by a benign reclaimer
+// when the quota comes under pressure.
+class ArenaPool {
+ public:
+  // Maximum number of idle arenas kept per cpu.
+  static constexpr size_t kMaxArenasPerCpu = 8;
+
+  // memory_owner must outlive the pool.
+  explicit ArenaPool(MemoryOwner* memory_owner);
+  ~ArenaPool();
+
+  ArenaPool(const ArenaPool&) = delete;
+  ArenaPool& operator=(const ArenaPool&) = delete;
+
+  // As Arena::CreateWithAlloc, but reusing a pooled arena if one with a
+  // suitable initial zone is available.
+  std::pair<Arena*, void*> CreateWithAlloc(size_t initial_size,
+                                           size_t alloc_size);
+
+  // As Arena::Destroy, but returning the arena to the pool if possible.
+  // Returns the total number of bytes allocated from the arena.
+  size_t Destroy(Arena* arena);
+
+  // Number of idle arenas currently held across all cpus.
+  size_t TestOnlyPooledArenas();
+
+ private:
+  // Critical sections are a handful of instructions on a mostly uncontended
+  // per-cpu lock, so a spinlock is used rather than a Mutex.
+  struct Shard {
+    gpr_spinlock lock = GPR_SPINLOCK_INITIALIZER;
+    size_t count = 0;
+    Arena* arenas[kMaxArenasPerCpu];
+  };
+
+  // Shared with the reclaimer, which may run after the pool is destroyed.
+  struct State {
+    explicit State(MemoryOwner* memory_owner) : memory_owner(memory_owner) {}
+
+    // Free every pooled arena, returning their charge to the memory owner.
+    void ReleaseAll() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu);
+
+    MemoryOwner* const memory_owner;
+    PerCpu<Shard> shards;
+    std::atomic<bool> reclaimer_posted{false};
+    Mutex mu;
+    bool shutdown ABSL_GUARDED_BY(mu) = false;
+  };
+
+  // Bytes charged to the memory owner for an arena created by the pool.
+  static size_t PooledSize(Arena* arena);
+  static void FreeArena(MemoryOwner* memory_owner, Arena* arena);
+  static void MaybePostReclaimer(const std::shared_ptr<State>& state);
+
+  std::shared_ptr<State> state_;
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_CORE_LIB_RESOURCE_QUOTA_ARENA_POOL_H
@@ -25,9 +25,12 @@
 #include "absl/status/status.h"
 #include "absl/strings/str_cat.h"
 
+#include <grpc/support/cpu.h>
+
 #include "src/core/lib/debug/trace.h"
 #include "src/core/lib/gpr/useful.h"
 #include "src/core/lib/gprpp/mpscq.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/promise/exec_ctx_wakeup_scheduler.h"
 #include "src/core/lib/promise/loop.h"
 #include "src/core/lib/promise/map.h"
@@ -44,6 +47,8 @@ static constexpr size_t kMaxReplenishBytes = 1024 * 1024;
 // Minimum number of bytes an allocator will request from a quota in one step.
 static constexpr size_t kMinReplenishBytes = 4096;
 
+constexpr size_t BasicMemoryQuota::kMaxPerCpuCacheBytes;
+
 //
 // Reclaimer
 //
@@ -350,6 +355,11 @@ void BasicMemoryQuota::Start() {
         if (self->free_bytes_.load(std::memory_order_acquire) > 0) {
           return Pending{};
         }
+        // Before reclaiming anything, pull back what the per-cpu caches hold.
+        self->DrainPerCpuCaches();
+        if (self->free_bytes_.load(std::memory_order_acquire) > 0) {
+          return Pending{};
+        }
         return 0;
       },
       [self]() {
@@ -406,12 +416,19 @@ void BasicMemoryQuota::Stop() { reclaimer_activity_.reset(); }
 
 void BasicMemoryQuota::SetSize(size_t new_size) {
   size_t old_size = quota_size_.exchange(new_size, std::memory_order_relaxed);
+  // Scale the per-cpu caches so that together they hold at most 1/64th of the
+  // quota.
+  per_cpu_cache_limit_.store(
+      std::min(kMaxPerCpuCacheBytes,
+               new_size / (64 * static_cast<size_t>(gpr_cpu_num_cores()))),
+      std::memory_order_relaxed);
   if (old_size < new_size) {
     // We're growing the quota.
-    Return(new_size - old_size);
+    free_bytes_.fetch_add(new_size - old_size, std::memory_order_relaxed);
   } else {
     // We're shrinking the quota.
-    Take(old_size - new_size);
+    DrainPerCpuCaches();
+    TakeFromQuota(old_size - new_size);
   }
 }
 
@@ -419,6 +436,36 @@ void BasicMemoryQuota::Take(size_t amount) {
   // If there's a request for nothing, then do nothing!
   if (amount == 0) return;
   GPR_DEBUG_ASSERT(amount <= std::numeric_limits<intptr_t>::max());
+  if (ExecCtx::Get() != nullptr) {
+    // Try to satisfy the request from this cpu's cache first.
+    std::atomic<size_t>& cache = per_cpu_cache_.this_cpu().bytes;
+    size_t cached = cache.load(std::memory_order_relaxed);
+    while (cached >= amount) {
+      if (cache.compare_exchange_weak(cached, cached - amount,
+                                      std::memory_order_relaxed,
+                                      std::memory_order_relaxed)) {
+        return;
+      }
+    }
+    // Otherwise refill the cache alongside this request, so long as that
+    // leaves at least a quarter of the quota free.
+    const size_t refill =
+        per_cpu_cache_limit_.load(std::memory_order_relaxed) / 2;
+    if (refill != 0 &&
+        free_bytes_.load(std::memory_order_relaxed) -
+                static_cast<intptr_t>(amount + refill) >
+            static_cast<intptr_t>(quota_size_.load(std::memory_order_relaxed) /
+                                  4)) {
+      TakeFromQuota(amount + refill);
+      cache.fetch_add(refill, std::memory_order_relaxed);
+      return;
+    }
+  }
+  TakeFromQuota(amount);
+}
+
+void BasicMemoryQuota::TakeFromQuota(size_t amount) {
+  if (amount == 0) return;
   // Grab memory from the quota.
   auto prior = free_bytes_.fetch_sub(amount, std::memory_order_acq_rel);
   // If we push into overcommit, awake the reclaimer.
@@ -427,6 +474,13 @@ void BasicMemoryQuota::Take(size_t amount) {
   }
 }
 
+void BasicMemoryQuota::DrainPerCpuCaches() {
+  for (PerCpuCache& cache : per_cpu_cache_) {
+    const size_t bytes = cache.bytes.exchange(0, std::memory_order_relaxed);
+    if (bytes != 0) free_bytes_.fetch_add(bytes, std::memory_order_relaxed);
+  }
+}
+
 void BasicMemoryQuota::FinishReclamation(uint64_t token, Waker waker) {
   uint64_t current = reclamation_counter_.load(std::memory_order_relaxed);
   if (current != token) return;
@@ -446,6 +500,24 @@ void BasicMemoryQuota::FinishReclamation(uint64_t token, Waker waker) {
 }
 
 void BasicMemoryQuota::Return(size_t amount) {
+  // While in overcommit, memory must go straight back to the quota so that the
+  // reclaimer can see it.
+  if (ExecCtx::Get() != nullptr &&
+      free_bytes_.load(std::memory_order_relaxed) > 0) {
+    const size_t limit = per_cpu_cache_limit_.load(std::memory_order_relaxed);
+    std::atomic<size_t>& cache = per_cpu_cache_.this_cpu().bytes;
+    size_t cached = cache.fetch_add(amount, std::memory_order_relaxed) + amount;
+    // Once over the limit, flush back down to half of it.
+    while (cached > limit) {
+      if (cache.compare_exchange_weak(cached, limit / 2,
+                                      std::memory_order_relaxed,
+                                      std::memory_order_relaxed)) {
+        free_bytes_.fetch_add(cached - limit / 2, std::memory_order_relaxed);
+        return;
+      }
+    }
+    return;
+  }
   free_bytes_.fetch_add(amount, std::memory_order_relaxed);
 }
 
@@ -36,6 +36,7 @@
 
 #include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/gprpp/orphanable.h"
+#include "src/core/lib/gprpp/per_cpu.h"
 #include "src/core/lib/gprpp/ref_counted_ptr.h"
 #include "src/core/lib/gprpp/sync.h"
 #include "src/core/lib/gprpp/time.h"
@@ -320,6 +321,23 @@ class BasicMemoryQuota final
   class WaitForSweepPromise;
 
   static constexpr intptr_t kInitialSize = std::numeric_limits<intptr_t>::max();
+  // Upper bound on the bytes cached by any one cpu.
+  static constexpr size_t kMaxPerCpuCacheBytes = 256 * 1024;
+
+  // Bytes taken from free_bytes_ on behalf of allocators running on one cpu,
+  // so that Take/Return from many allocators do not all contend on
+  // free_bytes_.
+  struct PerCpuCache {
+    std::atomic<size_t> bytes{0};
+    // Keep each cpu's counter on its own cacheline.
+    char padding[GPR_CACHELINE_SIZE - sizeof(std::atomic<size_t>)];
+  };
+
+  // Take memory directly from free_bytes_, waking the reclaimer if this
+  // pushes us into overcommit.
+  void TakeFromQuota(size_t amount);
+  // Return all cached bytes to free_bytes_.
+  void DrainPerCpuCaches();
 
   // The amount of memory that's free in this quota.
   // We use intptr_t as a reasonable proxy for ssize_t that's portable.
@@ -342,6 +360,13 @@ class BasicMemoryQuota final
   std::atomic<uint64_t> reclamation_counter_{0};
   // Memory pressure smoothing
   memory_quota_detail::PressureTracker pressure_tracker_;
+  // Per-cpu reservation caches. Bytes held here are counted as used by
+  // GetPressureInfo(); the limit is scaled with the quota size so that, summed
+  // over all cpus, they skew the computed pressure by at most 1/64.
+  // Caches are only refilled while at least a quarter of the quota is free,
+  // and are bypassed and drained when the quota is in overcommit.
+  PerCpu<PerCpuCache> per_cpu_cache_;
+  std::atomic<size_t> per_cpu_cache_limit_{kMaxPerCpuCacheBytes};
   // The name of this quota - used for debugging/tracing/etc..
   std::string name_;
 };
@@ -28,9 +28,11 @@
 #include <grpc/support/alloc.h>
 #include <grpc/support/log.h>
 
+#include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/gprpp/memory.h"
 #include "src/core/lib/slice/slice_internal.h"
 #include "src/core/lib/slice/slice_refcount_base.h"
+#include "src/core/lib/slice/small_slice_allocator.h"
 
 char* grpc_slice_to_c_string(grpc_slice slice) {
   char* out = static_cast<char*>(gpr_malloc(GRPC_SLICE_LENGTH(slice) + 1));
@@ -236,6 +238,9 @@ grpc_slice grpc_slice_malloc(size_t length) {
     slice.refcount = nullptr;
     slice.data.inlined.length = length;
     return slice;
+  } else if (length <= grpc_core::SmallSliceAllocator::kMaxLength &&
+             grpc_core::IsSmallSliceAllocatorEnabled()) {
+    return grpc_core::SmallSliceAllocator::Allocate(length);
   } else {
     return grpc_slice_malloc_large(length);
   }
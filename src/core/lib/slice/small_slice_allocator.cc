@@ -0,0 +1,163 @@
+// Copyright 2022 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/slice/small_slice_allocator.h"
+
+#include <stdint.h>
+
+#include <new>
+#include <utility>
+
+#include <grpc/support/alloc.h>
+#include <grpc/support/cpu.h>
+#include <grpc/support/log.h>
+
+#include "src/core/lib/gpr/spinlock.h"
+
+namespace grpc_core {
+
+constexpr size_t SmallSliceAllocator::kMinBlockSize;
+constexpr size_t SmallSliceAllocator::kMaxBlockSize;
+constexpr size_t SmallSliceAllocator::kMaxLength;
+constexpr size_t SmallSliceAllocator::kMaxCachedBytesPerClass;
+
+namespace {
+
+// Block sizes are kMinBlockSize << size_class.
+constexpr size_t kNumSizeClasses = 4;
+static_assert(SmallSliceAllocator::kMinBlockSize << (kNumSizeClasses - 1) ==
+                  SmallSliceAllocator::kMaxBlockSize,
+              "size classes must cover [kMinBlockSize, kMaxBlockSize]");
+
+constexpr size_t BlockSize(size_t size_class) {
+  return SmallSliceAllocator::kMinBlockSize << size_class;
+}
+
+constexpr size_t MaxCachedBlocks(size_t size_class) {
+  return SmallSliceAllocator::kMaxCachedBytesPerClass / BlockSize(size_class);
+}
+
+size_t SizeClassFor(size_t length) {
+  const size_t block_size = length + sizeof(grpc_slice_refcount);
+  size_t size_class = 0;
+  while (BlockSize(size_class) < block_size) ++size_class;
+  return size_class;
+}
+
+// Idle blocks are threaded through their first word.
+struct FreeBlock {
+  FreeBlock* next;
+};
+
+// Critical sections are a handful of instructions on a mostly uncontended
+// per-cpu lock, so a spinlock is used rather than a Mutex.
+struct Shard {
+  gpr_spinlock lock = GPR_SPINLOCK_INITIALIZER;
+  FreeBlock* free_list[kNumSizeClasses] = {};
+  size_t count[kNumSizeClasses] = {};
+};
+
+// One shard per cpu, never freed. This can't be a PerCpu<> since slices sit
+// below ExecCtx, and there may not be one on the allocating thread anyway.
+Shard* Shards() {
+  static Shard* shards = new Shard[gpr_cpu_num_cores()];
+  return shards;
+}
+
+Shard& ThisCpuShard() { return Shards()[gpr_cpu_current_cpu()]; }
+
+// Destroyer for slices of a given size class: return the block to the free
+// list of the current cpu, or to the system allocator if that list is full.
+template <size_t kSizeClass>
+void FreeBlockOfClass(grpc_slice_refcount* refcount) {
+  refcount->~grpc_slice_refcount();
+  FreeBlock* block = reinterpret_cast<FreeBlock*>(refcount);
+  Shard& shard = ThisCpuShard();
+  gpr_spinlock_lock(&shard.lock);
+  if (shard.count[kSizeClass] < MaxCachedBlocks(kSizeClass)) {
+    block->next = shard.free_list[kSizeClass];
+    shard.free_list[kSizeClass] = block;
+    ++shard.count[kSizeClass];
+    block = nullptr;
+  }
+  gpr_spinlock_unlock(&shard.lock);
+  gpr_free(block);
+}
+
+constexpr grpc_slice_refcount::DestroyerFn kDestroyers[kNumSizeClasses] = {
+    FreeBlockOfClass<0>, FreeBlockOfClass<1>, FreeBlockOfClass<2>,
+    FreeBlockOfClass<3>};
+
+}  // namespace
+
+grpc_slice SmallSliceAllocator::Allocate(size_t length) {
+  GPR_DEBUG_ASSERT(length <= kMaxLength);
+  const size_t size_class = SizeClassFor(length);
+  void* block;
+  Shard& shard = ThisCpuShard();
+  gpr_spinlock_lock(&shard.lock);
+  FreeBlock* free_block = shard.free_list[size_class];
+  if (free_block != nullptr) {
+    shard.free_list[size_class] = free_block->next;
+    --shard.count[size_class];
+  }
+  gpr_spinlock_unlock(&shard.lock);
+  if (free_block != nullptr) {
+    block = free_block;
+  } else {
+    block = gpr_malloc(BlockSize(size_class));
+  }
+  grpc_slice slice;
+  slice.refcount = new (block) grpc_slice_refcount(kDestroyers[size_class]);
+  slice.data.refcounted.bytes =
+      static_cast<uint8_t*>(block) + sizeof(grpc_slice_refcount);
+  slice.data.refcounted.length = length;
+  return slice;
+}
+
+void SmallSliceAllocator::ReleaseCachedBlocks() {
+  Shard* shards = Shards();
+  for (unsigned i = 0; i < gpr_cpu_num_cores(); i++) {
+    FreeBlock* free_lists[kNumSizeClasses];
+    gpr_spinlock_lock(&shards[i].lock);
+    for (size_t size_class = 0; size_class < kNumSizeClasses; size_class++) {
+      free_lists[size_class] = shards[i].free_list[size_class];
+      shards[i].free_list[size_class] = nullptr;
+      shards[i].count[size_class] = 0;
+    }
+    gpr_spinlock_unlock(&shards[i].lock);
+    for (FreeBlock* block : free_lists) {
+      while (block != nullptr) {
+        gpr_free(std::exchange(block, block->next));
+      }
+    }
+  }
+}
+
+size_t SmallSliceAllocator::TestOnlyCachedBlocks() {
+  Shard* shards = Shards();
+  size_t n = 0;
+  for (unsigned i = 0; i < gpr_cpu_num_cores(); i++) {
+    gpr_spinlock_lock(&shards[i].lock);
+    for (size_t size_class = 0; size_class < kNumSizeClasses; size_class++) {
+      n += shards[i].count[size_class];
+    }
+    gpr_spinlock_unlock(&shards[i].lock);
+  }
+  return n;
+}
+
+}  // namespace grpc_core
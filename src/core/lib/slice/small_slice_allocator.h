@@ -0,0 +1,63 @@
+// Copyright 2022 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_CORE_LIB_SLICE_SMALL_SLICE_ALLOCATOR_H
+#define GRPC_CORE_LIB_SLICE_SMALL_SLICE_ALLOCATOR_H
+
+#include <grpc/support/port_platform.h>
+
+#include <stddef.h>
+
+#include <grpc/slice.h>
+
+#include "src/core/lib/slice/slice_refcount_base.h"
+
+namespace grpc_core {
+
+// Allocator for the small refcounted slices that make up most metadata, frame
+// headers and small messages.
+// Each slice is a single block (refcount followed by payload) from one of a
+// few power of two size classes. Freed blocks are kept on a free list for the
+// cpu that frees them and handed to the next allocation of the same class on
+// that cpu, so most small slices never reach the system allocator. Slices may
+// be freed on any thread.
+// Cached blocks are not charged to any resource quota, so the cache is capped
+// per cpu and emptied on grpc_shutdown(). grpc_slice_malloc() only uses this
+// allocator when the small_slice_allocator experiment is enabled.
+class SmallSliceAllocator {
+ public:
+  // Smallest and largest block sizes, including the refcount header.
+  static constexpr size_t kMinBlockSize = 64;
+  static constexpr size_t kMaxBlockSize = 512;
+  // Largest slice length that can be allocated here.
+  static constexpr size_t kMaxLength =
+      kMaxBlockSize - sizeof(grpc_slice_refcount);
+  // Bytes of idle blocks kept per size class per cpu; blocks freed beyond
+  // this go back to the system allocator.
+  static constexpr size_t kMaxCachedBytesPerClass = 32 * 1024;
+
+  // Allocate a refcounted slice of length bytes. length must be at most
+  // kMaxLength.
+  static grpc_slice Allocate(size_t length);
+
+  // Return every idle block on every cpu to the system allocator.
+  static void ReleaseCachedBlocks();
+
+  // Number of idle blocks currently cached across all cpus.
+  static size_t TestOnlyCachedBlocks();
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_CORE_LIB_SLICE_SMALL_SLICE_ALLOCATOR_H
@@ -0,0 +1,86 @@
+//
+// Copyright 2022 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/surface/admission_control.h"
+
+#include <algorithm>
+
+#include "absl/memory/memory.h"
+#include "absl/types/optional.h"
+
+#include <grpc/impl/codegen/grpc_types.h>
+
+#include "src/core/lib/debug/stats.h"
+
+namespace grpc_core {
+
+std::unique_ptr<QueueDelayAdmissionControl>
+QueueDelayAdmissionControl::CreateFromChannelArgs(const ChannelArgs& args) {
+  const Duration target =
+      args.GetDurationFromIntMillis(GRPC_ARG_SERVER_QUEUE_DELAY_TARGET_MS)
+          .value_or(Duration::Zero());
+  if (target <= Duration::Zero()) return nullptr;
+  const Duration interval =
+      std::max(Duration::Milliseconds(1),
+               args.GetDurationFromIntMillis(
+                       GRPC_ARG_SERVER_QUEUE_DELAY_INTERVAL_MS)
+                   .value_or(Duration::Milliseconds(100)));
+  return absl::make_unique<QueueDelayAdmissionControl>(target, interval);
+}
+
+QueueDelayAdmissionControl::QueueDelayAdmissionControl(Duration target,
+                                                       Duration interval)
+    : target_ms_(target.millis()), interval_ms_(interval.millis()) {}
+
+void QueueDelayAdmissionControl::RecordQueueDelay(Duration queue_delay,
+                                                  Timestamp now) {
+  const int64_t delay_ms = queue_delay.millis();
+  const int64_t now_ms = now.milliseconds_after_process_epoch();
+  int64_t interval_end_ms = interval_end_ms_.load(std::memory_order_relaxed);
+  if (now_ms >= interval_end_ms &&
+      interval_end_ms_.compare_exchange_strong(interval_end_ms,
+                                               now_ms + interval_ms_,
+                                               std::memory_order_relaxed)) {
+    // We closed the interval: judge it by its minimum delay, and start the
+    // next interval's minimum from this call.
+    const bool overloaded =
+        min_delay_ms_.exchange(delay_ms, std::memory_order_relaxed) >
+        target_ms_;
+    if (overloaded_.exchange(overloaded, std::memory_order_relaxed) !=
+            overloaded &&
+        overloaded) {
+      GRPC_STATS_INC_SERVER_QUEUE_OVERLOADS();
+    }
+  } else {
+    int64_t min_delay_ms = min_delay_ms_.load(std::memory_order_relaxed);
+    while (delay_ms < min_delay_ms &&
+           !min_delay_ms_.compare_exchange_weak(min_delay_ms, delay_ms,
+                                                std::memory_order_relaxed)) {
+    }
+  }
+}
+
+bool QueueDelayAdmissionControl::ShouldAdmit(Duration queue_delay) {
+  if (ShouldShed(queue_delay.millis())) {
+    GRPC_STATS_INC_SERVER_CALLS_SHED();
+    return false;
+  }
+  return true;
+}
+
+}  // namespace grpc_core
@@ -0,0 +1,92 @@
+//
+// Copyright 2022 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#ifndef GRPC_CORE_LIB_SURFACE_ADMISSION_CONTROL_H
+#define GRPC_CORE_LIB_SURFACE_ADMISSION_CONTROL_H
+
+#include <grpc/support/port_platform.h>
+
+#include <stdint.h>
+
+#include <atomic>
+#include <memory>
+
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/gprpp/time.h"
+
+namespace grpc_core {
+
+// Admission control for calls waiting for a server application to take them,
+// after CoDel (https://queue.acm.org/detail.cfm?id=2209336).
+//
+// The minimum queueing delay is tracked over each interval: if it exceeded the
+// target, no call got through without queueing, so the queue is standing
+// rather than absorbing a burst and the server is considered overloaded for
+// the next interval. While overloaded, calls that have waited more than twice
+// the target are shed, rather than CoDel's dropping at increasing rates; they
+// would most likely miss their deadlines anyway.
+//
+// Thread safe, and lock free.
+class QueueDelayAdmissionControl {
+ public:
+  // Returns null unless GRPC_ARG_SERVER_QUEUE_DELAY_TARGET_MS is positive.
+  static std::unique_ptr<QueueDelayAdmissionControl> CreateFromChannelArgs(
+      const ChannelArgs& args);
+
+  QueueDelayAdmissionControl(Duration target, Duration interval);
+
+  // Records a call leaving the queue at now after waiting queue_delay.
+  // Returns false if the call should be shed instead of run.
+  bool AdmitQueued(Duration queue_delay, Timestamp now) {
+    RecordQueueDelay(queue_delay, now);
+    return ShouldAdmit(queue_delay);
+  }
+
+  // Returns false if a new call should be shed instead of queueing behind a
+  // call that has already waited oldest_queue_delay.
+  bool AdmitNew(Duration oldest_queue_delay) {
+    return ShouldAdmit(oldest_queue_delay);
+  }
+
+  // AdmitQueued() in two steps, for callers that only find out whether a call
+  // can leave the queue after deciding whether to shed it.
+  // Returns false if a call that has waited queue_delay should be shed
+  // instead of run, without recording its delay.
+  bool ShouldAdmit(Duration queue_delay);
+  // Records a call leaving the queue at now after waiting queue_delay.
+  void RecordQueueDelay(Duration queue_delay, Timestamp now);
+
+  bool overloaded() const {
+    return overloaded_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  bool ShouldShed(int64_t queue_delay_ms) const {
+    return overloaded() && queue_delay_ms > 2 * target_ms_;
+  }
+
+  const int64_t target_ms_;
+  const int64_t interval_ms_;
+  // End of the current interval, in milliseconds after the process epoch.
+  std::atomic<int64_t> interval_end_ms_{0};
+  // Minimum queueing delay seen in the current interval.
+  std::atomic<int64_t> min_delay_ms_{0};
+  std::atomic<bool> overloaded_{false};
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_CORE_LIB_SURFACE_ADMISSION_CONTROL_H
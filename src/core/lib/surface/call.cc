@@ -316,6 +316,7 @@ class FilterStackCall final : public Call {
       : Call(arena, args.server_transport_data == nullptr, args.send_deadline),
         cq_(args.cq),
         channel_(args.channel->Ref()),
+        call_size_estimator_(args.call_size_estimator),
         stream_op_payload_(context_) {}
 
   static void ReleaseCall(void* call, grpc_error_handle);
@@ -347,6 +348,8 @@ class FilterStackCall final : public Call {
   grpc_completion_queue* cq_;
   grpc_polling_entity pollent_;
   RefCountedPtr<Channel> channel_;
+  // Sizes this call's arena; updated with the final size on release.
+  CallSizeEstimator* const call_size_estimator_;
   gpr_cycle_counter start_time_ = gpr_get_cycle_counter();
 
   /** has grpc_call_unref been called */
@@ -529,14 +532,17 @@ grpc_error_handle FilterStackCall::Create(grpc_call_create_args* args,
   FilterStackCall* call;
   grpc_error_handle error = GRPC_ERROR_NONE;
   grpc_channel_stack* channel_stack = channel->channel_stack();
-  size_t initial_size = channel->CallSizeEstimate();
+  if (args->call_size_estimator == nullptr) {
+    args->call_size_estimator = channel->call_size_estimator();
+  }
+  size_t initial_size = args->call_size_estimator->CallSizeEstimate();
   GRPC_STATS_INC_CALL_INITIAL_SIZE(initial_size);
   size_t call_alloc_size =
       GPR_ROUND_UP_TO_ALIGNMENT_SIZE(sizeof(FilterStackCall)) +
       channel_stack->call_stack_size;
 
-  std::pair<Arena*, void*> arena_with_call = Arena::CreateWithAlloc(
-      initial_size, call_alloc_size, channel->allocator());
+  std::pair<Arena*, void*> arena_with_call =
+      channel->arena_pool()->CreateWithAlloc(initial_size, call_alloc_size);
   arena = arena_with_call.first;
   call = new (arena_with_call.second) FilterStackCall(arena, *args);
   GPR_DEBUG_ASSERT(FromC(call->c_ptr()) == call);
@@ -633,9 +639,11 @@ void FilterStackCall::SetCompletionQueue(grpc_completion_queue* cq) {
 void FilterStackCall::ReleaseCall(void* call, grpc_error_handle /*error*/) {
   auto* c = static_cast<FilterStackCall*>(call);
   RefCountedPtr<Channel> channel = std::move(c->channel_);
+  CallSizeEstimator* call_size_estimator = c->call_size_estimator_;
   Arena* arena = c->arena();
   c->~FilterStackCall();
-  channel->UpdateCallSizeEstimate(arena->Destroy());
+  call_size_estimator->UpdateCallSizeEstimate(
+      channel->arena_pool()->Destroy(arena));
 }
 
 void FilterStackCall::DestroyCall(void* call, grpc_error_handle /*error*/) {
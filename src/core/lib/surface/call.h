@@ -65,6 +65,10 @@ typedef struct grpc_call_create_args {
   absl::optional<grpc_core::Slice> authority;
 
   grpc_core::Timestamp send_deadline;
+
+  /* if not NULL, used to size the call arena in lieu of the channel's
+     estimator; must outlive the call */
+  grpc_core::CallSizeEstimator* call_size_estimator;
 } grpc_call_create_args;
 
 /* Create a new call based on \a args.
@@ -68,8 +68,8 @@ Channel::Channel(bool is_client, std::string target,
                  RefCountedPtr<grpc_channel_stack> channel_stack)
     : is_client_(is_client),
       compression_options_(compression_options),
-      call_size_estimate_(channel_stack->call_stack_size +
-                          grpc_call_get_initial_size_estimate()),
+      call_size_estimator_(channel_stack->call_stack_size +
+                           grpc_call_get_initial_size_estimate()),
       channelz_node_(channel_args.GetObjectRef<channelz::ChannelNode>()),
       allocator_(channel_args.GetObject<ResourceQuota>()
                      ->memory_quota()
@@ -233,7 +233,7 @@ absl::StatusOr<RefCountedPtr<Channel>> Channel::Create(
   return CreateWithBuilder(&builder);
 }
 
-void Channel::UpdateCallSizeEstimate(size_t size) {
+void CallSizeEstimator::UpdateCallSizeEstimate(size_t size) {
   size_t cur = call_size_estimate_.load(std::memory_order_relaxed);
   if (cur < size) {
     // size grew: update estimate
@@ -286,7 +286,8 @@ static grpc_call* grpc_channel_create_call_internal(
     grpc_channel* c_channel, grpc_call* parent_call, uint32_t propagation_mask,
     grpc_completion_queue* cq, grpc_pollset_set* pollset_set_alternative,
     grpc_core::Slice path, absl::optional<grpc_core::Slice> authority,
-    grpc_core::Timestamp deadline) {
+    grpc_core::Timestamp deadline,
+    grpc_core::CallSizeEstimator* call_size_estimator) {
   auto channel = grpc_core::Channel::FromC(c_channel)->Ref();
   GPR_ASSERT(channel->is_client());
   GPR_ASSERT(!(cq != nullptr && pollset_set_alternative != nullptr));
@@ -302,6 +303,7 @@ static grpc_call* grpc_channel_create_call_internal(
   args.path = std::move(path);
   args.authority = std::move(authority);
   args.send_deadline = deadline;
+  args.call_size_estimator = call_size_estimator;
 
   grpc_call* call;
   GRPC_LOG_IF_ERROR("call_create", grpc_call_create(&args, &call));
@@ -322,7 +324,7 @@ grpc_call* grpc_channel_create_call(grpc_channel* channel,
       grpc_core::Slice(grpc_slice_ref(method)),
       host != nullptr ? absl::optional<grpc_core::Slice>(grpc_slice_ref(*host))
                       : absl::nullopt,
-      grpc_core::Timestamp::FromTimespecRoundUp(deadline));
+      grpc_core::Timestamp::FromTimespecRoundUp(deadline), nullptr);
 
   return call;
 }
@@ -337,12 +339,14 @@ grpc_call* grpc_channel_create_pollset_set_call(
       grpc_core::Slice(method),
       host != nullptr ? absl::optional<grpc_core::Slice>(grpc_slice_ref(*host))
                       : absl::nullopt,
-      deadline);
+      deadline, nullptr);
 }
 
 namespace grpc_core {
 
-RegisteredCall::RegisteredCall(const char* method_arg, const char* host_arg) {
+RegisteredCall::RegisteredCall(const char* method_arg, const char* host_arg,
+                               size_t initial_call_size_estimate)
+    : call_size_estimator(initial_call_size_estimate) {
   path = Slice::FromCopiedString(method_arg);
   if (host_arg != nullptr && host_arg[0] != 0) {
     authority = Slice::FromCopiedString(host_arg);
@@ -350,7 +354,8 @@ RegisteredCall::RegisteredCall(const char* method_arg, const char* host_arg) {
 }
 
 RegisteredCall::RegisteredCall(const RegisteredCall& other)
-    : path(other.path.Ref()) {
+    : path(other.path.Ref()),
+      call_size_estimator(other.call_size_estimator.RawEstimate()) {
   if (other.authority.has_value()) {
     authority = other.authority->Ref();
   }
@@ -383,7 +388,8 @@ RegisteredCall* Channel::RegisterCall(const char* method, const char* host) {
     return &rc_posn->second;
   }
   auto insertion_result = registration_table_.map.insert(
-      {std::move(key), RegisteredCall(method, host)});
+      {std::move(key),
+       RegisteredCall(method, host, call_size_estimator_.RawEstimate())});
   return &insertion_result.first->second;
 }
 
@@ -415,7 +421,8 @@ grpc_call* grpc_channel_create_registered_call(
       rc->authority.has_value()
           ? absl::optional<grpc_core::Slice>(rc->authority->Ref())
           : absl::nullopt,
-      grpc_core::Timestamp::FromTimespecRoundUp(deadline));
+      grpc_core::Timestamp::FromTimespecRoundUp(deadline),
+      &rc->call_size_estimator);
 
   return call;
 }
@@ -51,6 +51,7 @@
 #include "src/core/lib/gprpp/sync.h"
 #include "src/core/lib/gprpp/time.h"
 #include "src/core/lib/iomgr/iomgr_fwd.h"
+#include "src/core/lib/resource_quota/arena_pool.h"
 #include "src/core/lib/resource_quota/memory_quota.h"
 #include "src/core/lib/slice/slice.h"
 #include "src/core/lib/surface/channel_stack_type.h"
@@ -84,11 +85,46 @@ void grpc_channel_update_call_size_estimate(grpc_channel* channel, size_t size);
 
 namespace grpc_core {
 
+// Tracks a moving estimate of how much arena memory a call needs, so that the
+// initial arena zone can be sized to avoid further allocations.
+class CallSizeEstimator {
+ public:
+  explicit CallSizeEstimator(size_t initial_estimate)
+      : call_size_estimate_(initial_estimate) {}
+
+  size_t CallSizeEstimate() {
+    // We round up our current estimate to the NEXT value of kRoundUpSize.
+    // This ensures:
+    //  1. a consistent size allocation when our estimate is drifting slowly
+    //     (which is common) - which tends to help most allocators reuse memory
+    //  2. a small amount of allowed growth over the estimate without hitting
+    //     the arena size doubling case, reducing overall memory usage
+    static constexpr size_t kRoundUpSize = 256;
+    return (call_size_estimate_.load(std::memory_order_relaxed) +
+            2 * kRoundUpSize) &
+           ~(kRoundUpSize - 1);
+  }
+
+  void UpdateCallSizeEstimate(size_t size);
+
+  // Unrounded current estimate.
+  size_t RawEstimate() const {
+    return call_size_estimate_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  std::atomic<size_t> call_size_estimate_;
+};
+
 struct RegisteredCall {
   Slice path;
   absl::optional<Slice> authority;
+  // Calls to a registered method are sized by that method's own history
+  // rather than by the channel wide average.
+  CallSizeEstimator call_size_estimator;
 
-  explicit RegisteredCall(const char* method_arg, const char* host_arg);
+  RegisteredCall(const char* method_arg, const char* host_arg,
+                 size_t initial_call_size_estimate);
   RegisteredCall(const RegisteredCall& other);
   RegisteredCall& operator=(const RegisteredCall&) = delete;
 
@@ -125,21 +161,16 @@ class Channel : public RefCounted<Channel>,
   channelz::ChannelNode* channelz_node() const { return channelz_node_.get(); }
 
   size_t CallSizeEstimate() {
-    // We round up our current estimate to the NEXT value of kRoundUpSize.
-    // This ensures:
-    //  1. a consistent size allocation when our estimate is drifting slowly
-    //     (which is common) - which tends to help most allocators reuse memory
-    //  2. a small amount of allowed growth over the estimate without hitting
-    //     the arena size doubling case, reducing overall memory usage
-    static constexpr size_t kRoundUpSize = 256;
-    return (call_size_estimate_.load(std::memory_order_relaxed) +
-            2 * kRoundUpSize) &
-           ~(kRoundUpSize - 1);
+    return call_size_estimator_.CallSizeEstimate();
   }
-
-  void UpdateCallSizeEstimate(size_t size);
+  void UpdateCallSizeEstimate(size_t size) {
+    call_size_estimator_.UpdateCallSizeEstimate(size);
+  }
+  // Estimator used for calls that have no per-method estimator of their own.
+  CallSizeEstimator* call_size_estimator() { return &call_size_estimator_; }
   absl::string_view target() const { return target_; }
   MemoryAllocator* allocator() { return &allocator_; }
+  ArenaPool* arena_pool() { return &arena_pool_; }
   bool is_client() const { return is_client_; }
   RegisteredCall* RegisterCall(const char* method, const char* host);
 
@@ -160,10 +191,12 @@ class Channel : public RefCounted<Channel>,
 
   const bool is_client_;
   const grpc_compression_options compression_options_;
-  std::atomic<size_t> call_size_estimate_;
+  CallSizeEstimator call_size_estimator_;
   CallRegistrationTable registration_table_;
   RefCountedPtr<channelz::ChannelNode> channelz_node_;
-  MemoryAllocator allocator_;
+  MemoryOwner allocator_;
+  // Recycles call arenas; declared after allocator_, which it charges.
+  ArenaPool arena_pool_{&allocator_};
   std::string target_;
   const RefCountedPtr<grpc_channel_stack> channel_stack_;
 };
@@ -24,6 +24,7 @@
 
 #include <algorithm>
 #include <atomic>
+#include <memory>
 #include <new>
 #include <string>
 #include <utility>
@@ -37,6 +38,7 @@
 #include <grpc/impl/codegen/gpr_types.h>
 #include <grpc/support/alloc.h>
 #include <grpc/support/atm.h>
+#include <grpc/support/cpu.h>
 #include <grpc/support/log.h>
 #include <grpc/support/sync.h>
 
@@ -218,13 +220,21 @@ struct cq_vtable {
 
 namespace {
 
+/* Maximum number of shards in a sharded GRPC_CQ_NEXT queue */
+constexpr size_t kMaxCqEventQueueShards = 16;
+
 /* Queue that holds the cq_completion_events. Internally uses
  * MultiProducerSingleConsumerQueue (a lockfree multiproducer single consumer
  * queue). It uses a queue_lock to support multiple consumers.
+ * A sharded queue has one such queue per cpu (up to kMaxCqEventQueueShards):
+ * producers push to the shard of the cpu they run on, and consumers pop from
+ * their own cpu's shard first before stealing from the others, so that many
+ * consumer threads don't all contend on one queue_lock.
  * Only used in completion queues whose completion_type is GRPC_CQ_NEXT */
 class CqEventQueue {
  public:
-  CqEventQueue() = default;
+  explicit CqEventQueue(size_t num_shards)
+      : num_shards_(num_shards), shards_(new Shard[num_shards]) {}
   ~CqEventQueue() = default;
 
   /* Note: The counter is not incremented/decremented atomically with push/pop.
@@ -237,10 +247,18 @@ class CqEventQueue {
   grpc_cq_completion* Pop();
 
  private:
-  /* Spinlock to serialize consumers i.e pop() operations */
-  gpr_spinlock queue_lock_ = GPR_SPINLOCK_INITIALIZER;
+  struct Shard {
+    /* Spinlock to serialize consumers i.e pop() operations */
+    gpr_spinlock queue_lock = GPR_SPINLOCK_INITIALIZER;
+
+    grpc_core::MultiProducerSingleConsumerQueue queue;
+  };
+
+  /* The shard of the cpu this thread is running on */
+  size_t ThisCpuShard() const;
 
-  grpc_core::MultiProducerSingleConsumerQueue queue_;
+  const size_t num_shards_;
+  std::unique_ptr<Shard[]> shards_;
 
   /* A lazy counter of number of items in the queue. This is NOT atomically
      incremented/decremented along with push/pop operations and hence is only
@@ -249,6 +267,8 @@ class CqEventQueue {
 };
 
 struct cq_next_data {
+  explicit cq_next_data(size_t num_shards) : queue(num_shards) {}
+
   ~cq_next_data() {
     GPR_ASSERT(queue.num_items() == 0);
 #ifndef NDEBUG
@@ -403,6 +423,8 @@ static grpc_event cq_pluck(grpc_completion_queue* cq, void* tag,
 // Note that cq_init_next and cq_init_pluck do not use the shutdown_callback
 static void cq_init_next(void* data,
                          grpc_completion_queue_functor* shutdown_callback);
+static void cq_init_sharded_next(
+    void* data, grpc_completion_queue_functor* shutdown_callback);
 static void cq_init_pluck(void* data,
                           grpc_completion_queue_functor* shutdown_callback);
 static void cq_init_callback(void* data,
@@ -427,6 +449,12 @@ static const cq_vtable g_cq_vtable[] = {
      cq_end_op_for_callback, nullptr, nullptr},
 };
 
+/* Vtable for GRPC_CQ_NEXT queues with a sharded event queue */
+static const cq_vtable g_sharded_next_cq_vtable = {
+    GRPC_CQ_NEXT, sizeof(cq_next_data), cq_init_sharded_next, cq_shutdown_next,
+    cq_destroy_next, cq_begin_op_for_next, cq_end_op_for_next, cq_next,
+    nullptr};
+
 #define DATA_FROM_CQ(cq) ((void*)((cq) + 1))
 #define POLLSET_FROM_CQ(cq) \
   ((grpc_pollset*)((cq)->vtable->data_size + (char*)DATA_FROM_CQ(cq)))
@@ -477,8 +505,16 @@ int grpc_completion_queue_thread_local_cache_flush(grpc_completion_queue* cq,
   return ret;
 }
 
+size_t CqEventQueue::ThisCpuShard() const {
+  if (num_shards_ == 1) return 0;
+  grpc_core::ExecCtx* exec_ctx = grpc_core::ExecCtx::Get();
+  const unsigned cpu = exec_ctx != nullptr ? exec_ctx->starting_cpu()
+                                           : gpr_cpu_current_cpu();
+  return cpu % num_shards_;
+}
+
 bool CqEventQueue::Push(grpc_cq_completion* c) {
-  queue_.Push(
+  shards_[ThisCpuShard()].queue.Push(
       reinterpret_cast<grpc_core::MultiProducerSingleConsumerQueue::Node*>(c));
   return num_queue_items_.fetch_add(1, std::memory_order_relaxed) == 0;
 }
@@ -486,10 +522,19 @@ bool CqEventQueue::Push(grpc_cq_completion* c) {
 grpc_cq_completion* CqEventQueue::Pop() {
   grpc_cq_completion* c = nullptr;
 
-  if (gpr_spinlock_trylock(&queue_lock_)) {
-    bool is_empty = false;
-    c = reinterpret_cast<grpc_cq_completion*>(queue_.PopAndCheckEnd(&is_empty));
-    gpr_spinlock_unlock(&queue_lock_);
+  /* Avoid probing every shard of a sharded queue when it is (most likely)
+     empty; callers already treat a NULL return as possibly spurious */
+  if (num_shards_ > 1 && num_items() == 0) return nullptr;
+
+  const size_t start = ThisCpuShard();
+  for (size_t i = 0; i < num_shards_ && c == nullptr; i++) {
+    Shard& shard = shards_[(start + i) % num_shards_];
+    if (gpr_spinlock_trylock(&shard.queue_lock)) {
+      bool is_empty = false;
+      c = reinterpret_cast<grpc_cq_completion*>(
+          shard.queue.PopAndCheckEnd(&is_empty));
+      gpr_spinlock_unlock(&shard.queue_lock);
+    }
   }
 
   if (c) {
@@ -499,17 +544,12 @@ grpc_cq_completion* CqEventQueue::Pop() {
   return c;
 }
 
-grpc_completion_queue* grpc_completion_queue_create_internal(
-    grpc_cq_completion_type completion_type, grpc_cq_polling_type polling_type,
+static grpc_completion_queue* cq_create(
+    const cq_vtable* vtable, grpc_cq_polling_type polling_type,
     grpc_completion_queue_functor* shutdown_callback) {
   grpc_completion_queue* cq;
 
-  GRPC_API_TRACE(
-      "grpc_completion_queue_create_internal(completion_type=%d, "
-      "polling_type=%d)",
-      2, (completion_type, polling_type));
-
-  switch (completion_type) {
+  switch (vtable->cq_completion_type) {
     case GRPC_CQ_NEXT:
       GRPC_STATS_INC_CQ_NEXT_CREATES();
       break;
@@ -521,7 +561,6 @@ grpc_completion_queue* grpc_completion_queue_create_internal(
       break;
   }
 
-  const cq_vtable* vtable = &g_cq_vtable[completion_type];
   const cq_poller_vtable* poller_vtable =
       &g_poller_vtable_by_poller_type[polling_type];
 
@@ -545,9 +584,34 @@ grpc_completion_queue* grpc_completion_queue_create_internal(
   return cq;
 }
 
+grpc_completion_queue* grpc_completion_queue_create_internal(
+    grpc_cq_completion_type completion_type, grpc_cq_polling_type polling_type,
+    grpc_completion_queue_functor* shutdown_callback) {
+  GRPC_API_TRACE(
+      "grpc_completion_queue_create_internal(completion_type=%d, "
+      "polling_type=%d)",
+      2, (completion_type, polling_type));
+  return cq_create(&g_cq_vtable[completion_type], polling_type,
+                   shutdown_callback);
+}
+
+grpc_completion_queue* grpc_completion_queue_create_sharded_internal(
+    grpc_cq_polling_type polling_type) {
+  GRPC_API_TRACE(
+      "grpc_completion_queue_create_sharded_internal(polling_type=%d)", 1,
+      (polling_type));
+  return cq_create(&g_sharded_next_cq_vtable, polling_type, nullptr);
+}
+
 static void cq_init_next(void* data,
                          grpc_completion_queue_functor* /*shutdown_callback*/) {
-  new (data) cq_next_data();
+  new (data) cq_next_data(1);
+}
+
+static void cq_init_sharded_next(
+    void* data, grpc_completion_queue_functor* /*shutdown_callback*/) {
+  new (data) cq_next_data(
+      std::min<size_t>(gpr_cpu_num_cores(), kMaxCqEventQueueShards));
 }
 
 static void cq_destroy_next(void* data) {
@@ -951,21 +1015,25 @@ static void dump_pending_tags(grpc_completion_queue* cq) {
 static void dump_pending_tags(grpc_completion_queue* /*cq*/) {}
 #endif
 
-static grpc_event cq_next(grpc_completion_queue* cq, gpr_timespec deadline,
-                          void* reserved) {
-  grpc_event ret;
-  cq_next_data* cqd = static_cast<cq_next_data*> DATA_FROM_CQ(cq);
+/* Fill in ev from a popped completion and release the completion */
+static void cq_event_from_completion(grpc_event* ev, grpc_cq_completion* c) {
+  ev->type = GRPC_OP_COMPLETE;
+  ev->success = c->next & 1u;
+  ev->tag = c->tag;
+  c->done(c->done_arg, c);
+}
 
-  GRPC_API_TRACE(
-      "grpc_completion_queue_next("
-      "cq=%p, "
-      "deadline=gpr_timespec { tv_sec: %" PRId64
-      ", tv_nsec: %d, clock_type: %d }, "
-      "reserved=%p)",
-      5,
-      (cq, deadline.tv_sec, deadline.tv_nsec, (int)deadline.clock_type,
-       reserved));
-  GPR_ASSERT(!reserved);
+/* Shared implementation of grpc_completion_queue_next and
+   grpc_completion_queue_next_batch: waits for the first event as
+   grpc_completion_queue_next does, then takes up to max_events - 1 more
+   events that are already queued without polling again. Returns the number
+   of events written to events; if events[0] is not a GRPC_OP_COMPLETE event
+   it is the only one. */
+static int cq_next_events(grpc_completion_queue* cq, grpc_event* events,
+                          int max_events, gpr_timespec deadline) {
+  grpc_event& ret = events[0];
+  int num_events = 1;
+  cq_next_data* cqd = static_cast<cq_next_data*> DATA_FROM_CQ(cq);
 
   dump_pending_tags(cq);
 
@@ -987,20 +1055,14 @@ static grpc_event cq_next(grpc_completion_queue* cq, gpr_timespec deadline,
     if (is_finished_arg.stolen_completion != nullptr) {
       grpc_cq_completion* c = is_finished_arg.stolen_completion;
       is_finished_arg.stolen_completion = nullptr;
-      ret.type = GRPC_OP_COMPLETE;
-      ret.success = c->next & 1u;
-      ret.tag = c->tag;
-      c->done(c->done_arg, c);
+      cq_event_from_completion(&ret, c);
       break;
     }
 
     grpc_cq_completion* c = cqd->queue.Pop();
 
     if (c != nullptr) {
-      ret.type = GRPC_OP_COMPLETE;
-      ret.success = c->next & 1u;
-      ret.tag = c->tag;
-      c->done(c->done_arg, c);
+      cq_event_from_completion(&ret, c);
       break;
     } else {
       /* If c == NULL it means either the queue is empty OR in an transient
@@ -1062,6 +1124,16 @@ static grpc_event cq_next(grpc_completion_queue* cq, gpr_timespec deadline,
     is_finished_arg.first_loop = false;
   }
 
+  /* Events that are already queued are returned alongside the first one,
+     sharing this call's polling, exec_ctx flush and cq refs */
+  if (ret.type == GRPC_OP_COMPLETE) {
+    while (num_events < max_events) {
+      grpc_cq_completion* c = cqd->queue.Pop();
+      if (c == nullptr) break;
+      cq_event_from_completion(&events[num_events++], c);
+    }
+  }
+
   if (cqd->queue.num_items() > 0 &&
       cqd->pending_events.load(std::memory_order_acquire) > 0) {
     gpr_mu_lock(cq->mu);
@@ -1069,11 +1141,31 @@ static grpc_event cq_next(grpc_completion_queue* cq, gpr_timespec deadline,
     gpr_mu_unlock(cq->mu);
   }
 
-  GRPC_SURFACE_TRACE_RETURNED_EVENT(cq, &ret);
+  for (int i = 0; i < num_events; i++) {
+    GRPC_SURFACE_TRACE_RETURNED_EVENT(cq, &events[i]);
+  }
   GRPC_CQ_INTERNAL_UNREF(cq, "next");
 
   GPR_ASSERT(is_finished_arg.stolen_completion == nullptr);
 
+  return num_events;
+}
+
+static grpc_event cq_next(grpc_completion_queue* cq, gpr_timespec deadline,
+                          void* reserved) {
+  GRPC_API_TRACE(
+      "grpc_completion_queue_next("
+      "cq=%p, "
+      "deadline=gpr_timespec { tv_sec: %" PRId64
+      ", tv_nsec: %d, clock_type: %d }, "
+      "reserved=%p)",
+      5,
+      (cq, deadline.tv_sec, deadline.tv_nsec, (int)deadline.clock_type,
+       reserved));
+  GPR_ASSERT(!reserved);
+
+  grpc_event ret;
+  cq_next_events(cq, &ret, 1, deadline);
   return ret;
 }
 
@@ -1124,6 +1216,27 @@ grpc_event grpc_completion_queue_next(grpc_completion_queue* cq,
   return cq->vtable->next(cq, deadline, reserved);
 }
 
+int grpc_completion_queue_next_batch(grpc_completion_queue* cq,
+                                     grpc_event* events, int max_events,
+                                     gpr_timespec deadline, void* reserved) {
+  GRPC_API_TRACE(
+      "grpc_completion_queue_next_batch("
+      "cq=%p, "
+      "events=%p, "
+      "max_events=%d, "
+      "deadline=gpr_timespec { tv_sec: %" PRId64
+      ", tv_nsec: %d, clock_type: %d }, "
+      "reserved=%p)",
+      7,
+      (cq, events, max_events, deadline.tv_sec, deadline.tv_nsec,
+       (int)deadline.clock_type, reserved));
+  GPR_ASSERT(!reserved);
+  GPR_ASSERT(max_events > 0);
+  GPR_ASSERT(cq->vtable->cq_completion_type == GRPC_CQ_NEXT);
+
+  return cq_next_events(cq, events, max_events, deadline);
+}
+
 static int add_plucker(grpc_completion_queue* cq, void* tag,
                        grpc_pollset_worker** worker) {
   cq_pluck_data* cqd = static_cast<cq_pluck_data*> DATA_FROM_CQ(cq);
@@ -97,4 +97,9 @@ grpc_completion_queue* grpc_completion_queue_create_internal(
     grpc_cq_completion_type completion_type, grpc_cq_polling_type polling_type,
     grpc_completion_queue_functor* shutdown_callback);
 
+/* Create a GRPC_CQ_NEXT completion queue whose completed events are queued
+   per cpu, so that many threads can drain it concurrently */
+grpc_completion_queue* grpc_completion_queue_create_sharded_internal(
+    grpc_cq_polling_type polling_type);
+
 #endif /* GRPC_CORE_LIB_SURFACE_COMPLETION_QUEUE_H */
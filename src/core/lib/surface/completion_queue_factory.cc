@@ -42,6 +42,21 @@ static grpc_completion_queue_factory_vtable default_vtable = {default_create};
 static const grpc_completion_queue_factory g_default_cq_factory = {
     "Default Factory", nullptr, &default_vtable};
 
+/*
+ * == Sharded completion queue factory implementation ==
+ */
+
+static grpc_completion_queue* sharded_create(
+    const grpc_completion_queue_factory* /*factory*/,
+    const grpc_completion_queue_attributes* attr) {
+  return grpc_completion_queue_create_sharded_internal(attr->cq_polling_type);
+}
+
+static grpc_completion_queue_factory_vtable sharded_vtable = {sharded_create};
+
+static const grpc_completion_queue_factory g_sharded_cq_factory = {
+    "Sharded Factory", nullptr, &sharded_vtable};
+
 /*
  * == Completion queue factory APIs
  */
@@ -51,8 +66,15 @@ const grpc_completion_queue_factory* grpc_completion_queue_factory_lookup(
   GPR_ASSERT(attributes->version >= 1 &&
              attributes->version <= GRPC_CQ_CURRENT_VERSION);
 
-  /* The default factory can handle version 1 of the attributes structure. We
-     may have to change this as more fields are added to the structure */
+  if (attributes->version >= GRPC_CQ_VERSION_MINIMUM_FOR_SHARDING &&
+      attributes->cq_completion_type == GRPC_CQ_NEXT &&
+      attributes->cq_sharded) {
+    return &g_sharded_cq_factory;
+  }
+
+  /* The default factory can handle versions 1 and 2 of the attributes
+     structure. We may have to change this as more fields are added to the
+     structure */
   return &g_default_cq_factory;
 }
 
@@ -64,7 +86,7 @@ grpc_completion_queue* grpc_completion_queue_create_for_next(void* reserved) {
   grpc_core::ExecCtx exec_ctx;
   GPR_ASSERT(!reserved);
   grpc_completion_queue_attributes attr = {1, GRPC_CQ_NEXT,
-                                           GRPC_CQ_DEFAULT_POLLING, nullptr};
+                                           GRPC_CQ_DEFAULT_POLLING, nullptr, 0};
   return g_default_cq_factory.vtable->create(&g_default_cq_factory, &attr);
 }
 
@@ -72,7 +94,7 @@ grpc_completion_queue* grpc_completion_queue_create_for_pluck(void* reserved) {
   grpc_core::ExecCtx exec_ctx;
   GPR_ASSERT(!reserved);
   grpc_completion_queue_attributes attr = {1, GRPC_CQ_PLUCK,
-                                           GRPC_CQ_DEFAULT_POLLING, nullptr};
+                                           GRPC_CQ_DEFAULT_POLLING, nullptr, 0};
   return g_default_cq_factory.vtable->create(&g_default_cq_factory, &attr);
 }
 
@@ -81,7 +103,7 @@ grpc_completion_queue* grpc_completion_queue_create_for_callback(
   grpc_core::ExecCtx exec_ctx;
   GPR_ASSERT(!reserved);
   grpc_completion_queue_attributes attr = {
-      2, GRPC_CQ_CALLBACK, GRPC_CQ_DEFAULT_POLLING, shutdown_callback};
+      2, GRPC_CQ_CALLBACK, GRPC_CQ_DEFAULT_POLLING, shutdown_callback, 0};
   return g_default_cq_factory.vtable->create(&g_default_cq_factory, &attr);
 }
 
@@ -51,6 +51,7 @@
 #include "src/core/lib/security/credentials/credentials.h"
 #include "src/core/lib/security/security_connector/security_connector.h"
 #include "src/core/lib/security/transport/auth_filters.h"
+#include "src/core/lib/slice/small_slice_allocator.h"
 #include "src/core/lib/surface/api_trace.h"
 #include "src/core/lib/surface/channel_init.h"
 #include "src/core/lib/surface/channel_stack_type.h"
@@ -158,6 +159,7 @@ void grpc_shutdown_internal_locked(void)
     grpc_resolver_dns_ares_shutdown();
     grpc_event_engine::experimental::ResetDefaultEventEngine();
     grpc_iomgr_shutdown();
+    grpc_core::SmallSliceAllocator::ReleaseCachedBlocks();
   }
   g_shutting_down = false;
   g_shutting_down_cv->SignalAll();
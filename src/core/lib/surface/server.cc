@@ -192,12 +192,19 @@ class Server::RequestMatcherInterface {
 // The RealRequestMatcher is an implementation of RequestMatcherInterface that
 // actually uses all the features of RequestMatcherInterface: expecting the
 // application to explicitly request RPCs and then matching those to incoming
-// RPCs, along with a slow path by which incoming RPCs are put on a locked
-// pending list if they aren't able to be matched to an application request.
+// RPCs, along with a slow path by which incoming RPCs are put on a pending
+// list if they aren't able to be matched to an application request.
+//
+// Both halves are sharded by completion queue: requests live on a lock-free
+// queue per cq, and pending calls on a list per cq, each with its own lock,
+// so that admitting new calls on one cq never waits on another.
 class Server::RealRequestMatcher : public RequestMatcherInterface {
  public:
   explicit RealRequestMatcher(Server* server)
-      : server_(server), requests_per_cq_(server->cqs_.size()) {}
+      : server_(server),
+        admission_control_(server->admission_control_.get()),
+        requests_per_cq_(server->cqs_.size()),
+        pending_per_cq_(server->cqs_.size()) {}
 
   ~RealRequestMatcher() override {
     for (LockedMultiProducerSingleConsumerQueue& queue : requests_per_cq_) {
@@ -206,11 +213,15 @@ class Server::RealRequestMatcher : public RequestMatcherInterface {
   }
 
   void ZombifyPending() override {
-    while (!pending_.empty()) {
-      CallData* calld = pending_.front();
-      calld->SetState(CallData::CallState::ZOMBIED);
-      calld->KillZombie();
-      pending_.pop();
+    for (PendingCalls& pending : pending_per_cq_) {
+      MutexLock lock(&pending.mu);
+      while (!pending.calls.empty()) {
+        CallData* calld = pending.calls.front();
+        calld->SetState(CallData::CallState::ZOMBIED);
+        calld->KillZombie();
+        pending.calls.pop();
+        pending_count_.fetch_sub(1, std::memory_order_relaxed);
+      }
     }
   }
 
@@ -231,36 +242,55 @@ class Server::RealRequestMatcher : public RequestMatcherInterface {
 
   void RequestCallWithPossiblePublish(size_t request_queue_index,
                                       RequestedCall* call) override {
-    if (requests_per_cq_[request_queue_index].Push(&call->mpscq_node)) {
-      /* this was the first queued request: we need to lock and start
-         matching calls */
-      struct PendingCall {
+    if (!requests_per_cq_[request_queue_index].Push(&call->mpscq_node)) {
+      return;
+    }
+    // This was the first queued request: match it (and any requests queued
+    // behind it) against pending calls. Pairs with the fence in MatchOrQueue:
+    // either we see the pending call counted, or it sees our request.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (pending_count_.load(std::memory_order_relaxed) == 0) return;
+    // Sweep the pending lists until one full pass finds nothing, starting at
+    // our own cq. Any call counted before the fence above is visible to the
+    // sweep, since calls are counted and listed under their list's lock.
+    const size_t num_cqs = pending_per_cq_.size();
+    bool matched = true;
+    while (matched) {
+      matched = false;
+      for (size_t i = 0; i < num_cqs; i++) {
+        PendingCalls& pending =
+            pending_per_cq_[(request_queue_index + i) % num_cqs];
         RequestedCall* rc = nullptr;
-        CallData* calld;
-      };
-      auto pop_next_pending = [this, request_queue_index] {
-        PendingCall pending_call;
+        CallData* calld = nullptr;
         {
-          MutexLock lock(&server_->mu_call_);
-          if (!pending_.empty()) {
-            pending_call.rc = reinterpret_cast<RequestedCall*>(
+          MutexLock lock(&pending.mu);
+          if (pending.calls.empty()) continue;
+          calld = pending.calls.front();
+          const Timestamp now = ExecCtx::Get()->Now();
+          const Duration queue_delay = now - calld->pending_since();
+          // Calls shed by admission control leave the request for the next.
+          if (admission_control_ == nullptr ||
+              admission_control_->ShouldAdmit(queue_delay)) {
+            rc = reinterpret_cast<RequestedCall*>(
                 requests_per_cq_[request_queue_index].Pop());
-            if (pending_call.rc != nullptr) {
-              pending_call.calld = pending_.front();
-              pending_.pop();
-            }
+            // Out of requests: any later request will sweep again. The call
+            // stays queued, so its delay is not recorded yet.
+            if (rc == nullptr) return;
           }
+          if (admission_control_ != nullptr) {
+            admission_control_->RecordQueueDelay(queue_delay, now);
+          }
+          pending.calls.pop();
+          pending_count_.fetch_sub(1, std::memory_order_relaxed);
         }
-        return pending_call;
-      };
-      while (true) {
-        PendingCall next_pending = pop_next_pending();
-        if (next_pending.rc == nullptr) break;
-        if (!next_pending.calld->MaybeActivate()) {
+        matched = true;
+        if (rc == nullptr) {
+          calld->Shed();
+        } else if (!calld->MaybeActivate()) {
           // Zombied Call
-          next_pending.calld->KillZombie();
+          calld->KillZombie();
         } else {
-          next_pending.calld->Publish(request_queue_index, next_pending.rc);
+          calld->Publish(request_queue_index, rc);
         }
       }
     }
@@ -273,21 +303,24 @@ class Server::RealRequestMatcher : public RequestMatcherInterface {
       RequestedCall* rc =
           reinterpret_cast<RequestedCall*>(requests_per_cq_[cq_idx].TryPop());
       if (rc != nullptr) {
+        RecordUnqueued();
         calld->SetState(CallData::CallState::ACTIVATED);
         calld->Publish(cq_idx, rc);
         return;
       }
     }
-    // No cq to take the request found; queue it on the slow list.
-    // We need to ensure that all the queues are empty.  We do this under
-    // the server mu_call_ lock to ensure that if something is added to
-    // an empty request queue, it will block until the call is actually
-    // added to the pending list.
+    // No cq to take the request found; queue it on the slow list for its cq.
+    // We count the call as pending before making sure that all the request
+    // queues are empty, so that a request added to an empty queue in the
+    // meantime is either found here or goes looking for this call.
     RequestedCall* rc = nullptr;
     size_t cq_idx = 0;
     size_t loop_count;
     {
-      MutexLock lock(&server_->mu_call_);
+      PendingCalls& pending = pending_per_cq_[start_request_queue_index];
+      MutexLock lock(&pending.mu);
+      pending_count_.fetch_add(1, std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_seq_cst);
       for (loop_count = 0; loop_count < requests_per_cq_.size(); loop_count++) {
         cq_idx =
             (start_request_queue_index + loop_count) % requests_per_cq_.size();
@@ -297,11 +330,24 @@ class Server::RealRequestMatcher : public RequestMatcherInterface {
         }
       }
       if (rc == nullptr) {
-        calld->SetState(CallData::CallState::PENDING);
-        pending_.push(calld);
-        return;
+        // Don't queue behind calls that are due to be shed.
+        if (admission_control_ == nullptr || pending.calls.empty() ||
+            admission_control_->AdmitNew(
+                ExecCtx::Get()->Now() -
+                pending.calls.front()->pending_since())) {
+          calld->SetState(CallData::CallState::PENDING);
+          calld->set_pending_since(ExecCtx::Get()->Now());
+          pending.calls.push(calld);
+          return;
+        }
       }
+      pending_count_.fetch_sub(1, std::memory_order_relaxed);
     }
+    if (rc == nullptr) {
+      calld->Shed();
+      return;
+    }
+    RecordUnqueued();
     calld->SetState(CallData::CallState::ACTIVATED);
     calld->Publish(cq_idx, rc);
   }
@@ -309,9 +355,24 @@ class Server::RealRequestMatcher : public RequestMatcherInterface {
   Server* server() const override { return server_; }
 
  private:
+  struct PendingCalls {
+    Mutex mu;
+    std::queue<CallData*> calls ABSL_GUARDED_BY(mu);
+  };
+
+  // Tells admission control about a call that was matched without queueing.
+  void RecordUnqueued() {
+    if (admission_control_ != nullptr) {
+      admission_control_->AdmitQueued(Duration::Zero(), ExecCtx::Get()->Now());
+    }
+  }
+
   Server* const server_;
-  std::queue<CallData*> pending_;
+  QueueDelayAdmissionControl* const admission_control_;
   std::vector<LockedMultiProducerSingleConsumerQueue> requests_per_cq_;
+  std::vector<PendingCalls> pending_per_cq_;
+  // Number of calls on (or about to be put on) any of the pending lists.
+  std::atomic<size_t> pending_count_{0};
 };
 
 // AllocatingRequestMatchers don't allow the application to request an RPC in
@@ -534,7 +595,10 @@ RefCountedPtr<channelz::ServerNode> CreateChannelzNode(
 }  // namespace
 
 Server::Server(const ChannelArgs& args)
-    : channel_args_(args), channelz_node_(CreateChannelzNode(args)) {}
+    : channel_args_(args),
+      channelz_node_(CreateChannelzNode(args)),
+      admission_control_(
+          QueueDelayAdmissionControl::CreateFromChannelArgs(args)) {}
 
 Server::~Server() {
   // Remove the cq pollsets from the config_fetcher.
@@ -1020,12 +1084,14 @@ void Server::ChannelData::InitTransport(RefCountedPtr<Server> server,
   if (num_registered_methods > 0) {
     uint32_t max_probes = 0;
     size_t slots = 2 * num_registered_methods;
+    bool any_host = false;
     registered_methods_ =
         absl::make_unique<std::vector<ChannelRegisteredMethod>>(slots);
     for (std::unique_ptr<RegisteredMethod>& rm : server_->registered_methods_) {
       Slice host;
       Slice method = Slice::FromExternalString(rm->method);
       const bool has_host = !rm->host.empty();
+      any_host |= has_host;
       if (has_host) {
         host = Slice::FromExternalString(rm->host.c_str());
       }
@@ -1048,6 +1114,15 @@ void Server::ChannelData::InitTransport(RefCountedPtr<Server> server,
     }
     GPR_ASSERT(slots <= UINT32_MAX);
     registered_method_max_probes_ = max_probes;
+    // With no per-host methods the path alone picks the method, so lookups
+    // can be cached by path.
+    if (!any_host) {
+      registered_method_cache_size_ =
+          RoundUpToPowerOf2(static_cast<uint32_t>(slots));
+      registered_method_cache_ =
+          absl::make_unique<std::atomic<ChannelRegisteredMethod*>[]>(
+              registered_method_cache_size_);
+    }
   }
   // Publish channel.
   {
@@ -1071,6 +1146,17 @@ void Server::ChannelData::InitTransport(RefCountedPtr<Server> server,
 Server::ChannelRegisteredMethod* Server::ChannelData::GetRegisteredMethod(
     const grpc_slice& host, const grpc_slice& path) {
   if (registered_methods_ == nullptr) return nullptr;
+  // Paths repeated on a connection usually come from the transport's header
+  // table (e.g. the HPACK dynamic table), and so share their storage: try the
+  // method last seen at this path's address before hashing its contents.
+  std::atomic<ChannelRegisteredMethod*>* cached = nullptr;
+  if (registered_method_cache_ != nullptr) {
+    cached = &registered_method_cache_[HashPointer(
+        GRPC_SLICE_START_PTR(path), registered_method_cache_size_)];
+    ChannelRegisteredMethod* rm = cached->load(std::memory_order_relaxed);
+    // The cache is only a hint: the path's contents decide.
+    if (rm != nullptr && rm->method == path) return rm;
+  }
   /* TODO(ctiller): unify these two searches */
   /* check for an exact match with host */
   uint32_t hash = MixHash32(grpc_slice_hash(host), grpc_slice_hash(path));
@@ -1091,6 +1177,7 @@ Server::ChannelRegisteredMethod* Server::ChannelData::GetRegisteredMethod(
     if (rm->server_registered_method == nullptr) break;
     if (rm->has_host) continue;
     if (rm->method != path) continue;
+    if (cached != nullptr) cached->store(rm, std::memory_order_relaxed);
     return rm;
   }
   return nullptr;
@@ -1109,6 +1196,9 @@ void Server::ChannelData::AcceptStream(void* arg, grpc_transport* /*transport*/,
   args.pollset_set_alternative = nullptr;
   args.server_transport_data = transport_server_data;
   args.send_deadline = Timestamp::InfFuture();
+  // The method is not known until initial metadata arrives, so server calls
+  // are sized by the channel wide estimate.
+  args.call_size_estimator = nullptr;
   grpc_call* call;
   grpc_error_handle error = grpc_call_create(&args, &call);
   grpc_call_element* elem =
@@ -1278,6 +1368,13 @@ void KillZombieClosure(void* call, grpc_error_handle /*error*/) {
   grpc_call_unref(static_cast<grpc_call*>(call));
 }
 
+void ShedCallClosure(void* call, grpc_error_handle /*error*/) {
+  grpc_call_cancel_with_status(static_cast<grpc_call*>(call),
+                               GRPC_STATUS_RESOURCE_EXHAUSTED,
+                               "Server queueing delay too high", nullptr);
+  grpc_call_unref(static_cast<grpc_call*>(call));
+}
+
 }  // namespace
 
 void Server::CallData::KillZombie() {
@@ -1286,6 +1383,17 @@ void Server::CallData::KillZombie() {
   ExecCtx::Run(DEBUG_LOCATION, &kill_zombie_closure_, GRPC_ERROR_NONE);
 }
 
+void Server::CallData::Shed() {
+  if (state_.exchange(CallState::ZOMBIED, std::memory_order_acq_rel) ==
+      CallState::ZOMBIED) {
+    KillZombie();
+    return;
+  }
+  GRPC_CLOSURE_INIT(&kill_zombie_closure_, ShedCallClosure, call_,
+                    grpc_schedule_on_exec_ctx);
+  ExecCtx::Run(DEBUG_LOCATION, &kill_zombie_closure_, GRPC_ERROR_NONE);
+}
+
 void Server::CallData::StartNewRpc(grpc_call_element* elem) {
   auto* chand = static_cast<ChannelData*>(elem->channel_data);
   if (server_->ShutdownCalled()) {
@@ -59,6 +59,7 @@
 #include "src/core/lib/iomgr/error.h"
 #include "src/core/lib/iomgr/iomgr_fwd.h"
 #include "src/core/lib/slice/slice.h"
+#include "src/core/lib/surface/admission_control.h"
 #include "src/core/lib/surface/channel.h"
 #include "src/core/lib/surface/completion_queue.h"
 #include "src/core/lib/transport/metadata_batch.h"
@@ -261,6 +262,13 @@ class Server : public InternallyRefCounted<Server>,
     // use, etc.)
     std::unique_ptr<std::vector<ChannelRegisteredMethod>> registered_methods_;
     uint32_t registered_method_max_probes_;
+    // Registered methods last found for paths at a given address, indexed by
+    // a hash of the address. Only used when no method is registered per host.
+    // Sized to a power of two at least twice the number of registered methods,
+    // so that hot paths rarely evict each other.
+    std::unique_ptr<std::atomic<ChannelRegisteredMethod*>[]>
+        registered_method_cache_;
+    size_t registered_method_cache_size_ = 0;
     grpc_closure finish_destroy_channel_closure_;
     intptr_t channelz_socket_uuid_;
   };
@@ -294,8 +302,18 @@ class Server : public InternallyRefCounted<Server>,
 
     void KillZombie();
 
+    // Fails a call that was never published with RESOURCE_EXHAUSTED, or just
+    // destroys it if it was zombied.
+    void Shed();
+
     void FailCallCreation();
 
+    // When the call was put on a pending list.
+    Timestamp pending_since() const { return pending_since_; }
+    void set_pending_since(Timestamp pending_since) {
+      pending_since_ = pending_since;
+    }
+
     // Filter vtable functions.
     static grpc_error_handle InitCallElement(
         grpc_call_element* elem, const grpc_call_element_args* args);
@@ -327,6 +345,7 @@ class Server : public InternallyRefCounted<Server>,
     absl::optional<Slice> path_;
     absl::optional<Slice> host_;
     Timestamp deadline_ = Timestamp::InfFuture();
+    Timestamp pending_since_;
 
     grpc_completion_queue* cq_new_ = nullptr;
 
@@ -443,6 +462,8 @@ class Server : public InternallyRefCounted<Server>,
 
   ChannelArgs const channel_args_;
   RefCountedPtr<channelz::ServerNode> channelz_node_;
+  // Null unless queue delay admission control is enabled.
+  const std::unique_ptr<QueueDelayAdmissionControl> admission_control_;
   std::unique_ptr<grpc_server_config_fetcher> config_fetcher_;
 
   std::vector<grpc_completion_queue*> cqs_;
@@ -452,6 +473,8 @@ class Server : public InternallyRefCounted<Server>,
   // The two following mutexes control access to server-state.
   // mu_global_ controls access to non-call-related state (e.g., channel state).
   // mu_call_ controls access to call-related state (e.g., the call lists).
+  // The request matchers' pending call lists are locked per cq, and those
+  // locks nest inside mu_call_.
   //
   // If they are ever required to be nested, you must lock mu_global_
   // before mu_call_. This is currently used in shutdown processing
@@ -20,6 +20,8 @@
 
 #include "src/core/lib/surface/validate_metadata.h"
 
+#include <string.h>
+
 #include "absl/strings/string_view.h"
 
 #include <grpc/grpc.h>
@@ -29,11 +31,51 @@
 #include "src/core/lib/gprpp/memory.h"
 #include "src/core/lib/iomgr/error.h"
 
+namespace {
+// Keys and values are checked eight bytes at a time. With the high bit of each
+// byte cleared, adding 0x80 - lo to a byte carries into its high bit exactly
+// when the byte is at least lo, and never into the next byte: so one addition
+// range checks a whole word.
+constexpr uint64_t kLowBits = 0x0101010101010101u;
+constexpr uint64_t kHighBits = 0x8080808080808080u;
+
+// Sets the high bit of each byte of w that is at least lo. The high bits of w
+// must be clear.
+constexpr uint64_t BytesAtLeast(uint64_t w, uint8_t lo) {
+  return (w + kLowBits * (0x80 - lo)) & kHighBits;
+}
+
+// Sets the high bit of each byte of w in [lo, hi]. The high bits of w must be
+// clear.
+constexpr uint64_t BytesInRange(uint64_t w, uint8_t lo, uint8_t hi) {
+  return BytesAtLeast(w, lo) & ~BytesAtLeast(w, hi + 1);
+}
+}  // namespace
+
+// LegalBits::LegalBytes must flag the same (ASCII) bytes as legal_bits.
+template <typename LegalBits>
+static bool all_legal(const uint8_t* p, const uint8_t* e,
+                      const LegalBits& legal_bits) {
+  uint64_t illegal = 0;
+  for (; e - p >= 8; p += 8) {
+    uint64_t w;
+    memcpy(&w, p, sizeof(w));
+    illegal |= (w & kHighBits) | ~LegalBits::LegalBytes(w & ~kHighBits);
+  }
+  if ((illegal & kHighBits) != 0) return false;
+  for (; p != e; p++) {
+    if (!legal_bits.is_set(*p)) return false;
+  }
+  return true;
+}
+
+template <typename LegalBits>
 static grpc_error_handle conforms_to(const grpc_slice& slice,
-                                     const grpc_core::BitSet<256>& legal_bits,
+                                     const LegalBits& legal_bits,
                                      const char* err_desc) {
   const uint8_t* p = GRPC_SLICE_START_PTR(slice);
   const uint8_t* e = GRPC_SLICE_END_PTR(slice);
+  if (GPR_LIKELY(all_legal(p, e, legal_bits))) return GRPC_ERROR_NONE;
   for (; p != e; p++) {
     if (!legal_bits.is_set(*p)) {
       size_t len;
@@ -67,6 +109,10 @@ class LegalHeaderKeyBits : public grpc_core::BitSet<256> {
     set('_');
     set('.');
   }
+  static uint64_t LegalBytes(uint64_t w) {
+    return BytesInRange(w, 'a', 'z') | BytesInRange(w, '0', '9') |
+           BytesInRange(w, '-', '.') | BytesInRange(w, '_', '_');
+  }
 };
 constexpr LegalHeaderKeyBits g_legal_header_key_bits;
 }  // namespace
@@ -99,6 +145,7 @@ class LegalHeaderNonBinValueBits : public grpc_core::BitSet<256> {
       set(i);
     }
   }
+  static uint64_t LegalBytes(uint64_t w) { return BytesInRange(w, 32, 126); }
 };
 constexpr LegalHeaderNonBinValueBits g_legal_header_non_bin_value_bits;
 }  // namespace
@@ -263,7 +263,7 @@ class ShutdownCallback : public grpc_completion_queue_functor {
       auto* shutdown_callback = new ShutdownCallback;
       callback_cq = new grpc::CompletionQueue(grpc_completion_queue_attributes{
           GRPC_CQ_CURRENT_VERSION, GRPC_CQ_CALLBACK, GRPC_CQ_DEFAULT_POLLING,
-          shutdown_callback});
+          shutdown_callback, 0});
 
       // Transfer ownership of the new cq to its own shutdown callback
       shutdown_callback->TakeCQ(callback_cq);
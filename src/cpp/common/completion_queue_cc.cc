@@ -15,6 +15,7 @@
  *
  */
 
+#include <algorithm>
 #include <vector>
 
 #include "absl/base/thread_annotations.h"
@@ -39,6 +40,9 @@ namespace {
 
 internal::GrpcLibraryInitializer g_gli_initializer;
 
+// Events read per grpc_completion_queue_next_batch call in NextBatch.
+constexpr int kMaxNextBatchEvents = 64;
+
 gpr_once g_once_init_callback_alternative = GPR_ONCE_INIT;
 grpc_core::Mutex* g_callback_alternative_mu;
 
@@ -167,6 +171,32 @@ CompletionQueue::NextStatus CompletionQueue::AsyncNextInternal(
   }
 }
 
+int CompletionQueue::NextBatch(void** tags, bool* oks, int max_events) {
+  GPR_ASSERT(max_events > 0);
+  grpc_event events[kMaxNextBatchEvents];
+  const int batch_size = std::min(max_events, kMaxNextBatchEvents);
+  for (;;) {
+    const int num_events = grpc_completion_queue_next_batch(
+        cq_, events, batch_size, gpr_inf_future(GPR_CLOCK_REALTIME), nullptr);
+    // As for Next, a timeout with an infinite deadline means the queue has
+    // been shut down.
+    if (events[0].type != GRPC_OP_COMPLETE) return 0;
+    int num_results = 0;
+    for (int i = 0; i < num_events; i++) {
+      auto core_cq_tag =
+          static_cast<grpc::internal::CompletionQueueTag*>(events[i].tag);
+      void* tag = core_cq_tag;
+      bool ok = events[i].success != 0;
+      if (core_cq_tag->FinalizeResult(&tag, &ok)) {
+        tags[num_results] = tag;
+        oks[num_results] = ok;
+        num_results++;
+      }
+    }
+    if (num_results > 0) return num_results;
+  }
+}
+
 CompletionQueue::CompletionQueueTLSCache::CompletionQueueTLSCache(
     CompletionQueue* cq)
     : cq_(cq), flushed_(false) {
@@ -70,10 +70,12 @@
 
 #include "src/core/ext/transport/inproc/inproc_transport.h"
 #include "src/core/lib/gprpp/manual_constructor.h"
+#include "src/core/lib/gprpp/time.h"
 #include "src/core/lib/iomgr/error.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/iomgr/iomgr.h"
 #include "src/core/lib/resource_quota/api.h"
+#include "src/core/lib/surface/admission_control.h"
 #include "src/core/lib/surface/completion_queue.h"
 #include "src/core/lib/surface/server.h"
 #include "src/cpp/client/create_channel_internal.h"
@@ -95,6 +97,10 @@ namespace {
 // because the server threadpool is full.
 const char* kServerThreadpoolExhausted = "Server Threadpool Exhausted";
 
+// Status error message for calls shed because they queued for too long waiting
+// for a sync server thread.
+const char* kServerQueueDelayExceeded = "Server Queueing Delay Exceeded";
+
 // Although we might like to give a useful status error message on unimplemented
 // RPCs, it's not always possible since that also would need to be added across
 // languages and isn't actually required by the spec.
@@ -405,8 +411,10 @@ class Server::SyncRequest final : public grpc::internal::CompletionQueueTag {
     return true;
   }
 
+  // Runs the call with handler, which is either the method's handler or one
+  // that fails the call.
   void Run(const std::shared_ptr<GlobalCallbacks>& global_callbacks,
-           bool resources) {
+           grpc::internal::MethodHandler* handler) {
     ctx_.Init(deadline_, &request_metadata_);
     wrapped_call_.Init(
         call_, server_, &cq_, server_->max_receive_message_size(),
@@ -417,7 +425,7 @@ class Server::SyncRequest final : public grpc::internal::CompletionQueueTag {
     request_metadata_.count = 0;
 
     global_callbacks_ = global_callbacks;
-    resources_ = resources;
+    handler_ = handler;
 
     interceptor_methods_.SetCall(&*wrapped_call_);
     interceptor_methods_.SetReverse();
@@ -428,10 +436,8 @@ class Server::SyncRequest final : public grpc::internal::CompletionQueueTag {
 
     if (has_request_payload_) {
       // Set interception point for RECV MESSAGE
-      auto* handler = resources_ ? method_->handler()
-                                 : server_->resource_exhausted_handler_.get();
-      deserialized_request_ = handler->Deserialize(call_, request_payload_,
-                                                   &request_status_, nullptr);
+      deserialized_request_ = handler_->Deserialize(call_, request_payload_,
+                                                    &request_status_, nullptr);
       if (!request_status_.ok()) {
         gpr_log(GPR_DEBUG, "Failed to deserialize message.");
       }
@@ -453,9 +459,7 @@ class Server::SyncRequest final : public grpc::internal::CompletionQueueTag {
   void ContinueRunAfterInterception() {
     ctx_->ctx.BeginCompletionOp(&*wrapped_call_, nullptr, nullptr);
     global_callbacks_->PreSynchronousRequest(&ctx_->ctx);
-    auto* handler = resources_ ? method_->handler()
-                               : server_->resource_exhausted_handler_.get();
-    handler->RunHandler(grpc::internal::MethodHandler::HandlerParameter(
+    handler_->RunHandler(grpc::internal::MethodHandler::HandlerParameter(
         &*wrapped_call_, &ctx_->ctx, deserialized_request_, request_status_,
         nullptr, nullptr));
     global_callbacks_->PostSynchronousRequest(&ctx_->ctx);
@@ -476,6 +480,11 @@ class Server::SyncRequest final : public grpc::internal::CompletionQueueTag {
     delete this;
   }
 
+  grpc::internal::RpcServiceMethod* method() const { return method_; }
+
+  // When the call was allocated, as it arrived at the server.
+  grpc_core::Timestamp created() const { return created_; }
+
   // For requests that must be only cleaned up but not actually Run
   void Cleanup() {
     cq_.Shutdown();
@@ -514,7 +523,8 @@ class Server::SyncRequest final : public grpc::internal::CompletionQueueTag {
   grpc::CompletionQueue cq_;
   grpc::Status request_status_;
   std::shared_ptr<GlobalCallbacks> global_callbacks_;
-  bool resources_;
+  grpc::internal::MethodHandler* handler_;
+  const grpc_core::Timestamp created_ = grpc_core::Timestamp::Now();
   void* deserialized_request_ = nullptr;
   grpc::internal::InterceptorBatchMethodsImpl interceptor_methods_;
 
@@ -773,15 +783,19 @@ const char* Server::CallbackRequest<
 // appropriate RPC handlers
 class Server::SyncRequestThreadManager : public grpc::ThreadManager {
  public:
-  SyncRequestThreadManager(Server* server, grpc::CompletionQueue* server_cq,
-                           std::shared_ptr<GlobalCallbacks> global_callbacks,
-                           grpc_resource_quota* rq, int min_pollers,
-                           int max_pollers, int cq_timeout_msec)
+  SyncRequestThreadManager(
+      Server* server, grpc::CompletionQueue* server_cq,
+      std::shared_ptr<GlobalCallbacks> global_callbacks,
+      grpc_resource_quota* rq, int min_pollers, int max_pollers,
+      int cq_timeout_msec,
+      std::unique_ptr<grpc_core::QueueDelayAdmissionControl> admission_control)
       : ThreadManager("SyncServer", rq, min_pollers, max_pollers),
         server_(server),
         server_cq_(server_cq),
         cq_timeout_msec_(cq_timeout_msec),
-        global_callbacks_(std::move(global_callbacks)) {}
+        global_callbacks_(std::move(global_callbacks)),
+        admission_control_(std::move(admission_control)),
+        queue_delay_exceeded_handler_(kServerQueueDelayExceeded) {}
 
   WorkStatus PollForWork(void** tag, bool* ok) override {
     *tag = nullptr;
@@ -812,7 +826,17 @@ class Server::SyncRequestThreadManager : public grpc::ThreadManager {
     GPR_DEBUG_ASSERT(sync_req != nullptr);
     GPR_DEBUG_ASSERT(ok);
 
-    sync_req->Run(global_callbacks_, resources);
+    grpc::internal::MethodHandler* handler =
+        resources ? sync_req->method()->handler()
+                  : server_->resource_exhausted_handler_.get();
+    if (resources && admission_control_ != nullptr) {
+      grpc_core::ExecCtx exec_ctx;
+      grpc_core::Timestamp now = exec_ctx.Now();
+      if (!admission_control_->AdmitQueued(now - sync_req->created(), now)) {
+        handler = &queue_delay_exceeded_handler_;
+      }
+    }
+    sync_req->Run(global_callbacks_, handler);
   }
 
   void AddSyncMethod(grpc::internal::RpcServiceMethod* method, void* tag) {
@@ -869,6 +893,10 @@ class Server::SyncRequestThreadManager : public grpc::ThreadManager {
   bool has_sync_method_ = false;
   std::unique_ptr<grpc::internal::RpcServiceMethod> unknown_method_;
   std::shared_ptr<Server::GlobalCallbacks> global_callbacks_;
+  // Sheds calls that waited too long for a thread, if configured.
+  const std::unique_ptr<grpc_core::QueueDelayAdmissionControl>
+      admission_control_;
+  grpc::internal::ResourceExhaustedHandler queue_delay_exceeded_handler_;
 };
 
 static grpc::internal::GrpcLibraryInitializer g_gli_initializer;
@@ -899,6 +927,13 @@ Server::Server(
   global_callbacks_ = grpc::g_callbacks;
   global_callbacks_->UpdateArguments(args);
 
+  for (auto& acceptor : acceptors_) {
+    acceptor->SetToChannelArgs(args);
+  }
+
+  grpc_channel_args channel_args;
+  args->SetChannelArgs(&channel_args);
+
   if (sync_server_cqs_ != nullptr) {
     bool default_rq_created = false;
     if (server_rq == nullptr) {
@@ -911,7 +946,9 @@ Server::Server(
     for (const auto& it : *sync_server_cqs_) {
       sync_req_mgrs_.emplace_back(new SyncRequestThreadManager(
           this, it.get(), global_callbacks_, server_rq, min_pollers,
-          max_pollers, sync_cq_timeout_msec));
+          max_pollers, sync_cq_timeout_msec,
+          grpc_core::QueueDelayAdmissionControl::CreateFromChannelArgs(
+              grpc_core::ChannelArgs::FromC(&channel_args))));
     }
 
     if (default_rq_created) {
@@ -919,13 +956,6 @@ Server::Server(
     }
   }
 
-  for (auto& acceptor : acceptors_) {
-    acceptor->SetToChannelArgs(args);
-  }
-
-  grpc_channel_args channel_args;
-  args->SetChannelArgs(&channel_args);
-
   for (size_t i = 0; i < channel_args.num_args; i++) {
     if (0 == strcmp(channel_args.args[i].key,
                     grpc::kHealthCheckServiceInterfaceArg)) {
@@ -1360,7 +1390,7 @@ grpc::CompletionQueue* Server::CallbackCQ() {
     auto* shutdown_callback = new grpc::ShutdownCallback;
     callback_cq = new grpc::CompletionQueue(grpc_completion_queue_attributes{
         GRPC_CQ_CURRENT_VERSION, GRPC_CQ_CALLBACK, GRPC_CQ_DEFAULT_POLLING,
-        shutdown_callback});
+        shutdown_callback, 0});
 
     // Transfer ownership of the new cq to its own shutdown callback
     shutdown_callback->TakeCQ(callback_cq);
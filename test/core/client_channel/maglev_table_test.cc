@@ -0,0 +1,119 @@
+//
+// Copyright 2022 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "absl/strings/str_cat.h"
+
+#include "src/core/ext/filters/client_channel/lb_policy/maglev/maglev.h"
+#include "src/core/ext/filters/client_channel/lb_policy/ring_hash/ring_hash.h"
+#include "test/core/util/test_config.h"
+
+namespace grpc_core {
+namespace testing {
+namespace {
+
+constexpr size_t kTableSize = 65537;
+
+std::vector<HashedEndpoint> MakeEndpoints(size_t num_endpoints,
+                                          size_t first = 0) {
+  std::vector<HashedEndpoint> endpoints;
+  for (size_t i = first; i < first + num_endpoints; ++i) {
+    HashedEndpoint endpoint;
+    endpoint.address = absl::StrCat("10.0.0.", i, ":443");
+    endpoints.push_back(std::move(endpoint));
+  }
+  return endpoints;
+}
+
+std::vector<size_t> CountSlots(const MaglevTable& table,
+                               size_t num_endpoints) {
+  std::vector<size_t> counts(num_endpoints);
+  for (uint32_t index : table.entries()) {
+    EXPECT_LT(index, num_endpoints);
+    if (index < num_endpoints) ++counts[index];
+  }
+  return counts;
+}
+
+TEST(MaglevTableTest, EmptyEndpointList) {
+  MaglevTable table({}, kTableSize);
+  EXPECT_TRUE(table.entries().empty());
+}
+
+TEST(MaglevTableTest, EqualWeightsGetEqualShares) {
+  const size_t kNumEndpoints = 7;
+  MaglevTable table(MakeEndpoints(kNumEndpoints), kTableSize);
+  ASSERT_EQ(table.entries().size(), kTableSize);
+  // Endpoints take turns filling the table, so the shares differ by at most
+  // one slot.
+  for (size_t count : CountSlots(table, kNumEndpoints)) {
+    EXPECT_GE(count, kTableSize / kNumEndpoints);
+    EXPECT_LE(count, kTableSize / kNumEndpoints + 1);
+  }
+}
+
+TEST(MaglevTableTest, SharesFollowWeights) {
+  auto endpoints = MakeEndpoints(3);
+  endpoints[0].weight = 1;
+  endpoints[1].weight = 2;
+  endpoints[2].weight = 4;
+  MaglevTable table(endpoints, kTableSize);
+  auto counts = CountSlots(table, endpoints.size());
+  EXPECT_NEAR(static_cast<double>(counts[0]) / kTableSize, 1.0 / 7, 0.01);
+  EXPECT_NEAR(static_cast<double>(counts[1]) / kTableSize, 2.0 / 7, 0.01);
+  EXPECT_NEAR(static_cast<double>(counts[2]) / kTableSize, 4.0 / 7, 0.01);
+}
+
+TEST(MaglevTableTest, RemovingEndpointCausesMinimalDisruption) {
+  const size_t kNumEndpoints = 10;
+  auto endpoints = MakeEndpoints(kNumEndpoints);
+  MaglevTable before(endpoints, kTableSize);
+  // Drop the last endpoint; indices of the others are unchanged.
+  endpoints.pop_back();
+  MaglevTable after(endpoints, kTableSize);
+  size_t moved = 0;
+  for (size_t i = 0; i < kTableSize; ++i) {
+    if (before.entries()[i] == kNumEndpoints - 1) continue;
+    if (before.entries()[i] != after.entries()[i]) ++moved;
+  }
+  // Only the removed endpoint's slots need to move, but Maglev trades a
+  // little extra disruption for an even spread.
+  EXPECT_LT(static_cast<double>(moved) / kTableSize, 0.05);
+}
+
+TEST(MaglevTableTest, FindIndexIsStable) {
+  MaglevTable table(MakeEndpoints(5), kTableSize);
+  for (uint64_t h : {uint64_t{0}, uint64_t{12345}, ~uint64_t{0}}) {
+    EXPECT_EQ(table.FindIndex(h), h % kTableSize);
+  }
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -65,6 +65,24 @@ TEST(ServerRetryThrottleData, Basic) {
   EXPECT_TRUE(throttle_data->RecordFailure());
 }
 
+TEST(ServerRetryThrottleData, RetriesAllowed) {
+  // Max token count is 4, so threshold for retrying is 2.
+  auto throttle_data =
+      MakeRefCounted<ServerRetryThrottleData>(4000, 1000, nullptr);
+  EXPECT_TRUE(throttle_data->RetriesAllowed());
+  // Failure: token_count=3.  Above threshold.
+  EXPECT_TRUE(throttle_data->RecordFailure());
+  EXPECT_TRUE(throttle_data->RetriesAllowed());
+  // Failure: token_count=2.  At threshold, so no retries.
+  EXPECT_FALSE(throttle_data->RecordFailure());
+  EXPECT_FALSE(throttle_data->RetriesAllowed());
+  // Checking does not change the token count.
+  EXPECT_FALSE(throttle_data->RetriesAllowed());
+  // Success: token_count=3.  Above threshold.
+  throttle_data->RecordSuccess();
+  EXPECT_TRUE(throttle_data->RetriesAllowed());
+}
+
 TEST(ServerRetryThrottleData, Replacement) {
   // Create old throttle data.
   // Max token count is 4, so threshold for retrying is 2.
@@ -0,0 +1,109 @@
+//
+// Copyright 2022 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "absl/types/optional.h"
+
+#include "src/core/ext/filters/client_channel/lb_policy/weighted_round_robin/weighted_round_robin.h"
+#include "test/core/util/test_config.h"
+
+namespace grpc_core {
+namespace testing {
+namespace {
+
+std::vector<size_t> CountPicks(const StaticStrideScheduler& scheduler,
+                               size_t num_backends, size_t num_picks) {
+  std::vector<size_t> counts(num_backends);
+  for (size_t i = 0; i < num_picks; ++i) {
+    size_t index = scheduler.Pick();
+    EXPECT_LT(index, num_backends);
+    if (index < num_backends) ++counts[index];
+  }
+  return counts;
+}
+
+TEST(StaticStrideSchedulerTest, NeedsTwoUsableWeights) {
+  EXPECT_FALSE(StaticStrideScheduler::Make({}, 0).has_value());
+  EXPECT_FALSE(StaticStrideScheduler::Make({1}, 0).has_value());
+  EXPECT_FALSE(StaticStrideScheduler::Make({0, 0, 0}, 0).has_value());
+  EXPECT_FALSE(StaticStrideScheduler::Make({0, 5, 0}, 0).has_value());
+  EXPECT_TRUE(StaticStrideScheduler::Make({0, 5, 2}, 0).has_value());
+}
+
+TEST(StaticStrideSchedulerTest, EqualWeightsAreRoundRobin) {
+  const size_t kNumBackends = 4;
+  auto scheduler =
+      StaticStrideScheduler::Make(std::vector<float>(kNumBackends, 3), 6);
+  ASSERT_TRUE(scheduler.has_value());
+  // Every backend is accepted in every generation, so picks simply walk the
+  // list from the initial sequence.
+  for (size_t i = 0; i < 3 * kNumBackends; ++i) {
+    EXPECT_EQ(scheduler->Pick(), (6 + i) % kNumBackends);
+  }
+}
+
+TEST(StaticStrideSchedulerTest, PicksFollowWeights) {
+  const std::vector<float> weights = {1, 2, 3, 4};
+  auto scheduler = StaticStrideScheduler::Make(weights, 0);
+  ASSERT_TRUE(scheduler.has_value());
+  const size_t kNumPicks = 100000;
+  auto counts = CountPicks(*scheduler, weights.size(), kNumPicks);
+  for (size_t i = 0; i < weights.size(); ++i) {
+    EXPECT_NEAR(static_cast<double>(counts[i]) / kNumPicks, weights[i] / 10,
+                0.01)
+        << "backend " << i;
+  }
+}
+
+TEST(StaticStrideSchedulerTest, MissingWeightsGetTheMean) {
+  const std::vector<float> weights = {0, 1, 3};
+  auto scheduler = StaticStrideScheduler::Make(weights, 0);
+  ASSERT_TRUE(scheduler.has_value());
+  const size_t kNumPicks = 100000;
+  auto counts = CountPicks(*scheduler, weights.size(), kNumPicks);
+  // Backend 0 is treated as having weight 2, the mean of the known ones.
+  EXPECT_NEAR(static_cast<double>(counts[0]) / kNumPicks, 2.0 / 6, 0.01);
+  EXPECT_NEAR(static_cast<double>(counts[1]) / kNumPicks, 1.0 / 6, 0.01);
+  EXPECT_NEAR(static_cast<double>(counts[2]) / kNumPicks, 3.0 / 6, 0.01);
+}
+
+TEST(StaticStrideSchedulerTest, TinyWeightsStillGetPicked) {
+  const std::vector<float> weights = {1e-9f, 1};
+  auto scheduler = StaticStrideScheduler::Make(weights, 0);
+  ASSERT_TRUE(scheduler.has_value());
+  // Scaled weights are clamped to at least 1, so backend 0 gets one pick per
+  // kMaxWeight generations.
+  const size_t kMaxWeight = StaticStrideScheduler::kMaxWeight;
+  auto counts = CountPicks(*scheduler, weights.size(), kMaxWeight + 1);
+  EXPECT_EQ(counts[0], 1u);
+  EXPECT_EQ(counts[1], kMaxWeight);
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -713,6 +713,7 @@ TEST_P(EventPollerTest, TestMultipleHandles) {
 
 INSTANTIATE_TEST_SUITE_P(PosixEventPoller, EventPollerTest,
                          ::testing::ValuesIn({std::string("epoll1"),
+                                              std::string("io_uring"),
                                               std::string("poll")}),
                          &TestScenarioName);
 
@@ -29,6 +29,7 @@
 #include "src/core/lib/event_engine/posix_engine/timer.h"
 #include "src/core/lib/gprpp/time.h"
 
+using testing::AnyNumber;
 using testing::Mock;
 using testing::Return;
 using testing::StrictMock;
@@ -66,7 +67,17 @@ CheckResult FinishCheck(
 
 }  // namespace
 
-TEST(TimerListTest, Add) {
+// The parameter selects whether the timer list is backed by a timing wheel.
+class TimerListTest : public ::testing::TestWithParam<bool> {
+ protected:
+  // Unlike the heap, which only tracks the next deadline once a timer falls
+  // within its queue window, the wheel reports every new earliest timer.
+  void AllowTimerWheelKicks(MockHost* host) {
+    if (GetParam()) EXPECT_CALL(*host, Kick()).Times(AnyNumber());
+  }
+};
+
+TEST_P(TimerListTest, Add) {
   Timer timers[20];
   StrictMock<MockClosure> closures[20];
 
@@ -74,8 +85,9 @@ TEST(TimerListTest, Add) {
       grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(100);
 
   StrictMock<MockHost> host;
+  AllowTimerWheelKicks(&host);
   EXPECT_CALL(host, Now()).WillOnce(Return(kStart));
-  TimerList timer_list(&host);
+  TimerList timer_list(&host, GetParam());
 
   /* 10 ms timers.  will expire in the current epoch */
   for (int i = 0; i < 10; i++) {
@@ -129,15 +141,16 @@ TEST(TimerListTest, Add) {
 }
 
 /* Cleaning up a list with pending timers. */
-TEST(TimerListTest, Destruction) {
+TEST_P(TimerListTest, Destruction) {
   Timer timers[5];
   StrictMock<MockClosure> closures[5];
 
   StrictMock<MockHost> host;
+  AllowTimerWheelKicks(&host);
   EXPECT_CALL(host, Now())
       .WillOnce(
           Return(grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(0)));
-  TimerList timer_list(&host);
+  TimerList timer_list(&host, GetParam());
 
   EXPECT_CALL(host, Now())
       .WillOnce(
@@ -195,7 +208,7 @@ TEST(TimerListTest, Destruction) {
         step 1) to `now+4`
     4) Shuts down the timer list
    https://github.com/grpc/grpc/issues/15904 */
-TEST(TimerListTest, LongRunningServiceCleanup) {
+TEST_P(TimerListTest, LongRunningServiceCleanup) {
   Timer timers[4];
   StrictMock<MockClosure> closures[4];
 
@@ -203,8 +216,9 @@ TEST(TimerListTest, LongRunningServiceCleanup) {
       grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(k25Days.millis());
 
   StrictMock<MockHost> host;
+  AllowTimerWheelKicks(&host);
   EXPECT_CALL(host, Now()).WillOnce(Return(kStart));
-  TimerList timer_list(&host);
+  TimerList timer_list(&host, GetParam());
 
   EXPECT_CALL(host, Now()).WillOnce(Return(kStart));
   timer_list.TimerInit(&timers[0], kStart + k25Days, &closures[0]);
@@ -238,6 +252,12 @@ TEST(TimerListTest, LongRunningServiceCleanup) {
   EXPECT_TRUE(timer_list.TimerCancel(&timers[3]));
 }
 
+INSTANTIATE_TEST_SUITE_P(TimerListTest, TimerListTest,
+                         ::testing::Values(false, true),
+                         [](const ::testing::TestParamInfo<bool>& info) {
+                           return info.param ? "TimerWheel" : "TimerHeap";
+                         });
+
 }  // namespace posix_engine
 }  // namespace grpc_event_engine
 
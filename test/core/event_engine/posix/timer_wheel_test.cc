@@ -0,0 +1,144 @@
+// Copyright 2022 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/event_engine/posix_engine/timer_wheel.h"
+
+#include <stdlib.h>
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "src/core/lib/event_engine/posix_engine/timer.h"
+
+namespace grpc_event_engine {
+namespace posix_engine {
+
+namespace {
+constexpr int64_t kInfinity = std::numeric_limits<int64_t>::max();
+
+// Pops every timer due at now, checking that none of them fires early.
+std::vector<Timer*> PopAll(TimerWheel* wheel, int64_t now) {
+  std::vector<Timer*> popped;
+  while (Timer* timer = wheel->PopOne(now)) {
+    EXPECT_LE(timer->deadline, now);
+    popped.push_back(timer);
+  }
+  return popped;
+}
+}  // namespace
+
+TEST(TimerWheelTest, Empty) {
+  TimerWheel wheel(100);
+  EXPECT_TRUE(wheel.is_empty());
+  EXPECT_EQ(wheel.NextTick(), kInfinity);
+  EXPECT_EQ(wheel.PopOne(1000), nullptr);
+  EXPECT_EQ(wheel.PopOne(kInfinity), nullptr);
+}
+
+TEST(TimerWheelTest, FiresAtDeadline) {
+  TimerWheel wheel(0);
+  Timer timer;
+  timer.deadline = 10;
+  EXPECT_TRUE(wheel.Add(&timer));
+  EXPECT_EQ(wheel.NextTick(), 10);
+  EXPECT_EQ(wheel.PopOne(9), nullptr);
+  EXPECT_EQ(wheel.PopOne(10), &timer);
+  EXPECT_TRUE(wheel.is_empty());
+}
+
+TEST(TimerWheelTest, DeadlineInThePast) {
+  TimerWheel wheel(1000);
+  Timer timer;
+  timer.deadline = 5;
+  wheel.Add(&timer);
+  EXPECT_LE(wheel.NextTick(), 1000);
+  EXPECT_EQ(wheel.PopOne(1000), &timer);
+}
+
+TEST(TimerWheelTest, Remove) {
+  TimerWheel wheel(0);
+  Timer timers[3];
+  timers[0].deadline = 10;
+  timers[1].deadline = 10;
+  timers[2].deadline = 100000;
+  for (auto& timer : timers) wheel.Add(&timer);
+  wheel.Remove(&timers[0]);
+  wheel.Remove(&timers[2]);
+  EXPECT_EQ(PopAll(&wheel, kInfinity - 1), std::vector<Timer*>{&timers[1]});
+  EXPECT_TRUE(wheel.is_empty());
+  EXPECT_EQ(wheel.NextTick(), kInfinity);
+}
+
+TEST(TimerWheelTest, FarFutureTimersOverflow) {
+  TimerWheel wheel(0);
+  Timer near;
+  Timer far;
+  near.deadline = 1;
+  far.deadline = kInfinity - 1;
+  wheel.Add(&near);
+  wheel.Add(&far);
+  EXPECT_EQ(PopAll(&wheel, 1000), std::vector<Timer*>{&near});
+  EXPECT_GT(wheel.NextTick(), 1000);
+  EXPECT_EQ(PopAll(&wheel, kInfinity), std::vector<Timer*>{&far});
+}
+
+// Adds timers spread across every level of the wheel and advances time in
+// random steps, checking that each timer fires at the first check at or after
+// its deadline and that NextTick() never skips over a due timer.
+TEST(TimerWheelTest, RandomDeadlines) {
+  constexpr size_t kNumTimers = 5000;
+  const int64_t kStart = 12345;
+  TimerWheel wheel(kStart);
+  std::vector<Timer> timers(kNumTimers);
+  std::vector<bool> fired(kNumTimers);
+  for (size_t i = 0; i < kNumTimers; i++) {
+    int64_t range = int64_t{1} << (rand() % 30);
+    timers[i].deadline = kStart + rand() % range;
+    wheel.Add(&timers[i]);
+  }
+  for (size_t i = 0; i < kNumTimers; i += 7) wheel.Remove(&timers[i]);
+  int64_t now = kStart;
+  while (!wheel.is_empty()) {
+    const int64_t next_tick = wheel.NextTick();
+    ASSERT_GE(next_tick, now);
+    for (size_t i = 0; i < kNumTimers; i++) {
+      if (i % 7 != 0 && !fired[i]) {
+        ASSERT_GE(timers[i].deadline, next_tick);
+      }
+    }
+    now = next_tick + rand() % 1000;
+    for (Timer* timer : PopAll(&wheel, now)) {
+      size_t i = timer - timers.data();
+      ASSERT_NE(i % 7, 0u);
+      ASSERT_FALSE(fired[i]);
+      fired[i] = true;
+    }
+    for (size_t i = 0; i < kNumTimers; i++) {
+      if (i % 7 != 0 && timers[i].deadline <= now) {
+        ASSERT_TRUE(fired[i]);
+      }
+    }
+  }
+}
+
+}  // namespace posix_engine
+}  // namespace grpc_event_engine
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -30,15 +30,20 @@
 namespace grpc_event_engine {
 namespace experimental {
 
-TEST(ThreadPoolTest, CanRunClosure) {
-  ThreadPool p(1);
+class ThreadPoolTest : public ::testing::TestWithParam<bool> {
+ protected:
+  bool work_stealing() const { return GetParam(); }
+};
+
+TEST_P(ThreadPoolTest, CanRunClosure) {
+  ThreadPool p(1, work_stealing());
   grpc_core::Notification n;
   p.Add([&n] { n.Notify(); });
   n.WaitForNotification();
 }
 
-TEST(ThreadPoolTest, CanDestroyInsideClosure) {
-  auto p = std::make_shared<ThreadPool>(1);
+TEST_P(ThreadPoolTest, CanDestroyInsideClosure) {
+  auto p = std::make_shared<ThreadPool>(1, work_stealing());
   grpc_core::Notification n;
   p->Add([p, &n]() mutable {
     std::this_thread::sleep_for(std::chrono::seconds(1));
@@ -51,8 +56,8 @@ TEST(ThreadPoolTest, CanDestroyInsideClosure) {
   n.WaitForNotification();
 }
 
-TEST(ThreadPoolTest, CanSurviveFork) {
-  ThreadPool p(1);
+TEST_P(ThreadPoolTest, CanSurviveFork) {
+  ThreadPool p(1, work_stealing());
   grpc_core::Notification n;
   gpr_log(GPR_INFO, "add callback 1");
   p.Add([&n, &p] {
@@ -84,11 +89,14 @@ void ScheduleSelf(ThreadPool* p) {
   p->Add([p] { ScheduleSelf(p); });
 }
 
-TEST(ThreadPoolDeathTest, CanDetectStucknessAtFork) {
+using ThreadPoolDeathTest = ThreadPoolTest;
+
+TEST_P(ThreadPoolDeathTest, CanDetectStucknessAtFork) {
+  const bool work_stealing = this->work_stealing();
   ASSERT_DEATH_IF_SUPPORTED(
-      [] {
+      [work_stealing] {
         gpr_set_log_verbosity(GPR_LOG_SEVERITY_ERROR);
-        ThreadPool p(1);
+        ThreadPool p(1, work_stealing);
         ScheduleSelf(&p);
         std::thread terminator([] {
           std::this_thread::sleep_for(std::chrono::seconds(10));
@@ -107,13 +115,36 @@ void ScheduleTwiceUntilZero(ThreadPool* p, int n) {
   });
 }
 
-TEST(ThreadPoolTest, CanStartLotsOfClosures) {
-  ThreadPool p(1);
+TEST_P(ThreadPoolTest, CanStartLotsOfClosures) {
+  ThreadPool p(1, work_stealing());
   // Our first thread pool implementation tried to create ~1M threads for this
   // test.
   ScheduleTwiceUntilZero(&p, 20);
 }
 
+TEST_P(ThreadPoolTest, RunsClosureAddedByBlockedPoolThread) {
+  ThreadPool p(2, work_stealing());
+  grpc_core::Notification inner_ran;
+  grpc_core::Notification outer_done;
+  p.Add([&p, &inner_ran, &outer_done] {
+    // In work stealing mode this is queued on the current thread's queue, so
+    // another thread has to steal it for the wait below to complete.
+    p.Add([&inner_ran] { inner_ran.Notify(); });
+    inner_ran.WaitForNotification();
+    outer_done.Notify();
+  });
+  outer_done.WaitForNotification();
+}
+
+INSTANTIATE_TEST_SUITE_P(ThreadPool, ThreadPoolTest, ::testing::Bool(),
+                         [](const ::testing::TestParamInfo<bool>& info) {
+                           return info.param ? "WorkStealing" : "GlobalQueue";
+                         });
+INSTANTIATE_TEST_SUITE_P(ThreadPool, ThreadPoolDeathTest, ::testing::Bool(),
+                         [](const ::testing::TestParamInfo<bool>& info) {
+                           return info.param ? "WorkStealing" : "GlobalQueue";
+                         });
+
 }  // namespace experimental
 }  // namespace grpc_event_engine
 
@@ -35,6 +35,7 @@
 #include <unistd.h>
 
 #include <string>
+#include <vector>
 
 #include <grpc/grpc.h>
 #include <grpc/support/alloc.h>
@@ -48,6 +49,7 @@
 #include "src/core/lib/iomgr/error.h"
 #include "src/core/lib/iomgr/iomgr.h"
 #include "src/core/lib/iomgr/resolve_address.h"
+#include "src/core/lib/iomgr/socket_utils_posix.h"
 #include "src/core/lib/iomgr/tcp_server.h"
 #include "src/core/lib/resource_quota/api.h"
 #include "test/core/util/port.h"
@@ -64,6 +66,7 @@ typedef struct {
   unsigned port_index;
   unsigned fd_index;
   int server_fd;
+  grpc_pollset* pollset;
 } on_connect_result;
 
 typedef struct {
@@ -85,7 +88,7 @@ typedef struct {
   test_addr addrs[MAX_ADDRS];
 } test_addrs;
 
-static on_connect_result g_result = {nullptr, 0, 0, -1};
+static on_connect_result g_result = {nullptr, 0, 0, -1, nullptr};
 
 static char family_name_buf[1024];
 static const char* sock_family_name(int family) {
@@ -106,6 +109,7 @@ static void on_connect_result_init(on_connect_result* result) {
   result->port_index = 0;
   result->fd_index = 0;
   result->server_fd = -1;
+  result->pollset = nullptr;
 }
 
 static void on_connect_result_set(on_connect_result* result,
@@ -146,8 +150,7 @@ static void test_addr_init_str(test_addr* addr) {
   addr->str[str_len] = '\0';
 }
 
-static void on_connect(void* /*arg*/, grpc_endpoint* tcp,
-                       grpc_pollset* /*pollset*/,
+static void on_connect(void* /*arg*/, grpc_endpoint* tcp, grpc_pollset* pollset,
                        grpc_tcp_server_acceptor* acceptor) {
   grpc_endpoint_shutdown(tcp,
                          GRPC_ERROR_CREATE_FROM_STATIC_STRING("Connected"));
@@ -155,6 +158,7 @@ static void on_connect(void* /*arg*/, grpc_endpoint* tcp,
 
   on_connect_result temp_result;
   on_connect_result_set(&temp_result, acceptor);
+  temp_result.pollset = pollset;
   gpr_free(acceptor);
 
   gpr_mu_lock(g_mu);
@@ -472,6 +476,105 @@ static void destroy_pollset(void* p, grpc_error_handle /*error*/) {
   grpc_pollset_destroy(static_cast<grpc_pollset*>(p));
 }
 
+/* Tests that with GRPC_ARG_SHARD_REUSEPORT_LISTENERS, each connection is bound
+   to the pollset of the SO_REUSEPORT listener that accepted it. */
+static void test_sharded_listeners(void) {
+  if (!grpc_is_socket_reuse_port_supported()) return;
+  grpc_core::ExecCtx exec_ctx;
+  grpc_resolved_address resolved_addr;
+  struct sockaddr_storage* const addr =
+      reinterpret_cast<struct sockaddr_storage*>(resolved_addr.addr);
+  int svr_port;
+  grpc_tcp_server* s;
+  grpc_arg chan_args[1];
+  chan_args[0].type = GRPC_ARG_INTEGER;
+  chan_args[0].key = const_cast<char*>(GRPC_ARG_SHARD_REUSEPORT_LISTENERS);
+  chan_args[0].value.integer = 1;
+  const grpc_channel_args channel_args = {1, chan_args};
+  auto new_channel_args = grpc_core::CoreConfiguration::Get()
+                              .channel_args_preconditioning()
+                              .PreconditionChannelArgs(&channel_args);
+  LOG_TEST("test_sharded_listeners");
+  ASSERT_EQ(GRPC_ERROR_NONE,
+            grpc_tcp_server_create(
+                nullptr,
+                grpc_event_engine::experimental::ChannelArgsEndpointConfig(
+                    new_channel_args),
+                &s));
+  memset(&resolved_addr, 0, sizeof(resolved_addr));
+  resolved_addr.len = static_cast<socklen_t>(sizeof(struct sockaddr_storage));
+  addr->ss_family = AF_INET;
+  ASSERT_TRUE(GRPC_LOG_IF_ERROR(
+      "grpc_tcp_server_add_port",
+      grpc_tcp_server_add_port(s, &resolved_addr, &svr_port)));
+  ASSERT_GT(svr_port, 0);
+  gpr_mu* shard_mu;
+  grpc_pollset* shard_pollset =
+      static_cast<grpc_pollset*>(gpr_zalloc(grpc_pollset_size()));
+  grpc_pollset_init(shard_pollset, &shard_mu);
+  std::vector<grpc_pollset*> pollsets = {g_pollset, shard_pollset};
+  std::vector<gpr_mu*> mus = {g_mu, shard_mu};
+  grpc_tcp_server_start(s, &pollsets, on_connect, nullptr);
+  /* The listener of the port is cloned once per pollset, and the i-th
+     listener of each group of clones is polled from the i-th pollset. */
+  ASSERT_EQ(grpc_tcp_server_port_fd_count(s, 0) % pollsets.size(), 0);
+  test_addr dst;
+  memset(&dst, 0, sizeof(dst));
+  struct sockaddr_in* dst_addr =
+      reinterpret_cast<struct sockaddr_in*>(dst.addr.addr);
+  dst.addr.len = static_cast<socklen_t>(sizeof(*dst_addr));
+  dst_addr->sin_family = AF_INET;
+  dst_addr->sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  dst_addr->sin_port = htons(static_cast<uint16_t>(svr_port));
+  /* The kernel picks the listener for each connection, so make several. */
+  for (int i = 0; i < 10; ++i) {
+    gpr_mu_lock(g_mu);
+    const int nconnects_before = g_nconnects;
+    on_connect_result_init(&g_result);
+    gpr_mu_unlock(g_mu);
+    int clifd = socket(AF_INET, SOCK_STREAM, 0);
+    ASSERT_GE(clifd, 0);
+    ASSERT_EQ(connect(clifd, reinterpret_cast<struct sockaddr*>(dst_addr),
+                      dst.addr.len),
+              0);
+    grpc_core::Timestamp deadline = grpc_core::Timestamp::FromTimespecRoundUp(
+        grpc_timeout_seconds_to_deadline(10));
+    for (;;) {
+      gpr_mu_lock(g_mu);
+      const bool connected = g_nconnects != nconnects_before;
+      gpr_mu_unlock(g_mu);
+      if (connected || deadline < grpc_core::Timestamp::Now()) break;
+      for (size_t j = 0; j < pollsets.size(); ++j) {
+        gpr_mu_lock(mus[j]);
+        GRPC_LOG_IF_ERROR(
+            "pollset_work",
+            grpc_pollset_work(pollsets[j], nullptr,
+                              grpc_core::Timestamp::Now() +
+                                  grpc_core::Duration::Milliseconds(10)));
+        gpr_mu_unlock(mus[j]);
+      }
+    }
+    close(clifd);
+    gpr_mu_lock(g_mu);
+    const int nconnects = g_nconnects;
+    on_connect_result result = g_result;
+    gpr_mu_unlock(g_mu);
+    ASSERT_EQ(nconnects, nconnects_before + 1);
+    gpr_log(GPR_INFO, "Accepted by listener %u on pollset %p", result.fd_index,
+            result.pollset);
+    ASSERT_EQ(result.pollset, pollsets[result.fd_index % pollsets.size()]);
+    grpc_tcp_server_unref(result.server);
+  }
+  grpc_tcp_server_unref(s);
+  grpc_core::ExecCtx::Get()->Flush();
+  grpc_closure destroyed;
+  GRPC_CLOSURE_INIT(&destroyed, destroy_pollset, shard_pollset,
+                    grpc_schedule_on_exec_ctx);
+  grpc_pollset_shutdown(shard_pollset, &destroyed);
+  grpc_core::ExecCtx::Get()->Flush();
+  gpr_free(shard_pollset);
+}
+
 TEST(TcpServerPosixTest, MainTest) {
   grpc_closure destroyed;
   grpc_arg chan_args[1];
@@ -539,6 +642,8 @@ TEST(TcpServerPosixTest, MainTest) {
     /* Test connect(2) with dst_addrs. */
     test_connect(10, &channel_args, dst_addrs, false);
 
+    test_sharded_listeners();
+
     GRPC_CLOSURE_INIT(&destroyed, destroy_pollset, g_pollset,
                       grpc_schedule_on_exec_ctx);
     grpc_pollset_shutdown(g_pollset, &destroyed);
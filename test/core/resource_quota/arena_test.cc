@@ -37,10 +37,12 @@
 #include "src/core/lib/gprpp/ref_counted_ptr.h"
 #include "src/core/lib/gprpp/thd.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/resource_quota/arena_pool.h"
 #include "src/core/lib/resource_quota/resource_quota.h"
 #include "test/core/util/test_config.h"
 
 using grpc_core::Arena;
+using grpc_core::ArenaPool;
 using grpc_core::ExecCtx;
 
 static auto* g_memory_allocator = new grpc_core::MemoryAllocator(
@@ -173,6 +175,64 @@ TEST(ArenaTest, ConcurrentManagedNew) {
   args.arena->Destroy();
 }
 
+TEST(ArenaPoolTest, ReusesArena) {
+  ExecCtx exec_ctx;
+  grpc_core::MemoryOwner owner =
+      grpc_core::ResourceQuota::Default()->memory_quota()->CreateMemoryOwner(
+          "test");
+  ArenaPool pool(&owner);
+  auto first = pool.CreateWithAlloc(1024, 64);
+  int destroyed = 0;
+  struct CountOnDestroy {
+    explicit CountOnDestroy(int* n) : n(n) {}
+    ~CountOnDestroy() { ++*n; }
+    int* n;
+  };
+  first.first->ManagedNew<CountOnDestroy>(&destroyed);
+  // Force an overflow zone to be allocated and then recycled.
+  first.first->Alloc(4096);
+  EXPECT_GE(pool.Destroy(first.first), 4096 + 64);
+  EXPECT_EQ(destroyed, 1);
+  EXPECT_EQ(pool.TestOnlyPooledArenas(), 1);
+  auto second = pool.CreateWithAlloc(1024, 64);
+  EXPECT_EQ(second.first, first.first);
+  EXPECT_EQ(second.second, first.second);
+  EXPECT_EQ(pool.TestOnlyPooledArenas(), 0);
+  memset(second.first->Alloc(1024 - 64), 1, 1024 - 64);
+  pool.Destroy(second.first);
+}
+
+TEST(ArenaPoolTest, DoesNotReuseMismatchedArena) {
+  ExecCtx exec_ctx;
+  grpc_core::MemoryOwner owner =
+      grpc_core::ResourceQuota::Default()->memory_quota()->CreateMemoryOwner(
+          "test");
+  ArenaPool pool(&owner);
+  pool.Destroy(pool.CreateWithAlloc(256, 16).first);
+  EXPECT_EQ(pool.TestOnlyPooledArenas(), 1);
+  // Too small for the new estimate: freed rather than reused.
+  Arena* big = pool.CreateWithAlloc(4096, 16).first;
+  EXPECT_EQ(pool.TestOnlyPooledArenas(), 0);
+  pool.Destroy(big);
+  // Too large for the new estimate.
+  pool.Destroy(pool.CreateWithAlloc(256, 16).first);
+  EXPECT_EQ(pool.TestOnlyPooledArenas(), 1);
+}
+
+TEST(ArenaPoolTest, IsBounded) {
+  ExecCtx exec_ctx;
+  grpc_core::MemoryOwner owner =
+      grpc_core::ResourceQuota::Default()->memory_quota()->CreateMemoryOwner(
+          "test");
+  ArenaPool pool(&owner);
+  std::vector<Arena*> arenas;
+  for (size_t i = 0; i < 2 * ArenaPool::kMaxArenasPerCpu; i++) {
+    arenas.push_back(pool.CreateWithAlloc(128, 16).first);
+  }
+  for (Arena* arena : arenas) pool.Destroy(arena);
+  EXPECT_EQ(pool.TestOnlyPooledArenas(), ArenaPool::kMaxArenasPerCpu);
+}
+
 int main(int argc, char* argv[]) {
   grpc::testing::TestEnvironment give_me_a_name(&argc, argv);
   ::testing::InitGoogleTest(&argc, argv);
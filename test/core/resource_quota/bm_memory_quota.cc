@@ -0,0 +1,83 @@
+// Copyright 2022 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Benchmark many allocators charging one memory quota concurrently, as
+// happens when many connections allocate read buffers at once.
+
+#include <benchmark/benchmark.h>
+
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/resource_quota/memory_quota.h"
+#include "test/core/util/test_config.h"
+
+namespace grpc_core {
+namespace {
+
+MemoryQuota* g_memory_quota;
+
+// Each thread owns an allocator, and repeatedly reserves and releases more
+// than the allocator keeps locally so that every iteration reaches the quota.
+void BM_ReserveReleaseLarge(benchmark::State& state) {
+  ExecCtx exec_ctx;
+  auto allocator = g_memory_quota->CreateMemoryAllocator("bm");
+  const size_t size = state.range(0);
+  for (auto _ : state) {
+    allocator.Release(allocator.Reserve(MemoryRequest(size)));
+  }
+  state.SetBytesProcessed(state.iterations() * size);
+}
+BENCHMARK(BM_ReserveReleaseLarge)
+    ->Arg(2 * 1024 * 1024)
+    ->ThreadRange(1, 64)
+    ->UseRealTime();
+
+// Read buffer style reservations: a range request that consults memory
+// pressure, as the tcp endpoints do.
+void BM_ReserveReleaseRange(benchmark::State& state) {
+  ExecCtx exec_ctx;
+  auto allocator = g_memory_quota->CreateMemoryAllocator("bm");
+  for (auto _ : state) {
+    allocator.Release(allocator.Reserve(MemoryRequest(8192, 64 * 1024)));
+  }
+}
+BENCHMARK(BM_ReserveReleaseRange)->ThreadRange(1, 64)->UseRealTime();
+
+// Allocators created and destroyed per iteration, returning all they took to
+// the quota, as with short lived connections.
+void BM_AllocatorChurn(benchmark::State& state) {
+  ExecCtx exec_ctx;
+  for (auto _ : state) {
+    auto allocator = g_memory_quota->CreateMemoryAllocator("bm");
+    allocator.Release(allocator.Reserve(MemoryRequest(16 * 1024)));
+  }
+}
+BENCHMARK(BM_AllocatorChurn)->ThreadRange(1, 64)->UseRealTime();
+
+}  // namespace
+}  // namespace grpc_core
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::benchmark::Initialize(&argc, argv);
+  grpc_core::g_memory_quota = new grpc_core::MemoryQuota("bm");
+  grpc_core::g_memory_quota->SetSize(1024 * 1024 * 1024);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
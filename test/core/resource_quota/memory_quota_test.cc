@@ -169,6 +169,40 @@ TEST(MemoryQuotaTest, NoBunchingIfIdle) {
   EXPECT_GE(count_reclaimers_called.load(std::memory_order_relaxed), 8000);
 }
 
+TEST(MemoryQuotaTest, PerCpuCachesDoNotSkewPressure) {
+  ExecCtx exec_ctx;
+  MemoryQuota memory_quota("foo");
+  memory_quota.SetSize(64 * 1024 * 1024);
+  for (int i = 0; i < 100; i++) {
+    auto memory_allocator = memory_quota.CreateMemoryAllocator("bar");
+    for (int j = 0; j < 100; j++) {
+      memory_allocator.Release(
+          memory_allocator.Reserve(MemoryRequest(2 * 1024 * 1024)));
+    }
+  }
+  // Everything has been returned: whatever is still parked in per-cpu caches
+  // must not read as more than 1/64th of the quota.
+  auto memory_owner = memory_quota.CreateMemoryOwner("baz");
+  EXPECT_LE(memory_owner.GetPressureInfo().instantaneous_pressure,
+            1.0 / 64 + 0.001);
+}
+
+TEST(MemoryQuotaTest, PerCpuCachesAreReclaimable) {
+  ExecCtx exec_ctx;
+  MemoryQuota memory_quota("foo");
+  memory_quota.SetSize(64 * 1024 * 1024);
+  {
+    // Warm up this cpu's cache.
+    auto memory_allocator = memory_quota.CreateMemoryAllocator("bar");
+    memory_allocator.Release(memory_allocator.Reserve(MemoryRequest(4096)));
+  }
+  // Shrinking the quota drains the caches, so bytes cached against the old
+  // size must not read as used against the new one.
+  memory_quota.SetSize(1024 * 1024);
+  auto memory_owner = memory_quota.CreateMemoryOwner("baz");
+  EXPECT_LE(memory_owner.GetPressureInfo().instantaneous_pressure, 0.01);
+}
+
 }  // namespace testing
 
 namespace memory_quota_detail {
@@ -24,6 +24,8 @@
 #include <string.h>
 
 #include <random>
+#include <thread>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -32,10 +34,12 @@
 #include <grpc/grpc.h>
 #include <grpc/slice.h>
 #include <grpc/support/alloc.h>
+#include <grpc/support/cpu.h>
 #include <grpc/support/log.h>
 
 #include "src/core/lib/gprpp/memory.h"
 #include "src/core/lib/slice/slice_internal.h"
+#include "src/core/lib/slice/small_slice_allocator.h"
 #include "test/core/util/build.h"
 
 TEST(GrpcSliceTest, MallocReturnsSomethingSensible) {
@@ -431,6 +435,63 @@ TEST(SliceTest, LetsGetMutable) {
   EXPECT_EQ(slice.as_string_view(), "ifnmp");
 }
 
+TEST(SmallSliceAllocatorTest, ReusesFreedBlocks) {
+  grpc_slice slice = SmallSliceAllocator::Allocate(100);
+  EXPECT_EQ(GRPC_SLICE_LENGTH(slice), 100);
+  const size_t cached = SmallSliceAllocator::TestOnlyCachedBlocks();
+  uint8_t* bytes = GRPC_SLICE_START_PTR(slice);
+  grpc_slice_unref(slice);
+  EXPECT_EQ(SmallSliceAllocator::TestOnlyCachedBlocks(), cached + 1);
+  // Blocks are cached per cpu, so we may be handed a different block if this
+  // thread migrated in between.
+  slice = SmallSliceAllocator::Allocate(90);
+  EXPECT_EQ(GRPC_SLICE_LENGTH(slice), 90);
+  if (GRPC_SLICE_START_PTR(slice) == bytes) {
+    EXPECT_EQ(SmallSliceAllocator::TestOnlyCachedBlocks(), cached);
+  }
+  grpc_slice_unref(slice);
+}
+
+TEST(SmallSliceAllocatorTest, CachedBytesAreBounded) {
+  std::vector<grpc_slice> slices;
+  for (int i = 0; i < 4096; i++) {
+    slices.push_back(SmallSliceAllocator::Allocate(
+        SmallSliceAllocator::kMaxLength));
+  }
+  for (auto& slice : slices) grpc_slice_unref(slice);
+  EXPECT_LE(SmallSliceAllocator::TestOnlyCachedBlocks() *
+                SmallSliceAllocator::kMinBlockSize,
+            4 * SmallSliceAllocator::kMaxCachedBytesPerClass *
+                gpr_cpu_num_cores());
+}
+
+TEST(SmallSliceAllocatorTest, SlicesCanBeFreedOnAnotherThread) {
+  std::vector<grpc_slice> slices;
+  for (size_t length = 0; length <= SmallSliceAllocator::kMaxLength;
+       length++) {
+    grpc_slice slice = SmallSliceAllocator::Allocate(length);
+    memset(GRPC_SLICE_START_PTR(slice), static_cast<int>(length), length);
+    slices.push_back(slice);
+  }
+  std::thread([&slices] {
+    for (auto& slice : slices) grpc_slice_unref(slice);
+  }).join();
+  for (size_t length = 0; length <= SmallSliceAllocator::kMaxLength;
+       length++) {
+    grpc_slice slice = SmallSliceAllocator::Allocate(length);
+    EXPECT_EQ(GRPC_SLICE_LENGTH(slice), length);
+    memset(GRPC_SLICE_START_PTR(slice), 0, length);
+    grpc_slice_unref(slice);
+  }
+}
+
+TEST(SmallSliceAllocatorTest, ReleaseCachedBlocksEmptiesTheCache) {
+  grpc_slice_unref(SmallSliceAllocator::Allocate(100));
+  EXPECT_GT(SmallSliceAllocator::TestOnlyCachedBlocks(), 0);
+  SmallSliceAllocator::ReleaseCachedBlocks();
+  EXPECT_EQ(SmallSliceAllocator::TestOnlyCachedBlocks(), 0);
+}
+
 }  // namespace
 }  // namespace grpc_core
 
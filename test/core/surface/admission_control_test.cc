@@ -0,0 +1,109 @@
+// Copyright 2022 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/surface/admission_control.h"
+
+#include <gtest/gtest.h>
+
+#include <grpc/grpc.h>
+
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "test/core/util/test_config.h"
+
+namespace grpc_core {
+namespace {
+
+Timestamp At(int64_t millis) {
+  return Timestamp::FromMillisecondsAfterProcessEpoch(millis);
+}
+
+TEST(QueueDelayAdmissionControlTest, DisabledByDefault) {
+  EXPECT_EQ(QueueDelayAdmissionControl::CreateFromChannelArgs(ChannelArgs()),
+            nullptr);
+  EXPECT_EQ(QueueDelayAdmissionControl::CreateFromChannelArgs(
+                ChannelArgs().Set(GRPC_ARG_SERVER_QUEUE_DELAY_TARGET_MS, 0)),
+            nullptr);
+  EXPECT_NE(QueueDelayAdmissionControl::CreateFromChannelArgs(
+                ChannelArgs().Set(GRPC_ARG_SERVER_QUEUE_DELAY_TARGET_MS, 10)),
+            nullptr);
+}
+
+TEST(QueueDelayAdmissionControlTest, ShortBurstsAreAdmitted) {
+  ExecCtx exec_ctx;
+  QueueDelayAdmissionControl control(Duration::Milliseconds(10),
+                                     Duration::Milliseconds(100));
+  // Long delays are fine as long as some call in each interval got through
+  // quickly.
+  for (int64_t t = 1000; t < 2000; t += 50) {
+    EXPECT_TRUE(control.AdmitQueued(Duration::Milliseconds(500), At(t)));
+    EXPECT_TRUE(control.AdmitQueued(Duration::Zero(), At(t + 1)));
+  }
+  EXPECT_FALSE(control.overloaded());
+  EXPECT_TRUE(control.AdmitNew(Duration::Milliseconds(500)));
+}
+
+TEST(QueueDelayAdmissionControlTest, StandingQueueIsShed) {
+  ExecCtx exec_ctx;
+  QueueDelayAdmissionControl control(Duration::Milliseconds(10),
+                                     Duration::Milliseconds(100));
+  EXPECT_TRUE(control.AdmitQueued(Duration::Milliseconds(50), At(1000)));
+  EXPECT_TRUE(control.AdmitQueued(Duration::Milliseconds(30), At(1050)));
+  EXPECT_FALSE(control.overloaded());
+  // No call got through within the target for a whole interval.
+  EXPECT_FALSE(control.AdmitQueued(Duration::Milliseconds(40), At(1100)));
+  EXPECT_TRUE(control.overloaded());
+  // Calls within twice the target still run.
+  EXPECT_TRUE(control.AdmitQueued(Duration::Milliseconds(15), At(1110)));
+  EXPECT_TRUE(control.AdmitNew(Duration::Milliseconds(20)));
+  EXPECT_FALSE(control.AdmitNew(Duration::Milliseconds(25)));
+}
+
+TEST(QueueDelayAdmissionControlTest, RecoversOnceQueueDrains) {
+  ExecCtx exec_ctx;
+  QueueDelayAdmissionControl control(Duration::Milliseconds(10),
+                                     Duration::Milliseconds(100));
+  control.AdmitQueued(Duration::Milliseconds(50), At(1000));
+  control.AdmitQueued(Duration::Milliseconds(50), At(1100));
+  ASSERT_TRUE(control.overloaded());
+  // A call matched without queueing shows the queue has drained.
+  EXPECT_TRUE(control.AdmitQueued(Duration::Zero(), At(1150)));
+  EXPECT_TRUE(control.AdmitQueued(Duration::Milliseconds(50), At(1200)));
+  EXPECT_FALSE(control.overloaded());
+  EXPECT_TRUE(control.AdmitNew(Duration::Milliseconds(50)));
+}
+
+TEST(QueueDelayAdmissionControlTest, OnlyRecordedDelaysCount) {
+  ExecCtx exec_ctx;
+  QueueDelayAdmissionControl control(Duration::Milliseconds(10),
+                                     Duration::Milliseconds(100));
+  control.RecordQueueDelay(Duration::Zero(), At(1000));
+  // A call that is checked but stays queued does not count towards the
+  // interval's minimum delay.
+  EXPECT_TRUE(control.ShouldAdmit(Duration::Milliseconds(50)));
+  EXPECT_TRUE(control.ShouldAdmit(Duration::Milliseconds(50)));
+  control.RecordQueueDelay(Duration::Milliseconds(50), At(1100));
+  EXPECT_FALSE(control.overloaded());
+  control.RecordQueueDelay(Duration::Milliseconds(50), At(1200));
+  EXPECT_TRUE(control.overloaded());
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc::testing::TestGrpcScope grpc_scope;
+  return RUN_ALL_TESTS();
+}
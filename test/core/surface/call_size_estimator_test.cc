@@ -0,0 +1,100 @@
+// Copyright 2022 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <grpc/grpc.h>
+#include <grpc/grpc_security.h>
+#include <grpc/support/time.h>
+
+#include "src/core/lib/surface/call.h"
+#include "src/core/lib/surface/channel.h"
+#include "test/core/util/test_config.h"
+
+namespace grpc_core {
+namespace {
+
+TEST(CallSizeEstimatorTest, GrowsQuicklyAndShrinksSlowly) {
+  CallSizeEstimator estimator(1024);
+  const size_t initial = estimator.CallSizeEstimate();
+  estimator.UpdateCallSizeEstimate(64 * 1024);
+  EXPECT_GE(estimator.CallSizeEstimate(), 64 * 1024);
+  estimator.UpdateCallSizeEstimate(512);
+  EXPECT_GT(estimator.CallSizeEstimate(), initial);
+}
+
+class RegisteredCallSizeTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    grpc_channel_credentials* creds = grpc_insecure_credentials_create();
+    channel_ = grpc_channel_create("localhost:1", creds, nullptr);
+    grpc_channel_credentials_release(creds);
+    cq_ = grpc_completion_queue_create_for_next(nullptr);
+  }
+
+  void TearDown() override {
+    grpc_channel_destroy(channel_);
+    grpc_completion_queue_shutdown(cq_);
+    while (grpc_completion_queue_next(cq_, gpr_inf_future(GPR_CLOCK_REALTIME),
+                                      nullptr)
+               .type != GRPC_QUEUE_SHUTDOWN) {
+    }
+    grpc_completion_queue_destroy(cq_);
+  }
+
+  // Creates and destroys a call to method, allocating extra bytes from its
+  // arena first.
+  void RunCall(void* method, size_t extra) {
+    grpc_call* call = grpc_channel_create_registered_call(
+        channel_, nullptr, GRPC_PROPAGATE_DEFAULTS, cq_, method,
+        gpr_inf_future(GPR_CLOCK_REALTIME), nullptr);
+    ASSERT_NE(call, nullptr);
+    if (extra > 0) grpc_call_arena_alloc(call, extra);
+    grpc_call_unref(call);
+  }
+
+  static size_t Estimate(void* method) {
+    return static_cast<RegisteredCall*>(method)
+        ->call_size_estimator.CallSizeEstimate();
+  }
+
+  grpc_channel* channel_;
+  grpc_completion_queue* cq_;
+};
+
+TEST_F(RegisteredCallSizeTest, MethodsAreSizedIndependently) {
+  void* big =
+      grpc_channel_register_call(channel_, "/svc/Big", nullptr, nullptr);
+  void* small =
+      grpc_channel_register_call(channel_, "/svc/Small", nullptr, nullptr);
+  const size_t channel_estimate = Channel::FromC(channel_)->CallSizeEstimate();
+  for (int i = 0; i < 10; i++) {
+    RunCall(big, 256 * 1024);
+    RunCall(small, 0);
+  }
+  EXPECT_GE(Estimate(big), 256 * 1024);
+  EXPECT_LT(Estimate(small), 256 * 1024);
+  // Registered calls do not feed the channel wide estimate.
+  EXPECT_EQ(Channel::FromC(channel_)->CallSizeEstimate(), channel_estimate);
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc::testing::TestGrpcScope grpc_scope;
+  return RUN_ALL_TESTS();
+}
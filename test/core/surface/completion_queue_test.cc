@@ -18,6 +18,11 @@
 
 #include "src/core/lib/surface/completion_queue.h"
 
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include <grpc/grpc.h>
@@ -485,6 +490,123 @@ TEST(GrpcCompletionQueueTest, TestCallback) {
   gpr_mu_destroy(&shutdown_mu);
 }
 
+TEST(GrpcCompletionQueueTest, TestNextBatch) {
+  grpc_cq_polling_type polling_types[] = {
+      GRPC_CQ_DEFAULT_POLLING, GRPC_CQ_NON_LISTENING, GRPC_CQ_NON_POLLING};
+  grpc_completion_queue_attributes attr;
+  void* tags[10];
+  grpc_cq_completion completions[GPR_ARRAY_SIZE(tags)];
+  grpc_event events[4];
+
+  LOG_TEST("test_next_batch");
+
+  for (size_t i = 0; i < GPR_ARRAY_SIZE(tags); i++) {
+    tags[i] = create_test_tag();
+  }
+
+  attr.version = 1;
+  attr.cq_completion_type = GRPC_CQ_NEXT;
+  for (size_t i = 0; i < GPR_ARRAY_SIZE(polling_types); i++) {
+    attr.cq_polling_type = polling_types[i];
+    grpc_completion_queue* cc = grpc_completion_queue_create(
+        grpc_completion_queue_factory_lookup(&attr), &attr, nullptr);
+
+    {
+      grpc_core::ExecCtx exec_ctx;
+      for (size_t j = 0; j < GPR_ARRAY_SIZE(tags); j++) {
+        ASSERT_TRUE(grpc_cq_begin_op(cc, tags[j]));
+        grpc_cq_end_op(cc, tags[j], GRPC_ERROR_NONE, do_nothing_end_completion,
+                       nullptr, &completions[j]);
+      }
+    }
+
+    // Events come back in order, at most GPR_ARRAY_SIZE(events) at a time.
+    size_t next_tag = 0;
+    while (next_tag < GPR_ARRAY_SIZE(tags)) {
+      int n = grpc_completion_queue_next_batch(
+          cc, events, GPR_ARRAY_SIZE(events),
+          gpr_inf_past(GPR_CLOCK_REALTIME), nullptr);
+      ASSERT_GE(n, 1);
+      ASSERT_LE(n, static_cast<int>(GPR_ARRAY_SIZE(events)));
+      for (int j = 0; j < n; j++) {
+        ASSERT_EQ(events[j].type, GRPC_OP_COMPLETE);
+        ASSERT_TRUE(events[j].success);
+        ASSERT_EQ(events[j].tag, tags[next_tag++]);
+      }
+    }
+
+    ASSERT_EQ(grpc_completion_queue_next_batch(
+                  cc, events, GPR_ARRAY_SIZE(events),
+                  gpr_inf_past(GPR_CLOCK_REALTIME), nullptr),
+              1);
+    ASSERT_EQ(events[0].type, GRPC_QUEUE_TIMEOUT);
+
+    grpc_completion_queue_shutdown(cc);
+    ASSERT_EQ(grpc_completion_queue_next_batch(
+                  cc, events, GPR_ARRAY_SIZE(events),
+                  gpr_inf_past(GPR_CLOCK_REALTIME), nullptr),
+              1);
+    ASSERT_EQ(events[0].type, GRPC_QUEUE_SHUTDOWN);
+    grpc_completion_queue_destroy(cc);
+  }
+}
+
+TEST(GrpcCompletionQueueTest, TestShardedNext) {
+  constexpr int kThreads = 4;
+  constexpr int kEventsPerThread = 1000;
+  constexpr int kEvents = kThreads * kEventsPerThread;
+  grpc_cq_polling_type polling_types[] = {
+      GRPC_CQ_DEFAULT_POLLING, GRPC_CQ_NON_LISTENING, GRPC_CQ_NON_POLLING};
+  grpc_completion_queue_attributes attr;
+
+  LOG_TEST("test_sharded_next");
+
+  attr.version = GRPC_CQ_CURRENT_VERSION;
+  attr.cq_completion_type = GRPC_CQ_NEXT;
+  attr.cq_shutdown_cb = nullptr;
+  attr.cq_sharded = 1;
+  for (size_t i = 0; i < GPR_ARRAY_SIZE(polling_types); i++) {
+    attr.cq_polling_type = polling_types[i];
+    grpc_completion_queue* cc = grpc_completion_queue_create(
+        grpc_completion_queue_factory_lookup(&attr), &attr, nullptr);
+    ASSERT_EQ(grpc_get_cq_completion_type(cc), GRPC_CQ_NEXT);
+
+    // Every thread both produces events and consumes whichever events it can
+    // get, so events are taken from other threads' shards too.
+    std::unique_ptr<grpc_cq_completion[]> completions(
+        new grpc_cq_completion[kEvents]);
+    std::unique_ptr<std::atomic<int>[]> seen(new std::atomic<int>[kEvents]);
+    for (int j = 0; j < kEvents; j++) seen[j].store(0);
+    std::atomic<int> consumed{0};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreads; t++) {
+      threads.emplace_back([&, t] {
+        for (int j = t * kEventsPerThread; j < (t + 1) * kEventsPerThread;
+             j++) {
+          grpc_core::ExecCtx exec_ctx;
+          void* tag = reinterpret_cast<void*>(static_cast<intptr_t>(j) + 1);
+          ASSERT_TRUE(grpc_cq_begin_op(cc, tag));
+          grpc_cq_end_op(cc, tag, GRPC_ERROR_NONE, do_nothing_end_completion,
+                         nullptr, &completions[j]);
+        }
+        while (consumed.load() < kEvents) {
+          grpc_event ev = grpc_completion_queue_next(
+              cc, grpc_timeout_milliseconds_to_deadline(10), nullptr);
+          if (ev.type == GRPC_QUEUE_TIMEOUT) continue;
+          ASSERT_EQ(ev.type, GRPC_OP_COMPLETE);
+          ASSERT_TRUE(ev.success);
+          seen[reinterpret_cast<intptr_t>(ev.tag) - 1].fetch_add(1);
+          consumed.fetch_add(1);
+        }
+      });
+    }
+    for (auto& thread : threads) thread.join();
+
+    for (int j = 0; j < kEvents; j++) ASSERT_EQ(seen[j].load(), 1);
+    shutdown_and_destroy(cc);
+  }
+}
+
 struct thread_state {
   grpc_completion_queue* cc;
   void* tag;
@@ -0,0 +1,89 @@
+// Copyright 2022 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/surface/validate_metadata.h"
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <grpc/grpc.h>
+
+#include "src/core/lib/slice/slice.h"
+#include "test/core/util/test_config.h"
+
+namespace grpc_core {
+namespace {
+
+bool IsLegalKeyByte(uint8_t c) {
+  return (c >= 'a' && c <= 'z') || (c >= '0' && c <= '9') || c == '-' ||
+         c == '_' || c == '.';
+}
+
+bool IsLegalValueByte(uint8_t c) { return c >= 32 && c <= 126; }
+
+// Places each byte value at each offset of a legal string long enough to be
+// checked both a word and a byte at a time, and checks that exactly the bytes
+// that should be rejected are, at the right offset.
+void CheckEveryByteAtEveryOffset(
+    size_t first_offset, bool (*is_legal_byte)(uint8_t),
+    grpc_error_handle (*validate)(const grpc_slice&)) {
+  for (size_t offset = first_offset; offset < 21; offset++) {
+    for (int c = 0; c < 256; c++) {
+      std::string s(21, 'a');
+      s[offset] = static_cast<char>(c);
+      Slice slice = Slice::FromCopiedString(s);
+      grpc_error_handle error = validate(slice.c_slice());
+      if (is_legal_byte(c)) {
+        EXPECT_TRUE(GRPC_ERROR_IS_NONE(error)) << c << " at " << offset;
+      } else {
+        intptr_t error_offset;
+        ASSERT_FALSE(GRPC_ERROR_IS_NONE(error)) << c << " at " << offset;
+        ASSERT_TRUE(
+            grpc_error_get_int(error, GRPC_ERROR_INT_OFFSET, &error_offset));
+        EXPECT_EQ(error_offset, offset);
+      }
+      GRPC_ERROR_UNREF(error);
+    }
+  }
+}
+
+TEST(ValidateMetadataTest, HeaderKeys) {
+  // Keys starting with ':' are rejected before their bytes are checked.
+  CheckEveryByteAtEveryOffset(1, IsLegalKeyByte,
+                              grpc_validate_header_key_is_legal);
+  EXPECT_FALSE(grpc_header_key_is_legal(grpc_empty_slice()));
+  EXPECT_FALSE(
+      grpc_header_key_is_legal(grpc_slice_from_static_string(":path")));
+  EXPECT_TRUE(grpc_header_key_is_legal(
+      grpc_slice_from_static_string("x-goog-request-params")));
+}
+
+TEST(ValidateMetadataTest, NonBinaryHeaderValues) {
+  CheckEveryByteAtEveryOffset(0, IsLegalValueByte,
+                              grpc_validate_header_nonbin_value_is_legal);
+  EXPECT_TRUE(grpc_header_nonbin_value_is_legal(grpc_empty_slice()));
+  EXPECT_TRUE(grpc_header_nonbin_value_is_legal(
+      grpc_slice_from_static_string("Bearer eyJhbGciOiJSUzI1NiJ9.e30.c2ln")));
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc::testing::TestGrpcScope grpc_scope;
+  return RUN_ALL_TESTS();
+}
@@ -20,6 +20,8 @@
 
 #include <string.h>
 
+#include <string>
+
 #include "gtest/gtest.h"
 
 #include <grpc/support/alloc.h>
@@ -164,6 +166,26 @@ TEST(BinDecoderTest, MainTest) {
   EXPECT_DECODED_LENGTH("abcde===", 0);
 }
 
+TEST(BinDecoderTest, DecodesAllCharacterPairs) {
+  // Every 12 bit value in both halves of a triplet, then each tail case
+  std::string input;
+  for (uint32_t i = 0; i < 4096; i++) {
+    const uint32_t triplet = (i << 12) | (4095 - i);
+    input.push_back(static_cast<char>(triplet >> 16));
+    input.push_back(static_cast<char>(triplet >> 8));
+    input.push_back(static_cast<char>(triplet));
+  }
+  input += "\xff\xfe";
+  for (size_t len = input.size() - 2; len <= input.size(); len++) {
+    grpc_slice raw = grpc_slice_from_copied_buffer(input.data(), len);
+    grpc_slice encoded = grpc_chttp2_base64_encode(raw);
+    expect_slice_eq(raw, grpc_chttp2_base64_decode_with_length(encoded, len),
+                    "decode(encode(input))", __LINE__);
+    grpc_slice_unref(encoded);
+  }
+  EXPECT_TRUE(all_ok);
+}
+
 int main(int argc, char** argv) {
   grpc::testing::TestEnvironment env(&argc, argv);
   ::testing::InitGoogleTest(&argc, argv);
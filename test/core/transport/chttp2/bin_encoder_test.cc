@@ -20,6 +20,8 @@
 
 #include <string.h>
 
+#include <string>
+
 /* This is here for grpc_is_binary_header
  * TODO(murgatroid99): Remove this
  */
@@ -174,6 +176,22 @@ TEST(BinEncoderTest, MainTest) {
   expect_binary_header("-bin", 0);
 }
 
+TEST(BinEncoderTest, CombinedEncodingOfAllCharacterPairs) {
+  /* Every 12 bit value in both halves of a triplet, then each tail case */
+  std::string input;
+  for (uint32_t i = 0; i < 4096; i++) {
+    const uint32_t triplet = (i << 12) | (4095 - i);
+    input.push_back(static_cast<char>(triplet >> 16));
+    input.push_back(static_cast<char>(triplet >> 8));
+    input.push_back(static_cast<char>(triplet));
+  }
+  input += "\xff\xfe";
+  for (size_t len = input.size() - 2; len <= input.size(); len++) {
+    expect_combined_equiv(input.data(), len, __LINE__);
+  }
+  EXPECT_TRUE(all_ok);
+}
+
 int main(int argc, char** argv) {
   grpc::testing::TestEnvironment env(&argc, argv);
   ::testing::InitGoogleTest(&argc, argv);
@@ -23,6 +23,8 @@
 
 #include <memory>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
@@ -32,6 +34,7 @@
 #include <grpc/support/log.h>
 
 #include "src/core/ext/transport/chttp2/transport/frame.h"
+#include "src/core/ext/transport/chttp2/transport/hpack_parser.h"
 #include "src/core/lib/gprpp/ref_counted_ptr.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/resource_quota/arena.h"
@@ -302,6 +305,134 @@ TEST(HpackEncoderTest, UserAgentMetadataNoIndexing) {
   grpc_slice_unref(encoded_header);
 }
 
+using HeaderFields = std::vector<std::pair<std::string, std::string>>;
+
+// Encodes header_fields with compressor, and returns the header block without
+// its frame header.
+static grpc_core::Slice EncodeHeaderBlock(
+    grpc_core::HPackCompressor* compressor, const HeaderFields& header_fields,
+    bool use_true_binary_metadata = false) {
+  auto arena = grpc_core::MakeScopedArena(1024, g_memory_allocator);
+  grpc_metadata_batch b(arena.get());
+  for (const auto& field : header_fields) {
+    b.Append(field.first, grpc_core::Slice::FromCopiedString(field.second),
+             CrashOnAppendError);
+  }
+  grpc_transport_one_way_stats stats = {};
+  grpc_core::HPackCompressor::EncodeHeaderOptions hopt{
+      0xdeadbeef,               /* stream_id */
+      false,                    /* is_eof */
+      use_true_binary_metadata, /* use_true_binary_metadata */
+      16384,                    /* max_frame_size */
+      &stats                    /* stats */
+  };
+  grpc_slice_buffer output;
+  grpc_slice_buffer_init(&output);
+  compressor->EncodeHeaders(hopt, b, &output);
+  verify_frames(output, false);
+  grpc_core::Slice merged(grpc_slice_merge(output.slices, output.count));
+  grpc_slice_buffer_destroy(&output);
+  return merged.RefSubSlice(9, merged.length() - 9);
+}
+
+// Collects the custom metadata in a batch.
+class HeaderCollector {
+ public:
+  void Encode(const grpc_core::Slice& key, const grpc_core::Slice& value) {
+    fields.emplace_back(std::string(key.as_string_view()),
+                        std::string(value.as_string_view()));
+  }
+  template <typename Which, typename Value>
+  void Encode(Which, const Value&) {}
+
+  HeaderFields fields;
+};
+
+static HeaderFields ParseHeaderBlock(grpc_core::HPackParser* parser,
+                                     const grpc_core::Slice& block) {
+  auto arena = grpc_core::MakeScopedArena(1024, g_memory_allocator);
+  grpc_metadata_batch b(arena.get());
+  parser->BeginFrame(&b, 1024 * 1024, grpc_core::HPackParser::Boundary::None,
+                     grpc_core::HPackParser::Priority::None,
+                     grpc_core::HPackParser::LogInfo{
+                         1, grpc_core::HPackParser::LogInfo::kHeaders, false});
+  grpc_error_handle error = parser->Parse(block.c_slice(), true);
+  EXPECT_TRUE(GRPC_ERROR_IS_NONE(error)) << grpc_error_std_string(error);
+  GRPC_ERROR_UNREF(error);
+  HeaderCollector collector;
+  b.Encode(&collector);
+  return collector.fields;
+}
+
+TEST(HpackEncoderTest, CustomMetadataIndexedWhenRepeated) {
+  grpc_core::ExecCtx exec_ctx;
+  grpc_core::HPackCompressor compressor;
+  // Seen once: sent as a literal, without indexing.
+  EXPECT_EQ(EncodeHeaderBlock(&compressor, {{"x-tenant", "abc"}}),
+            absl::string_view("\x00\x08x-tenant\x03" "abc", 14));
+  // Seen again: worth adding to the table.
+  EXPECT_EQ(EncodeHeaderBlock(&compressor, {{"x-tenant", "abc"}}),
+            absl::string_view("\x40\x08x-tenant\x03" "abc", 14));
+  // From then on it is sent as its (first dynamic) index.
+  EXPECT_EQ(EncodeHeaderBlock(&compressor, {{"x-tenant", "abc"}}),
+            absl::string_view("\xbe", 1));
+  // Other values of the same key are still sent literally.
+  EXPECT_EQ(EncodeHeaderBlock(&compressor, {{"x-tenant", "def"}}),
+            absl::string_view("\x00\x08x-tenant\x03" "def", 14));
+}
+
+TEST(HpackEncoderTest, CredentialsAreNeverIndexed) {
+  grpc_core::ExecCtx exec_ctx;
+  grpc_core::HPackCompressor compressor;
+  // However often it repeats, a credential is sent as a never indexed literal.
+  for (int i = 0; i < 5; i++) {
+    EXPECT_EQ(EncodeHeaderBlock(&compressor,
+                                {{"authorization", "Bearer abcdef"}}),
+              absl::string_view("\x10\x0d" "authorization\x0d" "Bearer abcdef",
+                                29));
+    EXPECT_EQ(EncodeHeaderBlock(&compressor, {{"cookie", "id=1"}}),
+              absl::string_view("\x10\x06" "cookie\x04" "id=1", 13));
+  }
+}
+
+TEST(HpackEncoderTest, CustomMetadataTooLargeForTableIsNotIndexed) {
+  grpc_core::ExecCtx exec_ctx;
+  grpc_core::HPackCompressor compressor;
+  // More than an eighth of the default 4096 byte table.
+  const std::string value(600, 'a');
+  for (int i = 0; i < 5; i++) {
+    grpc_core::Slice block =
+        EncodeHeaderBlock(&compressor, {{"x-large", value}});
+    EXPECT_EQ(block[0], 0x00);
+  }
+}
+
+TEST(HpackEncoderTest, CustomMetadataRoundTrips) {
+  grpc_core::ExecCtx exec_ctx;
+  grpc_core::HPackCompressor compressor;
+  grpc_core::HPackParser parser;
+  // A few hot values and a long tail of values large enough to force
+  // evictions from the table.
+  std::vector<std::pair<std::string, std::string>> hot = {
+      {"x-tenant", "tenant-1234"},
+      {"x-routing-key", "shard-7"},
+      {"authorization", "Bearer " + std::string(200, 't')},
+      {"x-request-context-bin", std::string("\x00\x01\x02\xff", 4)},
+  };
+  for (int i = 0; i < 2000; i++) {
+    HeaderFields fields = hot;
+    fields.emplace_back("x-request-id", std::to_string(i));
+    fields.emplace_back("x-shard", std::string(300, 'a' + i % 20));
+    for (bool true_binary : {false, true}) {
+      EXPECT_EQ(
+          ParseHeaderBlock(&parser,
+                           EncodeHeaderBlock(&compressor, fields, true_binary)),
+          fields)
+          << "iteration " << i;
+    }
+  }
+}
+
 static void verify_continuation_headers(const char* key, const char* value,
                                         bool is_eof) {
   auto arena = grpc_core::MakeScopedArena(1024, g_memory_allocator);
@@ -169,6 +169,34 @@ static void test_periodic_compaction(uint32_t n) {
   grpc_chttp2_stream_map_destroy(&map);
 }
 
+/* add keys that share their low bits, so that many of them collide in the
+   hash index, then delete them in an interleaved order and make sure every
+   remaining key can still be found */
+static void test_colliding_keys(uint32_t n) {
+  grpc_chttp2_stream_map map;
+  uint32_t i;
+
+  LOG_TEST("test_colliding_keys");
+  gpr_log(GPR_INFO, "n = %d", n);
+
+  grpc_chttp2_stream_map_init(&map, 8);
+  for (i = 1; i <= n; i++) {
+    grpc_chttp2_stream_map_add(&map, i << 12 | 1,
+                               reinterpret_cast<void*>(uintptr_t{i}));
+  }
+  for (i = 1; i <= n; i += 3) {
+    ASSERT_EQ((void*)(uintptr_t)i,
+              grpc_chttp2_stream_map_delete(&map, i << 12 | 1));
+  }
+  for (i = 1; i <= n; i++) {
+    void* expected =
+        i % 3 == 1 ? nullptr : reinterpret_cast<void*>(uintptr_t{i});
+    ASSERT_EQ(expected, grpc_chttp2_stream_map_find(&map, i << 12 | 1));
+  }
+  ASSERT_EQ(n - (n + 2) / 3, grpc_chttp2_stream_map_size(&map));
+  grpc_chttp2_stream_map_destroy(&map);
+}
+
 TEST(StreamMapTest, MainTest) {
   uint32_t n = 1;
   uint32_t prev = 1;
@@ -182,6 +210,7 @@ TEST(StreamMapTest, MainTest) {
     test_delete_evens_sweep(n);
     test_delete_evens_incremental(n);
     test_periodic_compaction(n);
+    test_colliding_keys(n);
 
     tmp = n;
     n += prev;
@@ -44,7 +44,8 @@ struct PickArgsSeen {
 using TestPickArgsCallback = std::function<void(const PickArgsSeen&)>;
 
 // Registers an LB policy called "test_pick_args_lb" that passes the args passed
-// to SubchannelPicker::Pick() to cb.
+// to SubchannelPicker::Pick() to cb.  Since picks may run concurrently, cb
+// must be thread-safe.
 void RegisterTestPickArgsLoadBalancingPolicy(
     CoreConfiguration::Builder* builder, TestPickArgsCallback cb,
     absl::string_view delegate_policy_name = "pick_first");
@@ -283,6 +283,41 @@ TEST(AlarmTest, Cancellation) {
   EXPECT_EQ(junk, output_tag);
 }
 
+TEST(AlarmTest, CancellationNextBatch) {
+  CompletionQueue cq;
+  constexpr int kAlarms = 5;
+  Alarm alarms[kAlarms];
+  for (int i = 0; i < kAlarms; i++) {
+    alarms[i].Set(&cq, grpc_timeout_seconds_to_deadline(10),
+                  reinterpret_cast<void*>(i + 1));
+    alarms[i].Cancel();
+  }
+
+  bool seen[kAlarms] = {};
+  int num_seen = 0;
+  while (num_seen < kAlarms) {
+    void* output_tags[3];
+    bool oks[3];
+    const int n = cq.NextBatch(output_tags, oks, 3);
+    ASSERT_GT(n, 0);
+    ASSERT_LE(n, 3);
+    for (int i = 0; i < n; i++) {
+      EXPECT_FALSE(oks[i]);
+      const intptr_t index = reinterpret_cast<intptr_t>(output_tags[i]) - 1;
+      ASSERT_GE(index, 0);
+      ASSERT_LT(index, kAlarms);
+      EXPECT_FALSE(seen[index]);
+      seen[index] = true;
+      num_seen++;
+    }
+  }
+
+  cq.Shutdown();
+  void* output_tag;
+  bool ok;
+  EXPECT_EQ(cq.NextBatch(&output_tag, &ok, 1), 0);
+}
+
 TEST(AlarmTest, CallbackCancellation) {
   Alarm alarm;
 
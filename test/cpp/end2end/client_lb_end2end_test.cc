@@ -13,6 +13,7 @@
 // limitations under the License.
 
 #include <algorithm>
+#include <cmath>
 #include <deque>
 #include <memory>
 #include <mutex>
@@ -29,6 +30,7 @@
 #include "absl/strings/str_format.h"
 #include "absl/strings/str_join.h"
 #include "absl/strings/string_view.h"
+#include "absl/types/optional.h"
 
 #include <grpc/event_engine/endpoint_config.h>
 #include <grpc/grpc.h>
@@ -101,13 +103,21 @@ class MyTestServiceImpl : public TestServiceImpl {
       auto* recorder = context->ExperimentalGetCallMetricRecorder();
       EXPECT_NE(recorder, nullptr);
       recorder->RecordCpuUtilizationMetric(load_report_.cpu_utilization())
-          .RecordMemoryUtilizationMetric(load_report_.mem_utilization());
+          .RecordMemoryUtilizationMetric(load_report_.mem_utilization())
+          .RecordQpsMetric(load_report_.rps());
       for (const auto& p : load_report_.request_cost()) {
         recorder->RecordRequestCostMetric(p.first, p.second);
       }
       for (const auto& p : load_report_.utilization()) {
         recorder->RecordUtilizationMetric(p.first, p.second);
       }
+    } else {
+      grpc_core::MutexLock lock(&mu_);
+      if (call_metrics_.has_value()) {
+        context->ExperimentalGetCallMetricRecorder()
+            ->RecordCpuUtilizationMetric(call_metrics_->cpu_utilization())
+            .RecordQpsMetric(call_metrics_->rps());
+      }
     }
     return TestServiceImpl::Echo(context, request, response);
   }
@@ -122,6 +132,14 @@ class MyTestServiceImpl : public TestServiceImpl {
     request_count_ = 0;
   }
 
+  // Sets the backend metrics reported on RPCs that do not carry their own.
+  void SetCallMetrics(double qps, double cpu_utilization) {
+    grpc_core::MutexLock lock(&mu_);
+    call_metrics_.emplace();
+    call_metrics_->set_rps(static_cast<uint64_t>(qps));
+    call_metrics_->set_cpu_utilization(cpu_utilization);
+  }
+
   std::set<std::string> clients() {
     grpc_core::MutexLock lock(&clients_mu_);
     return clients_;
@@ -134,7 +152,9 @@ class MyTestServiceImpl : public TestServiceImpl {
   }
 
   grpc_core::Mutex mu_;
-  int request_count_ = 0;
+  int request_count_ ABSL_GUARDED_BY(&mu_) = 0;
+  absl::optional<xds::data::orca::v3::OrcaLoadReport> call_metrics_
+      ABSL_GUARDED_BY(&mu_);
   grpc_core::Mutex clients_mu_;
   std::set<std::string> clients_;
   // For strings storage.
@@ -1396,6 +1416,29 @@ TEST_F(PickFirstTest, PendingUpdateAndSelectedSubchannelFails) {
   WaitForServer(DEBUG_LOCATION, stub, 1);
 }
 
+TEST_F(PickFirstTest, HappyEyeballsDoesNotWaitForHungAttempt) {
+  ConnectionAttemptInjector injector;
+  StartServers(2);
+  // Hold the connection attempt to the first server, so that it neither
+  // succeeds nor fails until we say so.
+  auto hold = injector.AddHold(servers_[0]->port_);
+  ChannelArguments args;
+  args.SetInt(GRPC_ARG_HAPPY_EYEBALLS_CONNECTION_ATTEMPT_DELAY_MS, 100);
+  auto response_generator = BuildResolverResponseGenerator();
+  auto channel = BuildChannel("pick_first", response_generator, args);
+  auto stub = BuildStub(channel);
+  response_generator.SetNextResolution(GetServersPorts());
+  hold->Wait();
+  // Once the connection attempt delay expires, we should start connecting
+  // to the second server in parallel and use it once it's READY.
+  WaitForServer(DEBUG_LOCATION, stub, 1);
+  EXPECT_EQ(channel->GetState(false), GRPC_CHANNEL_READY);
+  // Letting the first attempt complete should not make us switch.
+  hold->Resume();
+  CheckRpcSendOk(DEBUG_LOCATION, stub);
+  EXPECT_EQ(servers_[0]->service_.request_count(), 0);
+}
+
 TEST_F(PickFirstTest, StaysIdleUponEmptyUpdate) {
   // Start server, send RPC, and make sure channel is READY.
   const int kNumServers = 1;
@@ -2191,6 +2234,157 @@ TEST_F(RoundRobinTest,
   EnableDefaultHealthCheckService(false);
 }
 
+//
+// least_request tests
+//
+
+using LeastRequestTest = ClientLbEnd2endTest;
+
+TEST_F(LeastRequestTest, Basic) {
+  const int kNumServers = 3;
+  StartServers(kNumServers);
+  auto response_generator = BuildResolverResponseGenerator();
+  auto channel = BuildChannel("", response_generator);
+  auto stub = BuildStub(channel);
+  response_generator.SetNextResolution(
+      GetServersPorts(),
+      "{\"loadBalancingConfig\": [{\"least_request\": {"
+      "\"choiceCount\": 2}}]}");
+  // With sequential RPCs every backend has no outstanding requests, so
+  // picks are spread randomly across all of them.
+  WaitForServers(DEBUG_LOCATION, stub);
+  EXPECT_EQ("least_request", channel->GetLoadBalancingPolicyName());
+}
+
+TEST_F(LeastRequestTest, Updates) {
+  const int kNumServers = 3;
+  StartServers(kNumServers);
+  auto response_generator = BuildResolverResponseGenerator();
+  auto channel = BuildChannel("", response_generator);
+  auto stub = BuildStub(channel);
+  const char* kServiceConfig =
+      "{\"loadBalancingConfig\": [{\"least_request\": {}}]}";
+  response_generator.SetNextResolution(GetServersPorts(0, 1), kServiceConfig);
+  WaitForServer(DEBUG_LOCATION, stub, 0);
+  // Switch to the remaining servers; all traffic moves over to them.
+  response_generator.SetNextResolution(GetServersPorts(1), kServiceConfig);
+  WaitForServers(DEBUG_LOCATION, stub, 1);
+  ResetCounters();
+  for (int i = 0; i < 10; ++i) CheckRpcSendOk(DEBUG_LOCATION, stub);
+  EXPECT_EQ(0, servers_[0]->service_.request_count());
+}
+
+//
+// weighted_round_robin tests
+//
+
+class WeightedRoundRobinTest : public ClientLbEnd2endTest {
+ protected:
+  // Sends batches of RPCs until the fraction of them seen by each server
+  // is within 10% of the fraction implied by expected_weights.
+  void WaitForWeightedRoundRobinPicks(
+      const grpc_core::DebugLocation& location,
+      const std::unique_ptr<grpc::testing::EchoTestService::Stub>& stub,
+      const std::vector<int>& expected_weights,
+      absl::Duration timeout = absl::Seconds(30)) {
+    const int kRpcsPerBatch = 700;
+    int total_weight = 0;
+    for (int weight : expected_weights) total_weight += weight;
+    auto deadline = absl::Now() + (timeout * grpc_test_slowdown_factor());
+    while (true) {
+      ResetCounters();
+      for (int i = 0; i < kRpcsPerBatch; ++i) {
+        CheckRpcSendOk(location, stub);
+      }
+      bool done = true;
+      std::vector<int> counts;
+      for (size_t i = 0; i < servers_.size(); ++i) {
+        const int count = servers_[i]->service_.request_count();
+        counts.push_back(count);
+        const double expected =
+            static_cast<double>(kRpcsPerBatch) * expected_weights[i] /
+            total_weight;
+        if (std::abs(count - expected) > expected * 0.1) done = false;
+      }
+      gpr_log(GPR_INFO, "request counts: %s",
+              absl::StrJoin(counts, ",").c_str());
+      if (done) break;
+      ASSERT_LE(absl::Now(), deadline)
+          << location.file() << ":" << location.line();
+    }
+  }
+};
+
+TEST_F(WeightedRoundRobinTest, CallAndServerMetric) {
+  const int kNumServers = 3;
+  StartServers(kNumServers);
+  // Weights are qps / cpu_utilization, i.e. 400 : 200 : 100.
+  servers_[0]->service_.SetCallMetrics(100, 0.25);
+  servers_[1]->service_.SetCallMetrics(100, 0.5);
+  servers_[2]->service_.SetCallMetrics(100, 1);
+  auto response_generator = BuildResolverResponseGenerator();
+  auto channel = BuildChannel("", response_generator);
+  auto stub = BuildStub(channel);
+  response_generator.SetNextResolution(
+      GetServersPorts(),
+      "{\"loadBalancingConfig\": [{\"weighted_round_robin\": {"
+      "\"blackoutPeriod\": \"0s\", \"weightUpdatePeriod\": \"0.1s\""
+      "}}]}");
+  // Before any weights are known, all backends get the same share.
+  WaitForServers(DEBUG_LOCATION, stub);
+  WaitForWeightedRoundRobinPicks(DEBUG_LOCATION, stub, {4, 2, 1});
+  EXPECT_EQ("weighted_round_robin", channel->GetLoadBalancingPolicyName());
+}
+
+TEST_F(WeightedRoundRobinTest, OobReporting) {
+  const int kNumServers = 3;
+  StartServers(kNumServers);
+  servers_[0]->orca_service_.SetQps(100);
+  servers_[0]->orca_service_.SetCpuUtilization(0.25);
+  servers_[1]->orca_service_.SetQps(100);
+  servers_[1]->orca_service_.SetCpuUtilization(0.5);
+  servers_[2]->orca_service_.SetQps(100);
+  servers_[2]->orca_service_.SetCpuUtilization(1);
+  auto response_generator = BuildResolverResponseGenerator();
+  auto channel = BuildChannel("", response_generator);
+  auto stub = BuildStub(channel);
+  response_generator.SetNextResolution(
+      GetServersPorts(),
+      "{\"loadBalancingConfig\": [{\"weighted_round_robin\": {"
+      "\"enableOobLoadReport\": true, \"blackoutPeriod\": \"0s\", "
+      "\"weightUpdatePeriod\": \"0.1s\"}}]}");
+  WaitForServers(DEBUG_LOCATION, stub);
+  WaitForWeightedRoundRobinPicks(DEBUG_LOCATION, stub, {4, 2, 1});
+}
+
+TEST_F(WeightedRoundRobinTest, WeightsExpire) {
+  const int kNumServers = 3;
+  StartServers(kNumServers);
+  servers_[0]->service_.SetCallMetrics(100, 0.25);
+  servers_[1]->service_.SetCallMetrics(100, 0.5);
+  servers_[2]->service_.SetCallMetrics(100, 1);
+  auto response_generator = BuildResolverResponseGenerator();
+  auto channel = BuildChannel("", response_generator);
+  auto stub = BuildStub(channel);
+  response_generator.SetNextResolution(
+      GetServersPorts(),
+      "{\"loadBalancingConfig\": [{\"weighted_round_robin\": {"
+      "\"blackoutPeriod\": \"0s\", \"weightUpdatePeriod\": \"0.1s\", "
+      "\"weightExpirationPeriod\": \"1s\"}}]}");
+  WaitForServers(DEBUG_LOCATION, stub);
+  WaitForWeightedRoundRobinPicks(DEBUG_LOCATION, stub, {4, 2, 1});
+  // Stop sending RPCs so that no new reports arrive.  Once the weights
+  // expire, the policy falls back to plain round robin.
+  gpr_sleep_until(grpc_timeout_seconds_to_deadline(2));
+  ResetCounters();
+  for (int i = 0; i < kNumServers; ++i) {
+    CheckRpcSendOk(DEBUG_LOCATION, stub);
+  }
+  for (int i = 0; i < kNumServers; ++i) {
+    EXPECT_EQ(1, servers_[i]->service_.request_count()) << "server " << i;
+  }
+}
+
 //
 // LB policy pick args
 //
@@ -2289,6 +2483,7 @@ xds::data::orca::v3::OrcaLoadReport BackendMetricDataToOrcaLoadReport(
   xds::data::orca::v3::OrcaLoadReport load_report;
   load_report.set_cpu_utilization(backend_metric_data.cpu_utilization);
   load_report.set_mem_utilization(backend_metric_data.mem_utilization);
+  load_report.set_rps(backend_metric_data.qps);
   for (const auto& p : backend_metric_data.request_cost) {
     std::string name(p.first);
     (*load_report.mutable_request_cost())[name] = p.second;
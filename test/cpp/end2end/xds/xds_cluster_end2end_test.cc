@@ -124,10 +124,10 @@ TEST_P(CdsTest, AcceptsEdsConfigSourceOfTypeAds) {
 }
 
 // Tests that CDS client should send a NACK if the lb_policy in CDS response
-// is other than ROUND_ROBIN.
+// is not one of the supported policies.
 TEST_P(CdsTest, WrongLbPolicy) {
   auto cluster = default_cluster_;
-  cluster.set_lb_policy(Cluster::LEAST_REQUEST);
+  cluster.set_lb_policy(Cluster::RANDOM);
   balancer_->ads_service()->SetCdsResource(cluster);
   const auto response_state = WaitForCdsNack(DEBUG_LOCATION);
   ASSERT_TRUE(response_state.has_value()) << "timed out waiting for NACK";
@@ -135,6 +135,37 @@ TEST_P(CdsTest, WrongLbPolicy) {
               ::testing::HasSubstr("LB policy is not supported."));
 }
 
+// Tests that CDS client accepts the LEAST_REQUEST lb_policy and sends
+// traffic to every backend.
+TEST_P(CdsTest, LeastRequestLbPolicy) {
+  CreateAndStartBackends(2);
+  auto cluster = default_cluster_;
+  cluster.set_lb_policy(Cluster::LEAST_REQUEST);
+  cluster.mutable_least_request_lb_config()->mutable_choice_count()->set_value(
+      3);
+  balancer_->ads_service()->SetCdsResource(cluster);
+  EdsResourceArgs args({{"locality0", CreateEndpointsForBackends()}});
+  balancer_->ads_service()->SetEdsResource(BuildEdsResource(args));
+  WaitForAllBackends(DEBUG_LOCATION);
+  auto response_state = balancer_->ads_service()->cds_response_state();
+  ASSERT_TRUE(response_state.has_value());
+  EXPECT_EQ(response_state->state, AdsServiceImpl::ResponseState::ACKED);
+}
+
+// Tests that CDS client should send a NACK if the least request choice_count
+// is less than 2.
+TEST_P(CdsTest, LeastRequestChoiceCountTooSmall) {
+  auto cluster = default_cluster_;
+  cluster.set_lb_policy(Cluster::LEAST_REQUEST);
+  cluster.mutable_least_request_lb_config()->mutable_choice_count()->set_value(
+      1);
+  balancer_->ads_service()->SetCdsResource(cluster);
+  const auto response_state = WaitForCdsNack(DEBUG_LOCATION);
+  ASSERT_TRUE(response_state.has_value()) << "timed out waiting for NACK";
+  EXPECT_THAT(response_state->error_message,
+              ::testing::HasSubstr("choice_count must be at least 2."));
+}
+
 // Tests that CDS client should send a NACK if the lrs_server in CDS response
 // is other than SELF.
 TEST_P(CdsTest, WrongLrsServer) {
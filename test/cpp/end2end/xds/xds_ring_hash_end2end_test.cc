@@ -1262,6 +1262,128 @@ TEST_P(RingHashTest, InvalidRingSizeMinGreaterThanMax) {
                   "min_ring_size cannot be greater than max_ring_size."));
 }
 
+//
+// maglev tests
+//
+
+// The maglev policy shares the request hash plumbing and the connectivity
+// handling with ring hash, so it reuses the same fixture.
+using MaglevTest = RingHashTest;
+
+INSTANTIATE_TEST_SUITE_P(XdsTest, MaglevTest, ::testing::Values(XdsTestType()),
+                         &XdsTestType::Name);
+
+// Tests that maglev policy that hashes using channel id ensures all RPCs
+// to go 1 particular backend.
+TEST_P(MaglevTest, ChannelIdHashing) {
+  CreateAndStartBackends(4);
+  auto cluster = default_cluster_;
+  cluster.set_lb_policy(Cluster::MAGLEV);
+  balancer_->ads_service()->SetCdsResource(cluster);
+  auto new_route_config = default_route_config_;
+  auto* route = new_route_config.mutable_virtual_hosts(0)->mutable_routes(0);
+  auto* hash_policy = route->mutable_route()->add_hash_policy();
+  hash_policy->mutable_filter_state()->set_key("io.grpc.channel_id");
+  SetListenerAndRouteConfiguration(balancer_.get(), default_listener_,
+                                   new_route_config);
+  EdsResourceArgs args({{"locality0", CreateEndpointsForBackends()}});
+  balancer_->ads_service()->SetEdsResource(BuildEdsResource(args));
+  CheckRpcSendOk(DEBUG_LOCATION, 100, RpcOptions().set_timeout_ms(5000));
+  bool found = false;
+  for (size_t i = 0; i < backends_.size(); ++i) {
+    if (backends_[i]->backend_service()->request_count() > 0) {
+      EXPECT_EQ(backends_[i]->backend_service()->request_count(), 100)
+          << "backend " << i;
+      EXPECT_FALSE(found) << "backend " << i;
+      found = true;
+    }
+  }
+  EXPECT_TRUE(found);
+}
+
+// Tests that random hashing with the maglev policy spreads RPCs across the
+// backends according to their weights.
+TEST_P(MaglevTest, EndpointWeights) {
+  CreateAndStartBackends(3);
+  const double kDistribution50Percent = 0.5;
+  const double kDistribution25Percent = 0.25;
+  const double kErrorTolerance = 0.05;
+  const size_t kNumRpcs =
+      ComputeIdealNumRpcs(kDistribution50Percent, kErrorTolerance);
+  auto cluster = default_cluster_;
+  cluster.set_lb_policy(Cluster::MAGLEV);
+  balancer_->ads_service()->SetCdsResource(cluster);
+  // Endpoint 0 has weight 0, will be treated as weight 1.
+  // Endpoint 1 has weight 1.
+  // Endpoint 2 has weight 2.
+  EdsResourceArgs args(
+      {{"locality0",
+        {CreateEndpoint(0, ::envoy::config::endpoint::v3::HealthStatus::UNKNOWN,
+                        0),
+         CreateEndpoint(1, ::envoy::config::endpoint::v3::HealthStatus::UNKNOWN,
+                        1),
+         CreateEndpoint(2, ::envoy::config::endpoint::v3::HealthStatus::UNKNOWN,
+                        2)}}});
+  balancer_->ads_service()->SetEdsResource(BuildEdsResource(args));
+  WaitForAllBackends(DEBUG_LOCATION, 0, 3);
+  CheckRpcSendOk(DEBUG_LOCATION, kNumRpcs);
+  // Endpoint 2 should see 50% of traffic, and endpoints 0 and 1 should
+  // each see 25% of traffic.
+  const int request_count_0 = backends_[0]->backend_service()->request_count();
+  const int request_count_1 = backends_[1]->backend_service()->request_count();
+  const int request_count_2 = backends_[2]->backend_service()->request_count();
+  EXPECT_THAT(static_cast<double>(request_count_0) / kNumRpcs,
+              ::testing::DoubleNear(kDistribution25Percent, kErrorTolerance));
+  EXPECT_THAT(static_cast<double>(request_count_1) / kNumRpcs,
+              ::testing::DoubleNear(kDistribution25Percent, kErrorTolerance));
+  EXPECT_THAT(static_cast<double>(request_count_2) / kNumRpcs,
+              ::testing::DoubleNear(kDistribution50Percent, kErrorTolerance));
+}
+
+// Test that maglev policy moves on to the next backend in the table when
+// the one the hash maps to is down.
+TEST_P(MaglevTest, TransientFailureCheckNextOne) {
+  CreateAndStartBackends(1);
+  auto cluster = default_cluster_;
+  cluster.set_lb_policy(Cluster::MAGLEV);
+  balancer_->ads_service()->SetCdsResource(cluster);
+  auto new_route_config = default_route_config_;
+  auto* route = new_route_config.mutable_virtual_hosts(0)->mutable_routes(0);
+  auto* hash_policy = route->mutable_route()->add_hash_policy();
+  hash_policy->mutable_header()->set_header_name("address_hash");
+  SetListenerAndRouteConfiguration(balancer_.get(), default_listener_,
+                                   new_route_config);
+  std::vector<EdsResourceArgs::Endpoint> endpoints;
+  const int unused_port = grpc_pick_unused_port_or_die();
+  endpoints.emplace_back(unused_port);
+  endpoints.emplace_back(backends_[0]->port());
+  EdsResourceArgs args({{"locality0", std::move(endpoints)}});
+  balancer_->ads_service()->SetEdsResource(BuildEdsResource(args));
+  // Roughly half of the hash values map to the unreachable endpoint, so
+  // with several distinct values at least one is all but certain to.
+  for (int i = 0; i < 16; ++i) {
+    std::vector<std::pair<std::string, std::string>> metadata = {
+        {"address_hash", absl::StrCat(i)}};
+    const auto rpc_options =
+        RpcOptions().set_metadata(std::move(metadata)).set_timeout_ms(5000);
+    WaitForBackend(DEBUG_LOCATION, 0, /*check_status=*/nullptr,
+                   WaitForBackendOptions(), rpc_options);
+  }
+}
+
+// Test we nack when maglev policy has a table size that is not prime.
+TEST_P(MaglevTest, InvalidTableSize) {
+  auto cluster = default_cluster_;
+  cluster.set_lb_policy(Cluster::MAGLEV);
+  cluster.mutable_maglev_lb_config()->mutable_table_size()->set_value(65536);
+  balancer_->ads_service()->SetCdsResource(cluster);
+  const auto response_state = WaitForCdsNack(DEBUG_LOCATION);
+  ASSERT_TRUE(response_state.has_value()) << "timed out waiting for NACK";
+  EXPECT_THAT(response_state->error_message,
+              ::testing::HasSubstr("table_size must be a prime number no "
+                                   "larger than 5000011."));
+}
+
 }  // namespace
 }  // namespace testing
 }  // namespace grpc
@@ -20,18 +20,25 @@
 
 #include <benchmark/benchmark.h>
 
+#include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/resource_quota/arena.h"
+#include "src/core/lib/resource_quota/arena_pool.h"
 #include "src/core/lib/resource_quota/resource_quota.h"
 #include "test/core/util/test_config.h"
 #include "test/cpp/microbenchmarks/helpers.h"
 #include "test/cpp/util/test_config.h"
 
 using grpc_core::Arena;
+using grpc_core::ArenaPool;
 
 static auto* g_memory_allocator = new grpc_core::MemoryAllocator(
     grpc_core::ResourceQuota::Default()->memory_quota()->CreateMemoryAllocator(
         "test"));
 
+static auto* g_memory_owner = new grpc_core::MemoryOwner(
+    grpc_core::ResourceQuota::Default()->memory_quota()->CreateMemoryOwner(
+        "test_pool"));
+
 static void BM_Arena_NoOp(benchmark::State& state) {
   for (auto _ : state) {
     Arena::Create(state.range(0), g_memory_allocator)->Destroy();
@@ -66,6 +73,28 @@ static void BM_Arena_Batch(benchmark::State& state) {
 }
 BENCHMARK(BM_Arena_Batch)->Ranges({{1, 64 * 1024}, {1, 64}, {1, 1024}});
 
+static void BM_ArenaPool_NoOp(benchmark::State& state) {
+  grpc_core::ExecCtx exec_ctx;
+  ArenaPool pool(g_memory_owner);
+  for (auto _ : state) {
+    pool.Destroy(pool.CreateWithAlloc(state.range(0), 0).first);
+  }
+}
+BENCHMARK(BM_ArenaPool_NoOp)->Range(1, 1024 * 1024);
+
+static void BM_ArenaPool_Batch(benchmark::State& state) {
+  grpc_core::ExecCtx exec_ctx;
+  ArenaPool pool(g_memory_owner);
+  for (auto _ : state) {
+    Arena* a = pool.CreateWithAlloc(state.range(0), 0).first;
+    for (int i = 0; i < state.range(1); i++) {
+      a->Alloc(state.range(2));
+    }
+    pool.Destroy(a);
+  }
+}
+BENCHMARK(BM_ArenaPool_Batch)->Ranges({{1, 64 * 1024}, {1, 64}, {1, 1024}});
+
 // Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
 // and others do not. This allows us to support both modes.
 namespace benchmark {
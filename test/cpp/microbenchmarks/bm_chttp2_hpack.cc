@@ -22,6 +22,11 @@
 
 #include <memory>
 #include <sstream>
+#include <string>
+#include <vector>
+
+#include "absl/memory/memory.h"
+#include "absl/strings/str_cat.h"
 
 #include <benchmark/benchmark.h>
 
@@ -305,6 +310,30 @@ class RepresentativeServerTrailingMetadata {
   }
 };
 
+// Trailing metadata of a call failing with rich error details: kLength bytes
+// of serialized google.rpc.Status, base64 encoded on the wire.
+template <int kLength>
+class ServerTrailingMetadataWithStatusDetails {
+ public:
+  static constexpr bool kEnableTrueBinary = false;
+  static void Prepare(grpc_metadata_batch* b) {
+    b->Set(grpc_core::GrpcStatusMetadata(), GRPC_STATUS_INVALID_ARGUMENT);
+    b->Set(grpc_core::GrpcMessageMetadata(),
+           grpc_core::Slice::FromStaticString("invalid request"));
+    b->Append("grpc-status-details-bin", MakeBytes(), CrashOnAppendError);
+  }
+
+ private:
+  static grpc_core::Slice MakeBytes() {
+    std::vector<char> v;
+    v.reserve(kLength);
+    for (int i = 0; i < kLength; i++) {
+      v.push_back(static_cast<char>(rand()));
+    }
+    return grpc_core::Slice::FromCopiedBuffer(v);
+  }
+};
+
 BENCHMARK_TEMPLATE(BM_HpackEncoderEncodeHeader, EmptyBatch)->Args({0, 16384});
 // test with eof (shouldn't affect anything)
 BENCHMARK_TEMPLATE(BM_HpackEncoderEncodeHeader, EmptyBatch)->Args({1, 16384});
@@ -338,6 +367,76 @@ BENCHMARK_TEMPLATE(BM_HpackEncoderEncodeHeader,
 BENCHMARK_TEMPLATE(BM_HpackEncoderEncodeHeader,
                    RepresentativeServerTrailingMetadata)
     ->Args({1, 16384});
+BENCHMARK_TEMPLATE(BM_HpackEncoderEncodeHeader,
+                   ServerTrailingMetadataWithStatusDetails<256>)
+    ->Args({1, 16384});
+BENCHMARK_TEMPLATE(BM_HpackEncoderEncodeHeader,
+                   ServerTrailingMetadataWithStatusDetails<1024>)
+    ->Args({1, 16384});
+BENCHMARK_TEMPLATE(BM_HpackEncoderEncodeHeader,
+                   ServerTrailingMetadataWithStatusDetails<4096>)
+    ->Args({1, 16384});
+
+// Client initial metadata as sent by a service that attaches a tenant id, a
+// routing key and a bearer token to every call, plus a request id that is
+// unique to the call. Calls rotate over state.range(0) tenants.
+static void BM_HpackEncoderEncodeCustomMetadata(benchmark::State& state) {
+  TrackCounters track_counters;
+  grpc_core::ExecCtx exec_ctx;
+  const int num_tenants = state.range(0);
+  // Rewritten for every call; static slices are copied by the encoder
+  // whenever it needs to keep them.
+  char request_id[17] = {};
+  std::vector<grpc_core::ScopedArenaPtr> arenas;
+  std::vector<std::unique_ptr<grpc_metadata_batch>> batches;
+  for (int i = 0; i < num_tenants; i++) {
+    arenas.push_back(grpc_core::MakeScopedArena(1024, g_memory_allocator));
+    batches.push_back(
+        absl::make_unique<grpc_metadata_batch>(arenas.back().get()));
+    grpc_metadata_batch* b = batches.back().get();
+    MoreRepresentativeClientInitialMetadata::Prepare(b);
+    b->Append("x-tenant-id",
+              grpc_core::Slice::FromCopiedString(absl::StrCat("tenant-", i)),
+              CrashOnAppendError);
+    b->Append("x-routing-key",
+              grpc_core::Slice::FromCopiedString(absl::StrCat("shard-", i % 4)),
+              CrashOnAppendError);
+    b->Append("authorization",
+              grpc_core::Slice::FromCopiedString(absl::StrCat(
+                  "Bearer ", std::string(240, static_cast<char>('a' + i % 26)),
+                  i)),
+              CrashOnAppendError);
+    b->Append("x-request-id",
+              grpc_core::Slice::FromStaticString(
+                  absl::string_view(request_id, sizeof(request_id) - 1)),
+              CrashOnAppendError);
+  }
+
+  grpc_core::HPackCompressor c;
+  grpc_transport_one_way_stats stats;
+  stats = {};
+  grpc_slice_buffer outbuf;
+  grpc_slice_buffer_init(&outbuf);
+  uint64_t call = 0;
+  while (state.KeepRunning()) {
+    snprintf(request_id, sizeof(request_id), "%016" PRIx64,
+             call * 0x9e3779b97f4a7c15);
+    c.EncodeHeaders(
+        grpc_core::HPackCompressor::EncodeHeaderOptions{
+            static_cast<uint32_t>(call), false, true, 16384, &stats},
+        *batches[call % num_tenants], &outbuf);
+    call++;
+    grpc_slice_buffer_reset_and_unref(&outbuf);
+    grpc_core::ExecCtx::Get()->Flush();
+  }
+  grpc_slice_buffer_destroy(&outbuf);
+
+  state.counters["header_bytes_per_call"] =
+      benchmark::Counter(static_cast<double>(stats.header_bytes),
+                         benchmark::Counter::kAvgIterations);
+  track_counters.Finish(state);
+}
+BENCHMARK(BM_HpackEncoderEncodeCustomMetadata)->Arg(1)->Arg(8)->Arg(64);
 
 }  // namespace hpack_encoder_fixtures
 
@@ -624,6 +723,9 @@ using RepresentativeServerTrailingMetadata = FromEncoderFixture<
     hpack_encoder_fixtures::RepresentativeServerTrailingMetadata>;
 using MoreRepresentativeClientInitialMetadata = FromEncoderFixture<
     hpack_encoder_fixtures::MoreRepresentativeClientInitialMetadata>;
+template <int kLength>
+using ServerTrailingMetadataWithStatusDetails = FromEncoderFixture<
+    hpack_encoder_fixtures::ServerTrailingMetadataWithStatusDetails<kLength>>;
 
 // Send the same deadline repeatedly
 class SameDeadline {
@@ -671,6 +773,12 @@ BENCHMARK_TEMPLATE(BM_HpackParserParseHeader,
                    MoreRepresentativeClientInitialMetadata);
 BENCHMARK_TEMPLATE(BM_HpackParserParseHeader,
                    RepresentativeServerInitialMetadata);
+BENCHMARK_TEMPLATE(BM_HpackParserParseHeader,
+                   ServerTrailingMetadataWithStatusDetails<256>);
+BENCHMARK_TEMPLATE(BM_HpackParserParseHeader,
+                   ServerTrailingMetadataWithStatusDetails<1024>);
+BENCHMARK_TEMPLATE(BM_HpackParserParseHeader,
+                   ServerTrailingMetadataWithStatusDetails<4096>);
 BENCHMARK_TEMPLATE(BM_HpackParserParseHeader, SameDeadline);
 
 }  // namespace hpack_parser_fixtures
@@ -23,6 +23,7 @@
 #include <memory>
 #include <queue>
 #include <sstream>
+#include <vector>
 
 #include <benchmark/benchmark.h>
 
@@ -33,6 +34,7 @@
 
 #include "src/core/ext/transport/chttp2/transport/chttp2_transport.h"
 #include "src/core/ext/transport/chttp2/transport/internal.h"
+#include "src/core/ext/transport/chttp2/transport/stream_map.h"
 #include "src/core/lib/iomgr/closure.h"
 #include "src/core/lib/resource_quota/api.h"
 #include "src/core/lib/slice/slice_internal.h"
@@ -410,6 +412,61 @@ static void BM_TransportEmptyOp(benchmark::State& state) {
 }
 BENCHMARK(BM_TransportEmptyOp);
 
+// Per-frame stream lookup on a connection with state.range(0) open streams,
+// using client-initiated (odd) stream ids. Lookups are spread over all open
+// streams, as when many concurrent streams are receiving data.
+static void BM_StreamMapFind(benchmark::State& state) {
+  const uint32_t num_streams = state.range(0);
+  grpc_chttp2_stream_map map;
+  grpc_chttp2_stream_map_init(&map, 8);
+  for (uint32_t i = 0; i < num_streams; i++) {
+    grpc_chttp2_stream_map_add(&map, 2 * i + 1,
+                               reinterpret_cast<void*>(uintptr_t{i + 1}));
+  }
+  uint32_t i = 0;
+  for (auto _ : state) {
+    // Visit the streams in a scattered order.
+    i = (i + 7919) % num_streams;
+    benchmark::DoNotOptimize(grpc_chttp2_stream_map_find(&map, 2 * i + 1));
+  }
+  grpc_chttp2_stream_map_destroy(&map);
+}
+BENCHMARK(BM_StreamMapFind)->Arg(1000)->Arg(10000)->Arg(100000);
+
+// Steady state stream churn with state.range(0) concurrent streams: each
+// iteration opens a new stream, looks up a random open one as if receiving a
+// frame, and closes a random open one, leaving holes that force compaction.
+static void BM_StreamMapChurn(benchmark::State& state) {
+  const size_t num_streams = state.range(0);
+  grpc_chttp2_stream_map map;
+  grpc_chttp2_stream_map_init(&map, 8);
+  std::vector<uint32_t> open_ids;
+  uint32_t next_id = 1;
+  for (size_t i = 0; i < num_streams; i++) {
+    grpc_chttp2_stream_map_add(&map, next_id,
+                               reinterpret_cast<void*>(uintptr_t{next_id}));
+    open_ids.push_back(next_id);
+    next_id += 2;
+  }
+  uint32_t rnd = 1;
+  for (auto _ : state) {
+    grpc_chttp2_stream_map_add(&map, next_id,
+                               reinterpret_cast<void*>(uintptr_t{next_id}));
+    open_ids.push_back(next_id);
+    next_id += 2;
+    rnd = rnd * 1103515245 + 12345;
+    benchmark::DoNotOptimize(grpc_chttp2_stream_map_find(
+        &map, open_ids[(rnd >> 8) % open_ids.size()]));
+    rnd = rnd * 1103515245 + 12345;
+    size_t victim = (rnd >> 8) % open_ids.size();
+    grpc_chttp2_stream_map_delete(&map, open_ids[victim]);
+    open_ids[victim] = open_ids.back();
+    open_ids.pop_back();
+  }
+  grpc_chttp2_stream_map_destroy(&map);
+}
+BENCHMARK(BM_StreamMapChurn)->Arg(1000)->Arg(10000)->Arg(100000);
+
 // Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
 // and others do not. This allows us to support both modes.
 namespace benchmark {
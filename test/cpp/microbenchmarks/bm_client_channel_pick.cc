@@ -0,0 +1,166 @@
+// Copyright 2022 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Drives unary calls from many threads through a single channel, so that
+// every call's LB pick in the client channel contends with the others.
+
+#include <memory>
+#include <sstream>
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include "absl/memory/memory.h"
+
+#include <grpc/support/log.h>
+#include <grpcpp/channel.h>
+#include <grpcpp/client_context.h>
+#include <grpcpp/completion_queue.h>
+#include <grpcpp/create_channel.h>
+#include <grpcpp/generic/async_generic_service.h>
+#include <grpcpp/generic/generic_stub.h>
+#include <grpcpp/security/credentials.h>
+#include <grpcpp/security/server_credentials.h>
+#include <grpcpp/server.h>
+#include <grpcpp/server_builder.h>
+#include <grpcpp/support/byte_buffer.h>
+#include <grpcpp/support/channel_arguments.h>
+
+#include "test/core/util/port.h"
+#include "test/core/util/test_config.h"
+#include "test/cpp/microbenchmarks/helpers.h"
+#include "test/cpp/util/test_config.h"
+
+namespace grpc {
+namespace testing {
+
+// Echoes the request of every call.
+class EchoGenericService : public CallbackGenericService {
+ public:
+  ServerGenericBidiReactor* CreateReactor(
+      GenericCallbackServerContext* /*context*/) override {
+    class Reactor : public ServerGenericBidiReactor {
+     public:
+      Reactor() { StartRead(&message_); }
+
+      void OnReadDone(bool ok) override {
+        if (!ok) {
+          Finish(Status::OK);
+          return;
+        }
+        StartWriteAndFinish(&message_, WriteOptions(), Status::OK);
+      }
+
+      void OnDone() override { delete this; }
+
+     private:
+      ByteBuffer message_;
+    };
+    return new Reactor;
+  }
+};
+
+// Server and channel shared by all of the benchmark's threads.
+class SharedChannelFixture {
+ public:
+  SharedChannelFixture() : port_(grpc_pick_unused_port_or_die()) {
+    std::ostringstream addr;
+    addr << "localhost:" << port_;
+    ServerBuilder builder;
+    builder.AddListeningPort(addr.str(), InsecureServerCredentials());
+    builder.RegisterCallbackGenericService(&service_);
+    server_ = builder.BuildAndStart();
+    ChannelArguments args;
+    // Use a picker whose Pick() is itself cheap and lock-free, so that the
+    // cost being measured is the client channel's own.
+    args.SetLoadBalancingPolicyName("round_robin");
+    channel_ =
+        CreateCustomChannel(addr.str(), InsecureChannelCredentials(), args);
+    GPR_ASSERT(channel_->WaitForConnected(
+        grpc_timeout_seconds_to_deadline(10)));
+  }
+
+  ~SharedChannelFixture() {
+    channel_.reset();
+    server_->Shutdown(grpc_timeout_milliseconds_to_deadline(0));
+    grpc_recycle_unused_port(port_);
+  }
+
+  std::shared_ptr<Channel> channel() const { return channel_; }
+
+ private:
+  int port_;
+  EchoGenericService service_;
+  std::unique_ptr<Server> server_;
+  std::shared_ptr<Channel> channel_;
+};
+
+SharedChannelFixture* g_fixture;
+
+static void BM_ClientChannelPickContention(benchmark::State& state) {
+  if (state.thread_index() == 0) g_fixture = new SharedChannelFixture();
+  // Each thread runs its own calls to completion on its own completion
+  // queue; the channel, and hence its picker, is the only thing shared.
+  // The fixture is only guaranteed to exist once the benchmark loop has
+  // started on all threads.
+  std::unique_ptr<GenericStub> stub;
+  CompletionQueue cq;
+  ByteBuffer request;
+  for (auto _ : state) {
+    if (stub == nullptr) {
+      stub = absl::make_unique<GenericStub>(g_fixture->channel());
+    }
+    ClientContext context;
+    ByteBuffer response;
+    Status status;
+    auto call = stub->PrepareUnaryCall(&context, "/grpc.testing.Bench/Echo",
+                                       request, &cq);
+    call->StartCall();
+    call->Finish(&response, &status, &context);
+    void* tag;
+    bool ok;
+    GPR_ASSERT(cq.Next(&tag, &ok));
+    GPR_ASSERT(tag == &context && ok && status.ok());
+  }
+  state.SetItemsProcessed(state.iterations());
+  stub.reset();
+  cq.Shutdown();
+  void* tag;
+  bool ok;
+  while (cq.Next(&tag, &ok)) {
+  }
+  if (state.thread_index() == 0) {
+    delete g_fixture;
+    g_fixture = nullptr;
+  }
+}
+BENCHMARK(BM_ClientChannelPickContention)->ThreadRange(1, 64)->UseRealTime();
+
+}  // namespace testing
+}  // namespace grpc
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  LibraryInitializer libInit;
+  ::benchmark::Initialize(&argc, argv);
+  grpc::testing::InitTest(&argc, &argv, false);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
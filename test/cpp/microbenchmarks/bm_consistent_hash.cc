@@ -0,0 +1,127 @@
+// Copyright 2022 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Compares the ring_hash and maglev consistent hashing structures: the cost
+// of building them from an endpoint list, as happens on every EDS update,
+// and the cost of mapping a request hash to an endpoint on each pick.
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "absl/strings/str_cat.h"
+
+#include "src/core/ext/filters/client_channel/lb_policy/maglev/maglev.h"
+#include "src/core/ext/filters/client_channel/lb_policy/ring_hash/ring_hash.h"
+#include "test/core/util/test_config.h"
+
+namespace grpc_core {
+namespace {
+
+// Defaults of the respective LB policy configs.
+constexpr size_t kMinRingSize = 1024;
+constexpr size_t kMaxRingSize = 8388608;
+constexpr size_t kMaglevTableSize = 65537;
+
+std::vector<HashedEndpoint> MakeEndpoints(size_t num_endpoints) {
+  std::vector<HashedEndpoint> endpoints;
+  endpoints.reserve(num_endpoints);
+  for (size_t i = 0; i < num_endpoints; ++i) {
+    HashedEndpoint endpoint;
+    endpoint.address =
+        absl::StrCat("10.", (i >> 16) & 0xff, ".", (i >> 8) & 0xff, ".",
+                     i & 0xff, ":443");
+    endpoints.push_back(std::move(endpoint));
+  }
+  return endpoints;
+}
+
+// Request hashes are uniformly random 64-bit values, as produced by the xds
+// resolver.
+std::vector<uint64_t> MakeHashes() {
+  std::mt19937_64 rng(0);
+  std::vector<uint64_t> hashes(4096);
+  for (auto& h : hashes) h = rng();
+  return hashes;
+}
+
+void BM_RingHashBuild(benchmark::State& state) {
+  const auto endpoints = MakeEndpoints(state.range(0));
+  // Ring hash gives every endpoint at least one entry, so the ring grows
+  // with the endpoint count once it exceeds min_ring_size.
+  const size_t min_ring_size = state.range(1);
+  for (auto _ : state) {
+    RingHashRing ring(endpoints, min_ring_size, kMaxRingSize);
+    benchmark::DoNotOptimize(ring.entries().data());
+  }
+  state.SetItemsProcessed(state.iterations() * endpoints.size());
+}
+BENCHMARK(BM_RingHashBuild)
+    ->ArgsProduct({{10, 100, 1000}, {kMinRingSize, 65536}});
+
+void BM_MaglevBuild(benchmark::State& state) {
+  const auto endpoints = MakeEndpoints(state.range(0));
+  for (auto _ : state) {
+    MaglevTable table(endpoints, kMaglevTableSize);
+    benchmark::DoNotOptimize(table.entries().data());
+  }
+  state.SetItemsProcessed(state.iterations() * endpoints.size());
+}
+BENCHMARK(BM_MaglevBuild)->Arg(10)->Arg(100)->Arg(1000);
+
+void BM_RingHashPick(benchmark::State& state) {
+  RingHashRing ring(MakeEndpoints(state.range(0)), state.range(1),
+                    kMaxRingSize);
+  const auto hashes = MakeHashes();
+  size_t i = 0;
+  for (auto _ : state) {
+    const uint64_t h = hashes[i++ & (hashes.size() - 1)];
+    benchmark::DoNotOptimize(ring.entries()[ring.FindIndex(h)].endpoint_index);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_RingHashPick)
+    ->ArgsProduct({{10, 100, 1000}, {kMinRingSize, 65536}});
+
+void BM_MaglevPick(benchmark::State& state) {
+  MaglevTable table(MakeEndpoints(state.range(0)), kMaglevTableSize);
+  const auto hashes = MakeHashes();
+  size_t i = 0;
+  for (auto _ : state) {
+    const uint64_t h = hashes[i++ & (hashes.size() - 1)];
+    benchmark::DoNotOptimize(table.entries()[table.FindIndex(h)]);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_MaglevPick)->Arg(10)->Arg(100)->Arg(1000);
+
+}  // namespace
+}  // namespace grpc_core
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::benchmark::Initialize(&argc, argv);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
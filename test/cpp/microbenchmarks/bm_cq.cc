@@ -19,6 +19,9 @@
 /* This benchmark exists to ensure that the benchmark integration is
  * working */
 
+#include <memory>
+#include <vector>
+
 #include <benchmark/benchmark.h>
 
 #include <grpc/grpc.h>
@@ -121,6 +124,82 @@ static void BM_Pass1Core(benchmark::State& state) {
 }
 BENCHMARK(BM_Pass1Core);
 
+// Queue state.range(0) events, then drain them either one at a time with
+// grpc_completion_queue_next or with grpc_completion_queue_next_batch.
+// Items processed are events dequeued, so items/sec is events/sec for the
+// single core running the benchmark.
+static void PassNCore(benchmark::State& state, bool batch) {
+  TrackCounters track_counters;
+  const int n = state.range(0);
+  grpc_completion_queue* cq = grpc_completion_queue_create_for_next(nullptr);
+  gpr_timespec deadline = gpr_inf_future(GPR_CLOCK_MONOTONIC);
+  std::vector<grpc_cq_completion> completions(n);
+  std::vector<grpc_event> events(n);
+  for (auto _ : state) {
+    {
+      grpc_core::ExecCtx exec_ctx;
+      for (int i = 0; i < n; i++) {
+        GPR_ASSERT(grpc_cq_begin_op(cq, nullptr));
+        grpc_cq_end_op(cq, nullptr, GRPC_ERROR_NONE,
+                       DoneWithCompletionOnStack, nullptr, &completions[i]);
+      }
+    }
+    for (int drained = 0; drained < n;) {
+      if (batch) {
+        drained += grpc_completion_queue_next_batch(cq, events.data(),
+                                                    n - drained, deadline,
+                                                    nullptr);
+      } else {
+        grpc_completion_queue_next(cq, deadline, nullptr);
+        drained++;
+      }
+    }
+  }
+  grpc_completion_queue_shutdown(cq);
+  grpc_completion_queue_next(cq, deadline, nullptr);
+  grpc_completion_queue_destroy(cq);
+  state.SetItemsProcessed(state.iterations() * n);
+  track_counters.Finish(state);
+}
+
+static void BM_PassNCore(benchmark::State& state) {
+  PassNCore(state, /*batch=*/false);
+}
+BENCHMARK(BM_PassNCore)->Range(1, 64);
+
+static void BM_PassNCoreBatch(benchmark::State& state) {
+  PassNCore(state, /*batch=*/true);
+}
+BENCHMARK(BM_PassNCoreBatch)->Range(1, 64);
+
+// As BM_PassNCoreBatch, through CompletionQueue::NextBatch.
+static void BM_PassNCppBatch(benchmark::State& state) {
+  TrackCounters track_counters;
+  const int n = state.range(0);
+  CompletionQueue cq;
+  grpc_completion_queue* c_cq = cq.cq();
+  std::vector<grpc_cq_completion> completions(n);
+  std::vector<PhonyTag> phony_tags(n);
+  std::vector<void*> tags(n);
+  std::unique_ptr<bool[]> oks(new bool[n]);
+  for (auto _ : state) {
+    {
+      grpc_core::ExecCtx exec_ctx;
+      for (int i = 0; i < n; i++) {
+        GPR_ASSERT(grpc_cq_begin_op(c_cq, &phony_tags[i]));
+        grpc_cq_end_op(c_cq, &phony_tags[i], GRPC_ERROR_NONE,
+                       DoneWithCompletionOnStack, nullptr, &completions[i]);
+      }
+    }
+    for (int drained = 0; drained < n;) {
+      drained += cq.NextBatch(tags.data(), oks.get(), n - drained);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+  track_counters.Finish(state);
+}
+BENCHMARK(BM_PassNCppBatch)->Range(1, 64);
+
 static void BM_Pluck1Core(benchmark::State& state) {
   TrackCounters track_counters;
   // TODO(sreek): Templatize this benchmark and pass polling_type as a param
@@ -114,13 +114,18 @@ static grpc_event_engine_vtable make_engine_vtable(const char* name) {
   return vtable;
 }
 
-static void setup() {
+static void setup(bool sharded) {
   grpc_init();
   GPR_ASSERT(strcmp(grpc_get_poll_strategy_name(), "none") == 0 ||
              strcmp(grpc_get_poll_strategy_name(), "bm_cq_multiple_threads") ==
                  0);
 
-  g_cq = grpc_completion_queue_create_for_next(nullptr);
+  grpc_completion_queue_attributes attr = {GRPC_CQ_CURRENT_VERSION,
+                                           GRPC_CQ_NEXT,
+                                           GRPC_CQ_DEFAULT_POLLING, nullptr,
+                                           sharded};
+  g_cq = grpc_completion_queue_create(
+      grpc_completion_queue_factory_lookup(&attr), &attr, nullptr);
 }
 
 static void teardown() {
@@ -157,14 +162,14 @@ static void teardown() {
  and its Finish call must take place before grpc_shutdown so that it can use
  grpc_stats).
 */
-static void BM_Cq_Throughput(benchmark::State& state) {
+static void CqThroughput(benchmark::State& state, bool sharded) {
   gpr_timespec deadline = gpr_inf_future(GPR_CLOCK_MONOTONIC);
   auto thd_idx = state.thread_index();
 
   gpr_mu_lock(&g_mu);
   g_threads_active++;
   if (thd_idx == 0) {
-    setup();
+    setup(sharded);
     g_active = true;
     gpr_cv_broadcast(&g_cv);
   } else {
@@ -203,8 +208,19 @@ static void BM_Cq_Throughput(benchmark::State& state) {
   }
 }
 
+static void BM_Cq_Throughput(benchmark::State& state) {
+  CqThroughput(state, /*sharded=*/false);
+}
 BENCHMARK(BM_Cq_Throughput)->ThreadRange(1, 16)->UseRealTime();
 
+// As above, but on a sharded completion queue: each thread's events are
+// queued on its own cpu's shard and can be drained without contending with
+// the other threads.
+static void BM_ShardedCq_Throughput(benchmark::State& state) {
+  CqThroughput(state, /*sharded=*/true);
+}
+BENCHMARK(BM_ShardedCq_Throughput)->ThreadRange(1, 16)->UseRealTime();
+
 namespace {
 const grpc_event_engine_vtable g_none_vtable =
     grpc::testing::make_engine_vtable("none");
@@ -0,0 +1,172 @@
+// Copyright 2022 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Compares the cost of driving many mostly-idle connections through the
+// epoll1 and io_uring PosixEventPoller implementations. Each iteration writes
+// one small message on every connection and then calls Work(...) until every
+// message has been read back, mimicking a server handling a burst of small
+// unary RPCs.
+//
+// Both pollers only report readiness: the reads and writes are plain syscalls
+// issued by the benchmark, in the same number for either poller. What differs
+// is how many Work(...) calls, each making at most one epoll_wait or
+// io_uring_enter syscall, it takes to drain a burst.
+
+#include <grpc/support/port_platform.h>
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "absl/functional/any_invocable.h"
+
+#include <grpc/support/log.h>
+
+#include "src/core/lib/event_engine/poller.h"
+#include "src/core/lib/event_engine/posix_engine/event_poller.h"
+#include "src/core/lib/event_engine/posix_engine/event_poller_posix_default.h"
+#include "src/core/lib/event_engine/posix_engine/posix_engine_closure.h"
+#include "src/core/lib/gprpp/global_config.h"
+#include "src/core/lib/iomgr/port.h"
+#include "test/core/util/test_config.h"
+
+#ifdef GRPC_POSIX_SOCKET_EV
+
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+GPR_GLOBAL_CONFIG_DECLARE_STRING(grpc_poll_strategy);
+
+namespace {
+
+using ::grpc_event_engine::experimental::EventEngine;
+using ::grpc_event_engine::experimental::Poller;
+using ::grpc_event_engine::posix_engine::EventHandle;
+using ::grpc_event_engine::posix_engine::GetDefaultPoller;
+using ::grpc_event_engine::posix_engine::PosixEngineClosure;
+using ::grpc_event_engine::posix_engine::PosixEventPoller;
+using ::grpc_event_engine::posix_engine::Scheduler;
+
+// Runs closures inline on the polling thread so that the benchmark measures
+// the poller rather than an executor.
+class InlineScheduler : public Scheduler {
+ public:
+  void Run(EventEngine::Closure* closure) override { closure->Run(); }
+  void Run(absl::AnyInvocable<void()> cb) override { cb(); }
+};
+
+struct Connection {
+  int client_fd;
+  int server_fd;
+  EventHandle* handle;
+  PosixEngineClosure* on_read;
+};
+
+void SetNonBlocking(int fd) {
+  int flags = fcntl(fd, F_GETFL, 0);
+  GPR_ASSERT(fcntl(fd, F_SETFL, flags | O_NONBLOCK) == 0);
+}
+
+template <const char* kStrategy>
+void BM_PollerPingPong(benchmark::State& state) {
+  const int num_connections = state.range(0);
+  InlineScheduler scheduler;
+  GPR_GLOBAL_CONFIG_SET(grpc_poll_strategy, kStrategy);
+  PosixEventPoller* poller = GetDefaultPoller(&scheduler);
+  if (poller == nullptr) {
+    state.SkipWithError("poll strategy not supported on this platform");
+    return;
+  }
+  int64_t messages_read = 0;
+  int64_t read_syscalls = 0;
+  std::vector<Connection> connections(num_connections);
+  for (auto& c : connections) {
+    int fds[2];
+    GPR_ASSERT(socketpair(AF_UNIX, SOCK_STREAM, 0, fds) == 0);
+    SetNonBlocking(fds[0]);
+    SetNonBlocking(fds[1]);
+    c.client_fd = fds[0];
+    c.server_fd = fds[1];
+    c.handle = poller->CreateHandle(c.server_fd, "bm", false);
+    Connection* conn = &c;
+    c.on_read = PosixEngineClosure::ToPermanentClosure(
+        [conn, &messages_read, &read_syscalls](absl::Status status) {
+          if (!status.ok()) return;
+          char buf[64];
+          for (;;) {
+            ++read_syscalls;
+            if (read(conn->server_fd, buf, sizeof(buf)) <= 0) break;
+            ++messages_read;
+          }
+          conn->handle->NotifyOnRead(conn->on_read);
+        });
+    c.handle->NotifyOnRead(c.on_read);
+  }
+  const char kMessage = 'x';
+  int64_t work_calls = 0;
+  int64_t expected = 0;
+  for (auto _ : state) {
+    for (auto& c : connections) {
+      GPR_ASSERT(write(c.client_fd, &kMessage, 1) == 1);
+    }
+    expected += num_connections;
+    while (messages_read < expected) {
+      ++work_calls;
+      poller->Work(std::chrono::seconds(1), [] {});
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * num_connections);
+  const double messages = static_cast<double>(std::max<int64_t>(expected, 1));
+  // An upper bound on the wait syscalls per message: a Work(...) call makes
+  // one only when no event is left over from a previous one.
+  state.counters["work_calls_per_msg"] =
+      static_cast<double>(work_calls) / messages;
+  // Includes the read that finds the socket drained. Add one write per
+  // message for the total data syscalls.
+  state.counters["read_syscalls_per_msg"] =
+      static_cast<double>(read_syscalls) / messages;
+  for (auto& c : connections) {
+    c.handle->ShutdownHandle(absl::CancelledError("bm done"));
+    c.handle->OrphanHandle(nullptr, nullptr, "bm done");
+    close(c.client_fd);
+    delete c.on_read;
+  }
+  poller->Shutdown();
+}
+
+constexpr char kEpoll1[] = "epoll1";
+constexpr char kIoUring[] = "io_uring";
+
+BENCHMARK_TEMPLATE(BM_PollerPingPong, kEpoll1)->Range(1, 4096);
+BENCHMARK_TEMPLATE(BM_PollerPingPong, kIoUring)->Range(1, 4096);
+
+}  // namespace
+
+#endif  // GRPC_POSIX_SOCKET_EV
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::benchmark::Initialize(&argc, argv);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
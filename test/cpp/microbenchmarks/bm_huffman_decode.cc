@@ -14,6 +14,7 @@
 
 #include <cstdint>
 #include <random>
+#include <vector>
 
 #include <benchmark/benchmark.h>
 
@@ -22,24 +23,43 @@
 #include "src/core/lib/slice/slice.h"
 #include "test/core/util/test_config.h"
 
-static const std::vector<uint8_t>* kInput = [] {
-  std::vector<uint8_t> v;
+static const std::vector<uint8_t>* kUncompressedInput = [] {
+  auto* v = new std::vector<uint8_t>();
   std::mt19937 rd(0);
   std::uniform_int_distribution<> dist_ty(0, 100);
   std::uniform_int_distribution<> dist_byte(0, 255);
   std::uniform_int_distribution<> dist_normal(32, 126);
   for (int i = 0; i < 1024 * 1024; i++) {
     if (dist_ty(rd) == 1) {
-      v.push_back(dist_byte(rd));
+      v->push_back(dist_byte(rd));
     } else {
-      v.push_back(dist_normal(rd));
+      v->push_back(dist_normal(rd));
     }
   }
-  grpc_core::Slice s = grpc_core::Slice::FromCopiedBuffer(v);
+  return v;
+}();
+
+static const std::vector<uint8_t>* kInput = [] {
+  grpc_core::Slice s = grpc_core::Slice::FromCopiedBuffer(*kUncompressedInput);
   grpc_core::Slice c(grpc_chttp2_huffman_compress(s.c_slice()));
   return new std::vector<uint8_t>(c.begin(), c.end());
 }();
 
+// Values typical of request headers, mostly too short for bulk decoding.
+static const std::vector<std::vector<uint8_t>>* kHeaderValues = [] {
+  auto* v = new std::vector<std::vector<uint8_t>>();
+  for (const char* value :
+       {"application/grpc", "grpc-c++/1.50.0 grpc-c/27.0.0 (linux; chttp2)",
+        "/grpc.testing.BenchmarkService/UnaryCall", "deflate, gzip",
+        "1234567m", "trailers", "x-request-id", "3f1c2a9e-8d4b-4c6f-a1e2",
+        "www.example.com:443", "gzip"}) {
+    grpc_core::Slice c(grpc_chttp2_huffman_compress(
+        grpc_core::Slice::FromStaticString(value).c_slice()));
+    v->emplace_back(c.begin(), c.end());
+  }
+  return v;
+}();
+
 static void BM_Decode(benchmark::State& state) {
   std::vector<uint8_t> output;
   auto add = [&output](uint8_t c) { output.push_back(c); };
@@ -52,6 +72,29 @@ static void BM_Decode(benchmark::State& state) {
 }
 BENCHMARK(BM_Decode);
 
+static void BM_DecodeHeaderValues(benchmark::State& state) {
+  std::vector<uint8_t> output;
+  auto add = [&output](uint8_t c) { output.push_back(c); };
+  for (auto _ : state) {
+    for (const auto& value : *kHeaderValues) {
+      output.clear();
+      grpc_core::HuffDecoder<decltype(add)>(add, value.data(),
+                                            value.data() + value.size())
+          .Run();
+    }
+  }
+}
+BENCHMARK(BM_DecodeHeaderValues);
+
+static void BM_Encode(benchmark::State& state) {
+  grpc_core::Slice input =
+      grpc_core::Slice::FromCopiedBuffer(*kUncompressedInput);
+  for (auto _ : state) {
+    grpc_slice_unref(grpc_chttp2_huffman_compress(input.c_slice()));
+  }
+}
+BENCHMARK(BM_Encode);
+
 // Legacy huffman decoder
 static void BM_LegacyDecode(benchmark::State& state) {
   /* state table for huffman decoding: given a state, gives an index/16 into
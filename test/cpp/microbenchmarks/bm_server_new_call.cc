@@ -0,0 +1,302 @@
+/*
+ *
+ * Copyright 2022 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+/* Benchmark new call admission on a server: each call is admitted, matched to
+   an application request and completed straight away, so the server's method
+   lookup and request matching dominate. */
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <grpc/grpc.h>
+#include <grpc/support/log.h>
+
+#include "src/core/ext/transport/inproc/inproc_transport.h"
+#include "test/core/util/test_config.h"
+#include "test/cpp/microbenchmarks/helpers.h"
+#include "test/cpp/util/test_config.h"
+
+namespace grpc {
+namespace testing {
+
+// Requests each server thread keeps outstanding on its completion queue.
+static const int kRequestsPerCq = 4;
+// Calls the client keeps in flight.
+static const int kClientCallsInFlight = 64;
+
+static gpr_timespec Forever() { return gpr_inf_future(GPR_CLOCK_REALTIME); }
+
+class ServerThread {
+ public:
+  // If methods is non-empty, requests are spread over those registered
+  // methods instead of being made for unregistered calls.
+  ServerThread(grpc_server* server, grpc_completion_queue* cq,
+               const std::vector<void*>& methods)
+      : server_(server),
+        cq_(cq),
+        slots_(kRequestsPerCq * std::max<size_t>(methods.size(), 1)) {
+    for (size_t i = 0; i < methods.size(); i++) {
+      for (int j = 0; j < kRequestsPerCq; j++) {
+        slots_[i * kRequestsPerCq + j].method = methods[i];
+      }
+    }
+  }
+
+  void Start() {
+    for (Slot& slot : slots_) RequestCall(&slot);
+    thread_ = std::thread([this] { Run(); });
+  }
+
+  void Join() { thread_.join(); }
+
+ private:
+  struct Slot;
+  struct Tag {
+    Slot* slot;
+    bool reply;
+  };
+  struct Slot {
+    void* method = nullptr;
+    grpc_call* call = nullptr;
+    gpr_timespec deadline;
+    grpc_call_details details;
+    grpc_metadata_array request_metadata;
+    int cancelled;
+    Tag request_tag{this, false};
+    Tag reply_tag{this, true};
+  };
+
+  void RequestCall(Slot* slot) {
+    grpc_call_details_init(&slot->details);
+    grpc_metadata_array_init(&slot->request_metadata);
+    // Requests fail once the completion queue is shut down at the end of the
+    // benchmark.
+    grpc_call_error error =
+        slot->method == nullptr
+            ? grpc_server_request_call(server_, &slot->call, &slot->details,
+                                       &slot->request_metadata, cq_, cq_,
+                                       &slot->request_tag)
+            : grpc_server_request_registered_call(
+                  server_, slot->method, &slot->call, &slot->deadline,
+                  &slot->request_metadata, nullptr, cq_, cq_,
+                  &slot->request_tag);
+    if (error != GRPC_CALL_OK) {
+      Cleanup(slot);
+    }
+  }
+
+  static void Cleanup(Slot* slot) {
+    grpc_call_details_destroy(&slot->details);
+    grpc_metadata_array_destroy(&slot->request_metadata);
+  }
+
+  void Reply(Slot* slot) {
+    grpc_op ops[3] = {};
+    ops[0].op = GRPC_OP_SEND_INITIAL_METADATA;
+    ops[1].op = GRPC_OP_SEND_STATUS_FROM_SERVER;
+    ops[1].data.send_status_from_server.status = GRPC_STATUS_OK;
+    ops[2].op = GRPC_OP_RECV_CLOSE_ON_SERVER;
+    ops[2].data.recv_close_on_server.cancelled = &slot->cancelled;
+    GPR_ASSERT(GRPC_CALL_OK == grpc_call_start_batch(slot->call, ops, 3,
+                                                     &slot->reply_tag,
+                                                     nullptr));
+  }
+
+  void Run() {
+    while (true) {
+      grpc_event ev = grpc_completion_queue_next(cq_, Forever(), nullptr);
+      if (ev.type == GRPC_QUEUE_SHUTDOWN) return;
+      GPR_ASSERT(ev.type == GRPC_OP_COMPLETE);
+      Tag* tag = static_cast<Tag*>(ev.tag);
+      if (!tag->reply) {
+        // A new call arrived, or the server is shutting down.
+        if (ev.success) {
+          Reply(tag->slot);
+        } else {
+          Cleanup(tag->slot);
+        }
+        continue;
+      }
+      grpc_call_unref(tag->slot->call);
+      Cleanup(tag->slot);
+      RequestCall(tag->slot);
+    }
+  }
+
+  grpc_server* const server_;
+  grpc_completion_queue* const cq_;
+  std::vector<Slot> slots_;
+  std::thread thread_;
+};
+
+class ClientCall {
+ public:
+  // Starts an unregistered call if method is null.
+  void Start(grpc_channel* channel, grpc_completion_queue* cq, void* method) {
+    call_ = method == nullptr
+                ? grpc_channel_create_call(
+                      channel, nullptr, GRPC_PROPAGATE_DEFAULTS, cq,
+                      grpc_slice_from_static_string("/bm/NewCall"), nullptr,
+                      Forever(), nullptr)
+                : grpc_channel_create_registered_call(
+                      channel, nullptr, GRPC_PROPAGATE_DEFAULTS, cq, method,
+                      Forever(), nullptr);
+    grpc_metadata_array_init(&initial_metadata_);
+    grpc_metadata_array_init(&trailing_metadata_);
+    grpc_op ops[4] = {};
+    ops[0].op = GRPC_OP_SEND_INITIAL_METADATA;
+    ops[1].op = GRPC_OP_SEND_CLOSE_FROM_CLIENT;
+    ops[2].op = GRPC_OP_RECV_INITIAL_METADATA;
+    ops[2].data.recv_initial_metadata.recv_initial_metadata =
+        &initial_metadata_;
+    ops[3].op = GRPC_OP_RECV_STATUS_ON_CLIENT;
+    ops[3].data.recv_status_on_client.trailing_metadata = &trailing_metadata_;
+    ops[3].data.recv_status_on_client.status = &status_;
+    ops[3].data.recv_status_on_client.status_details = &details_;
+    GPR_ASSERT(GRPC_CALL_OK ==
+               grpc_call_start_batch(call_, ops, 4, this, nullptr));
+  }
+
+  void Finish() {
+    GPR_ASSERT(status_ == GRPC_STATUS_OK);
+    grpc_metadata_array_destroy(&initial_metadata_);
+    grpc_metadata_array_destroy(&trailing_metadata_);
+    grpc_slice_unref(details_);
+    grpc_call_unref(call_);
+  }
+
+ private:
+  grpc_call* call_;
+  grpc_metadata_array initial_metadata_;
+  grpc_metadata_array trailing_metadata_;
+  grpc_status_code status_;
+  grpc_slice details_;
+};
+
+// Runs calls against a server with num_cqs completion queues, each served by
+// its own thread, and num_methods registered methods. Calls cycle through the
+// registered methods, or are unregistered if there are none.
+static void RunNewCalls(benchmark::State& state, int num_cqs,
+                        int num_methods) {
+  grpc_server* server = grpc_server_create(nullptr, nullptr);
+  std::vector<grpc_completion_queue*> cqs;
+  for (int i = 0; i < num_cqs; i++) {
+    cqs.push_back(grpc_completion_queue_create_for_next(nullptr));
+    grpc_server_register_completion_queue(server, cqs.back(), nullptr);
+  }
+  std::vector<std::string> paths;
+  std::vector<void*> server_methods;
+  for (int i = 0; i < num_methods; i++) {
+    paths.push_back("/bm.Service/Method" + std::to_string(i));
+    server_methods.push_back(grpc_server_register_method(
+        server, paths.back().c_str(), nullptr, GRPC_SRM_PAYLOAD_NONE, 0));
+  }
+  grpc_server_start(server);
+  std::vector<std::unique_ptr<ServerThread>> threads;
+  for (grpc_completion_queue* cq : cqs) {
+    threads.emplace_back(new ServerThread(server, cq, server_methods));
+    threads.back()->Start();
+  }
+
+  grpc_channel* channel = grpc_inproc_channel_create(server, nullptr, nullptr);
+  std::vector<void*> client_methods;
+  for (const std::string& path : paths) {
+    client_methods.push_back(
+        grpc_channel_register_call(channel, path.c_str(), nullptr, nullptr));
+  }
+  size_t next_method = 0;
+  auto pick_method = [&]() -> void* {
+    if (client_methods.empty()) return nullptr;
+    next_method = (next_method + 1) % client_methods.size();
+    return client_methods[next_method];
+  };
+  grpc_completion_queue* client_cq =
+      grpc_completion_queue_create_for_next(nullptr);
+  std::vector<ClientCall> calls(kClientCallsInFlight);
+  for (ClientCall& call : calls) call.Start(channel, client_cq, pick_method());
+  for (auto _ : state) {
+    grpc_event ev = grpc_completion_queue_next(client_cq, Forever(), nullptr);
+    GPR_ASSERT(ev.type == GRPC_OP_COMPLETE && ev.success);
+    ClientCall* call = static_cast<ClientCall*>(ev.tag);
+    call->Finish();
+    call->Start(channel, client_cq, pick_method());
+  }
+  for (int i = 0; i < kClientCallsInFlight; i++) {
+    grpc_event ev = grpc_completion_queue_next(client_cq, Forever(), nullptr);
+    GPR_ASSERT(ev.type == GRPC_OP_COMPLETE && ev.success);
+    static_cast<ClientCall*>(ev.tag)->Finish();
+  }
+  state.SetItemsProcessed(state.iterations());
+
+  grpc_channel_destroy(channel);
+  grpc_completion_queue_shutdown(client_cq);
+  GPR_ASSERT(grpc_completion_queue_next(client_cq, Forever(), nullptr).type ==
+             GRPC_QUEUE_SHUTDOWN);
+  grpc_completion_queue_destroy(client_cq);
+
+  grpc_completion_queue* shutdown_cq =
+      grpc_completion_queue_create_for_pluck(nullptr);
+  grpc_server_shutdown_and_notify(server, shutdown_cq, nullptr);
+  GPR_ASSERT(grpc_completion_queue_pluck(shutdown_cq, nullptr, Forever(),
+                                         nullptr)
+                 .type == GRPC_OP_COMPLETE);
+  grpc_completion_queue_destroy(shutdown_cq);
+  for (grpc_completion_queue* cq : cqs) grpc_completion_queue_shutdown(cq);
+  for (auto& thread : threads) thread->Join();
+  grpc_server_destroy(server);
+  for (grpc_completion_queue* cq : cqs) grpc_completion_queue_destroy(cq);
+}
+
+// Arg: number of server completion queues.
+static void BM_ServerNewCall(benchmark::State& state) {
+  RunNewCalls(state, state.range(0), 0);
+}
+BENCHMARK(BM_ServerNewCall)->Arg(1)->Arg(8)->Arg(64)->UseRealTime();
+
+// Arg: number of registered methods.
+static void BM_ServerRegisteredMethodCall(benchmark::State& state) {
+  RunNewCalls(state, 1, state.range(0));
+}
+BENCHMARK(BM_ServerRegisteredMethodCall)
+    ->Arg(1)
+    ->Arg(100)
+    ->Arg(500)
+    ->UseRealTime();
+
+}  // namespace testing
+}  // namespace grpc
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  LibraryInitializer libInit;
+  ::benchmark::Initialize(&argc, argv);
+  grpc::testing::InitTest(&argc, &argv, false);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
@@ -0,0 +1,153 @@
+// Copyright 2022 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Compares the heap and timing wheel backed TimerList implementations on the
+// typical RPC deadline pattern: every timer is armed and then cancelled long
+// before it fires. Each thread keeps a batch of timers outstanding, so with
+// many iterations millions of timers go through the list.
+
+#include <grpc/support/port_platform.h>
+
+#include <stdlib.h>
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/support/log.h>
+
+#include "src/core/lib/event_engine/posix_engine/timer.h"
+#include "src/core/lib/gprpp/time.h"
+#include "test/core/util/test_config.h"
+
+namespace {
+
+using ::grpc_event_engine::experimental::EventEngine;
+using ::grpc_event_engine::posix_engine::Timer;
+using ::grpc_event_engine::posix_engine::TimerList;
+using ::grpc_event_engine::posix_engine::TimerListHost;
+
+// A clock that only moves when told to, so that no timer fires while the
+// benchmark is arming and cancelling.
+class FakeHost final : public TimerListHost {
+ public:
+  grpc_core::Timestamp Now() override {
+    return grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(
+        now_.load(std::memory_order_relaxed));
+  }
+  void Kick() override {}
+  void Advance(int64_t millis) {
+    now_.fetch_add(millis, std::memory_order_relaxed);
+  }
+
+ private:
+  std::atomic<int64_t> now_{1000};
+};
+
+class NoopClosure : public EventEngine::Closure {
+ public:
+  void Run() override {}
+};
+
+FakeHost* g_host;
+TimerList* g_timer_list;
+
+void GlobalSetup(const benchmark::State& state) {
+  g_host = new FakeHost();
+  g_timer_list = new TimerList(g_host, state.range(0) != 0);
+}
+
+void GlobalTeardown(const benchmark::State& /* state */) {
+  delete g_timer_list;
+  delete g_host;
+}
+
+// Deadlines between 1ms and 20s, roughly like a mix of RPC deadlines and
+// keepalive timers.
+grpc_core::Duration RandomTimeout(unsigned int* seed) {
+  return grpc_core::Duration::Milliseconds(1 + rand_r(seed) % 20000);
+}
+
+// range(0): 1 to use the timing wheel, 0 to use the heap.
+// range(1): number of timers each thread keeps outstanding.
+void BM_TimerArmCancel(benchmark::State& state) {
+  const size_t batch_size = state.range(1);
+  std::vector<Timer> timers(batch_size);
+  NoopClosure closure;
+  unsigned int seed = state.thread_index();
+  for (auto _ : state) {
+    const grpc_core::Timestamp now = g_host->Now();
+    for (auto& timer : timers) {
+      g_timer_list->TimerInit(&timer, now + RandomTimeout(&seed), &closure);
+    }
+    for (auto& timer : timers) {
+      GPR_ASSERT(g_timer_list->TimerCancel(&timer));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * batch_size);
+}
+BENCHMARK(BM_TimerArmCancel)
+    ->Setup(GlobalSetup)
+    ->Teardown(GlobalTeardown)
+    ->ArgsProduct({{0, 1}, {1000, 100000}})
+    ->Threads(1)
+    ->Threads(4)
+    ->ThreadPerCpu()
+    ->UseRealTime()
+    ->MeasureProcessCPUTime();
+
+// Like BM_TimerArmCancel, but a tenth of the timers are left to fire after
+// the clock advances past their deadlines, as with RPCs that time out.
+void BM_TimerArmCancelAndFire(benchmark::State& state) {
+  const size_t batch_size = state.range(1);
+  std::vector<Timer> timers(batch_size);
+  NoopClosure closure;
+  unsigned int seed = 0;
+  for (auto _ : state) {
+    const grpc_core::Timestamp now = g_host->Now();
+    for (auto& timer : timers) {
+      g_timer_list->TimerInit(&timer, now + RandomTimeout(&seed), &closure);
+    }
+    for (size_t i = 0; i < batch_size; i++) {
+      if (i % 10 != 0) g_timer_list->TimerCancel(&timers[i]);
+    }
+    g_host->Advance(20001);
+    auto expired = g_timer_list->TimerCheck(nullptr);
+    GPR_ASSERT(expired.has_value());
+    GPR_ASSERT(expired->size() == (batch_size + 9) / 10);
+  }
+  state.SetItemsProcessed(state.iterations() * batch_size);
+}
+BENCHMARK(BM_TimerArmCancelAndFire)
+    ->Setup(GlobalSetup)
+    ->Teardown(GlobalTeardown)
+    ->ArgsProduct({{0, 1}, {1000, 100000}});
+
+}  // namespace
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::benchmark::Initialize(&argc, argv);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
@@ -0,0 +1,82 @@
+// Copyright 2022 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Benchmark the validation of application supplied metadata, as done for
+// every element sent on a call or returned by a credentials plugin.
+
+#include <random>
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include <grpc/grpc.h>
+#include <grpc/support/log.h>
+
+#include "src/core/lib/iomgr/error.h"
+#include "src/core/lib/slice/slice.h"
+#include "src/core/lib/surface/validate_metadata.h"
+#include "test/core/util/test_config.h"
+
+// A bearer token of length characters, shaped like the JWTs attached to calls
+// by call credentials.
+static std::string MakeBearerToken(size_t length) {
+  static const char kAlphabet[] =
+      "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+  std::mt19937 rd(0);
+  std::string token = "Bearer ";
+  while (token.size() < length) {
+    if (token.size() % 300 == 0) {
+      token.push_back('.');
+    } else {
+      token.push_back(kAlphabet[rd() % (sizeof(kAlphabet) - 1)]);
+    }
+  }
+  return token;
+}
+
+static void BM_ValidateHeaderKey(benchmark::State& state) {
+  grpc_core::Slice key =
+      grpc_core::Slice::FromStaticString("x-goog-request-params");
+  for (auto _ : state) {
+    grpc_error_handle error = grpc_validate_header_key_is_legal(key.c_slice());
+    GPR_ASSERT(GRPC_ERROR_IS_NONE(error));
+  }
+  state.SetBytesProcessed(state.iterations() * key.size());
+}
+BENCHMARK(BM_ValidateHeaderKey);
+
+static void BM_ValidateBearerTokenValue(benchmark::State& state) {
+  grpc_core::Slice value =
+      grpc_core::Slice::FromCopiedString(MakeBearerToken(state.range(0)));
+  for (auto _ : state) {
+    grpc_error_handle error =
+        grpc_validate_header_nonbin_value_is_legal(value.c_slice());
+    GPR_ASSERT(GRPC_ERROR_IS_NONE(error));
+  }
+  state.SetBytesProcessed(state.iterations() * value.size());
+}
+BENCHMARK(BM_ValidateBearerTokenValue)->Arg(32)->Arg(800)->Arg(4096);
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
@@ -13,9 +13,13 @@
 // limitations under the License.
 #include <grpc/support/port_platform.h>
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <cmath>
 #include <deque>
 #include <sstream>
+#include <thread>
 
 // ensure assert() is enabled
 #undef NDEBUG
@@ -26,13 +30,16 @@
 #include <grpc/support/log.h>
 
 #include "src/core/lib/event_engine/common_closures.h"
+#include "src/core/lib/event_engine/thread_pool.h"
 #include "src/core/lib/event_engine/work_queue.h"
+#include "src/core/lib/gprpp/notification.h"
 #include "test/core/util/test_config.h"
 
 namespace {
 
 using ::grpc_event_engine::experimental::AnyInvocableClosure;
 using ::grpc_event_engine::experimental::EventEngine;
+using ::grpc_event_engine::experimental::ThreadPool;
 using ::grpc_event_engine::experimental::WorkQueue;
 
 grpc_core::Mutex globalMu;
@@ -297,6 +304,97 @@ void BM_StdDequePerThread(benchmark::State& state) {
 }
 BENCHMARK(BM_StdDequePerThread)->Apply(PerThreadArguments);
 
+ThreadPool* globalThreadPool;
+
+void ThreadPoolSetup(const benchmark::State& state) {
+  globalThreadPool =
+      new ThreadPool(std::max(2u, std::thread::hardware_concurrency()),
+                     /*work_stealing=*/state.range(1) != 0);
+}
+
+void ThreadPoolTeardown(const benchmark::State& /* state */) {
+  delete globalThreadPool;
+}
+
+// Every benchmark thread is a producer adding closures to one shared pool and
+// waiting for them to run. Latency is measured from Add to the start of Run.
+void BM_ThreadPoolMultiProducer(benchmark::State& state) {
+  const int element_count = state.range(0);
+  ThreadPool* pool = globalThreadPool;
+  std::atomic<int64_t> total_latency_ns{0};
+  for (auto _ : state) {
+    std::atomic<int> remaining{element_count};
+    grpc_core::Notification done;
+    for (int i = 0; i < element_count; i++) {
+      auto enqueued = std::chrono::steady_clock::now();
+      pool->Add([enqueued, &total_latency_ns, &remaining, &done] {
+        total_latency_ns.fetch_add(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now() - enqueued)
+                .count(),
+            std::memory_order_relaxed);
+        if (remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+          done.Notify();
+        }
+      });
+    }
+    done.WaitForNotification();
+  }
+  state.SetItemsProcessed(element_count * state.iterations());
+  state.counters["Avg Latency us"] = benchmark::Counter(
+      total_latency_ns.load() / 1000.0 /
+          std::max<double>(1, element_count * state.iterations()),
+      benchmark::Counter::kAvgThreads);
+}
+BENCHMARK(BM_ThreadPoolMultiProducer)
+    ->Setup(ThreadPoolSetup)
+    ->Teardown(ThreadPoolTeardown)
+    ->ArgsProduct({/*element_count=*/{16, 256},
+                   /*work_stealing=*/{0, 1}})
+    ->UseRealTime()
+    ->MeasureProcessCPUTime()
+    ->Threads(1)
+    ->Threads(4)
+    ->ThreadPerCpu();
+
+// Closures that each schedule more closures from inside the pool, exercising
+// the local queue of each pool thread and stealing between them.
+void ScheduleFanOut(ThreadPool* pool, int depth, std::atomic<int>* remaining,
+                    grpc_core::Notification* done) {
+  if (depth > 0) {
+    for (int i = 0; i < 2; i++) {
+      pool->Add([pool, depth, remaining, done] {
+        ScheduleFanOut(pool, depth - 1, remaining, done);
+      });
+    }
+  }
+  if (remaining->fetch_sub(1, std::memory_order_acq_rel) == 1) done->Notify();
+}
+
+void BM_ThreadPoolFanOut(benchmark::State& state) {
+  const int depth = state.range(0);
+  // A full binary tree of the given depth has 2^(depth+1)-1 nodes.
+  const int element_count = (2 << depth) - 1;
+  ThreadPool* pool = globalThreadPool;
+  for (auto _ : state) {
+    std::atomic<int> remaining{element_count};
+    grpc_core::Notification done;
+    pool->Add([pool, depth, &remaining, &done] {
+      ScheduleFanOut(pool, depth, &remaining, &done);
+    });
+    done.WaitForNotification();
+  }
+  state.SetItemsProcessed(element_count * state.iterations());
+}
+BENCHMARK(BM_ThreadPoolFanOut)
+    ->Setup(ThreadPoolSetup)
+    ->Teardown(ThreadPoolTeardown)
+    ->ArgsProduct({/*depth=*/{8, 14}, /*work_stealing=*/{0, 1}})
+    ->UseRealTime()
+    ->MeasureProcessCPUTime()
+    ->Threads(1)
+    ->Threads(4);
+
 }  // namespace
 
 // Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
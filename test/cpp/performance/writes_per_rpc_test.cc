@@ -16,6 +16,9 @@
  *
  */
 
+#include <memory>
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include <grpc/support/log.h>
@@ -60,7 +63,8 @@ static void ApplyCommonChannelArguments(grpc_core::ChannelArgs* c) {
 
 class EndpointPairFixture {
  public:
-  EndpointPairFixture(Service* service, grpc_endpoint_pair endpoints) {
+  EndpointPairFixture(Service* service, grpc_endpoint_pair endpoints,
+                      const grpc_core::ChannelArgs& transport_args) {
     ServerBuilder b;
     cq_ = b.AddCompletionQueue(true);
     b.RegisterService(service);
@@ -74,7 +78,8 @@ class EndpointPairFixture {
       grpc_core::Server* core_server =
           grpc_core::Server::FromC(server_->c_server());
       grpc_transport* transport = grpc_create_chttp2_transport(
-          core_server->channel_args(), endpoints.server, false /* is_client */);
+          core_server->channel_args().UnionWith(transport_args),
+          endpoints.server, false /* is_client */);
       for (grpc_pollset* pollset : core_server->pollsets()) {
         grpc_endpoint_add_to_pollset(endpoints.server, pollset);
       }
@@ -94,6 +99,7 @@ class EndpointPairFixture {
               .PreconditionChannelArgs(nullptr)
               .Set(GRPC_ARG_DEFAULT_AUTHORITY, "test.authority");
       ApplyCommonChannelArguments(&args);
+      args = args.UnionWith(transport_args);
 
       grpc_transport* transport =
           grpc_create_chttp2_transport(args, endpoints.client, true);
@@ -132,8 +138,11 @@ class EndpointPairFixture {
 
 class InProcessCHTTP2 : public EndpointPairFixture {
  public:
-  InProcessCHTTP2(Service* service, grpc_passthru_endpoint_stats* stats)
-      : EndpointPairFixture(service, MakeEndpoints(stats)), stats_(stats) {}
+  InProcessCHTTP2(Service* service, grpc_passthru_endpoint_stats* stats,
+                  const grpc_core::ChannelArgs& transport_args =
+                      grpc_core::ChannelArgs())
+      : EndpointPairFixture(service, MakeEndpoints(stats), transport_args),
+        stats_(stats) {}
 
   ~InProcessCHTTP2() override {
     if (stats_ != nullptr) {
@@ -237,6 +246,89 @@ TEST(WritesPerRpcTest, UnaryPingPong) {
   EXPECT_LT(UnaryPingPong(0, 4096), 2.5);
 }
 
+// Runs batches of concurrent unary calls, each answered as soon as it reaches
+// the server, and returns the number of writes per call.
+static double ConcurrentUnary(int batch_size,
+                              const grpc_core::ChannelArgs& transport_args) {
+  const int kBatches = 200;
+  const intptr_t kFinishTag = 1000;
+  const intptr_t kClientTag = 2000;
+
+  EchoTestService::AsyncService service;
+  std::unique_ptr<InProcessCHTTP2> fixture(new InProcessCHTTP2(
+      &service, grpc_passthru_endpoint_stats_create(), transport_args));
+  EchoRequest send_request;
+  EchoResponse send_response;
+  send_request.set_message(std::string(16, 'a'));
+  send_response.set_message(std::string(16, 'a'));
+  struct ServerEnv {
+    ServerContext ctx;
+    EchoRequest recv_request;
+    grpc::ServerAsyncResponseWriter<EchoResponse> response_writer;
+    ServerEnv() : response_writer(&ctx) {}
+  };
+  std::vector<std::unique_ptr<ServerEnv>> server_env(batch_size);
+  auto request_echo = [&](intptr_t slot) {
+    server_env[slot].reset(new ServerEnv());
+    ServerEnv* senv = server_env[slot].get();
+    service.RequestEcho(&senv->ctx, &senv->recv_request,
+                        &senv->response_writer, fixture->cq(), fixture->cq(),
+                        tag(slot));
+  };
+  for (int slot = 0; slot < batch_size; slot++) request_echo(slot);
+  std::unique_ptr<EchoTestService::Stub> stub(
+      EchoTestService::NewStub(fixture->channel()));
+  for (int batch = 0; batch < kBatches; batch++) {
+    std::vector<std::unique_ptr<ClientContext>> cli_ctx(batch_size);
+    std::vector<EchoResponse> recv_response(batch_size);
+    std::vector<Status> recv_status(batch_size);
+    std::vector<std::unique_ptr<ClientAsyncResponseReader<EchoResponse>>>
+        response_reader(batch_size);
+    for (int i = 0; i < batch_size; i++) {
+      cli_ctx[i].reset(new ClientContext());
+      response_reader[i] =
+          stub->AsyncEcho(cli_ctx[i].get(), send_request, fixture->cq());
+      response_reader[i]->Finish(&recv_response[i], &recv_status[i],
+                                 tag(kClientTag + i));
+    }
+    // Each call is seen arriving at the server, finishing at the server and
+    // finishing at the client.
+    for (int events = 0; events < 3 * batch_size; events++) {
+      void* t;
+      bool ok;
+      GPR_ASSERT(fixture->cq()->Next(&t, &ok));
+      GPR_ASSERT(ok);
+      intptr_t tagnum = reinterpret_cast<intptr_t>(t);
+      if (tagnum < kFinishTag) {
+        server_env[tagnum]->response_writer.Finish(send_response, Status::OK,
+                                                   tag(kFinishTag + tagnum));
+      } else if (tagnum < kClientTag) {
+        request_echo(tagnum - kFinishTag);
+      } else {
+        GPR_ASSERT(recv_status[tagnum - kClientTag].ok());
+      }
+    }
+  }
+
+  double writes_per_call = static_cast<double>(fixture->writes_performed()) /
+                           static_cast<double>(kBatches * batch_size);
+
+  fixture.reset();
+  server_env.clear();
+
+  return writes_per_call;
+}
+
+TEST(WritesPerRpcTest, ConcurrentUnaryWithWriteCoalescing) {
+  const double uncoalesced = ConcurrentUnary(16, grpc_core::ChannelArgs());
+  const double coalesced = ConcurrentUnary(
+      16, grpc_core::ChannelArgs().Set(
+              GRPC_ARG_HTTP2_WRITE_COALESCING_WINDOW_MS, 1));
+  gpr_log(GPR_INFO, "writes per call: %.3f uncoalesced, %.3f coalesced",
+          uncoalesced, coalesced);
+  EXPECT_LT(coalesced, uncoalesced / 2);
+}
+
 }  // namespace testing
 }  // namespace grpc
 
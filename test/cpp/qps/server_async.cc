@@ -34,6 +34,11 @@
 #include <grpcpp/server_context.h>
 #include <grpcpp/support/config.h>
 
+#ifdef GPR_LINUX
+#include <pthread.h>
+#include <sched.h>
+#endif
+
 #include "src/core/lib/gprpp/host_port.h"
 #include "src/core/lib/surface/completion_queue.h"
 #include "src/proto/grpc/testing/benchmark_service.grpc.pb.h"
@@ -106,6 +111,16 @@ class AsyncQpsServerTest final : public grpc::testing::Server {
     for (int i = 0; i < num_threads; i++) {
       cq_.emplace_back(i % srv_cqs_.size());
     }
+    // With sharded listeners, pin the threads serving each completion queue
+    // to one core, taken from the config's core list if it has one, so that
+    // connections stay on the core whose listener accepted them.
+    if (ShardsListeners(config)) {
+      for (int i = 0; i < num_cqs; i++) {
+        cq_core_.push_back(config.core_list_size() > 0
+                               ? config.core_list(i % config.core_list_size())
+                               : i % cores());
+      }
+    }
 
     ApplyConfigToBuilder(config, builder.get());
 
@@ -203,7 +218,32 @@ class AsyncQpsServerTest final : public grpc::testing::Server {
   }
 
  private:
+  static bool ShardsListeners(const ServerConfig& config) {
+    for (const auto& arg : config.channel_args()) {
+      if (arg.name() == GRPC_ARG_SHARD_REUSEPORT_LISTENERS) {
+        return arg.int_value() != 0;
+      }
+    }
+    return false;
+  }
+
+  static void PinCurrentThreadToCore(int core) {
+#ifdef GPR_LINUX
+    cpu_set_t cpus;
+    CPU_ZERO(&cpus);
+    CPU_SET(core, &cpus);
+    if (pthread_setaffinity_np(pthread_self(), sizeof(cpus), &cpus) != 0) {
+      gpr_log(GPR_ERROR, "Failed to pin server thread to core %d", core);
+    }
+#else
+    (void)core;
+#endif
+  }
+
   void ThreadFunc(int thread_idx) {
+    if (!cq_core_.empty()) {
+      PinCurrentThreadToCore(cq_core_[cq_[thread_idx]]);
+    }
     // Wait until work is available or we are shutting down
     bool ok;
     void* got_tag;
@@ -524,6 +564,7 @@ class AsyncQpsServerTest final : public grpc::testing::Server {
   std::unique_ptr<grpc::Server> server_;
   std::vector<std::unique_ptr<grpc::ServerCompletionQueue>> srv_cqs_;
   std::vector<int> cq_;
+  std::vector<int> cq_core_;
   ServiceType async_service_;
   std::vector<std::unique_ptr<ServerRpcContext>> contexts_;
 
@@ -83,6 +83,24 @@ TEST_F(ServerBuilderTest, CreateServerRepeatedPortWithDisallowedReusePort) {
             nullptr);
 }
 
+TEST_F(ServerBuilderTest, CreateServerWithShardedCompletionQueue) {
+  ServerBuilder builder;
+  std::unique_ptr<ServerCompletionQueue> cq =
+      builder.AddCompletionQueue(/*is_frequently_polled=*/true,
+                                 /*is_sharded=*/true);
+  std::unique_ptr<Server> server =
+      builder.RegisterService(&g_service)
+          .AddListeningPort(GetPort(), InsecureServerCredentials())
+          .BuildAndStart();
+  ASSERT_NE(server, nullptr);
+  server->Shutdown();
+  cq->Shutdown();
+  void* tag;
+  bool ok;
+  while (cq->Next(&tag, &ok)) {
+  }
+}
+
 }  // namespace
 }  // namespace grpc
 
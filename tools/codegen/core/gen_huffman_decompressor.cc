@@ -1168,6 +1168,87 @@ void BuildCtx::AddMatchBody(TableBuilder* table_builder, std::string index,
   }
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// Fast path
+// While plenty of input remains, most symbols are short enough to decode
+// several at a time from one flat table, without the per symbol branching of
+// the generated steps.
+
+// Bits looked up at once: 4096 ops keep the table within 16KiB, so it stays
+// in cache, and cover every symbol in [a-zA-Z0-9] plus most punctuation.
+constexpr int kFastBits = 12;
+// Lookups per refill: each consumes at most kFastBits bits, and a refill
+// leaves at least 56 bits buffered.
+constexpr int kFastLookups = 4;
+
+// Each op is: first symbol | second symbol << 8 | symbol count << 16 |
+// consumed bits << 18. A count of zero means the next symbol is longer than
+// kFastBits, and consumes nothing.
+std::vector<uint32_t> FastOps() {
+  std::vector<uint32_t> ops;
+  for (int i = 0; i < (1 << kFastBits); i++) {
+    auto actions = ActionsFor(BitQueue(i, kFastBits), AllSyms(), true);
+    uint32_t op = 0;
+    for (size_t j = 0; j < actions.emit.size(); j++) {
+      if (actions.emit[j] == 256) abort();
+      op |= actions.emit[j] << (8 * j);
+    }
+    if (actions.emit.size() > 2) abort();
+    op |= static_cast<uint32_t>(actions.emit.size()) << 16;
+    op |= static_cast<uint32_t>(actions.consumed) << 18;
+    ops.push_back(op);
+  }
+  return ops;
+}
+
+void AddFastPath(Sink* global_fns, Sink* global_decls, Sink* global_values,
+                 Sink* out) {
+  const auto ops = FastOps();
+  std::vector<std::string> elems;
+  for (auto op : ops) {
+    elems.push_back(absl::StrCat("0x", absl::Hex(op, absl::kZeroPad8)));
+  }
+  global_fns->Add(
+      "static inline uint32_t GetFastOp(size_t i) { return fast_ops_[i]; }");
+  global_decls->Add(
+      absl::StrCat("static const uint32_t fast_ops_[", ops.size(), "];"));
+  global_values->Add(absl::StrCat(
+      "const uint32_t HuffDecoderCommon::fast_ops_[", ops.size(), "] = {"));
+  global_values->Add(absl::StrCat("  ", absl::StrJoin(elems, ", ")));
+  global_values->Add("};");
+  const std::string index =
+      absl::StrCat("(buffer_ >> (buffer_len_ - ", kFastBits, ")) & 0x",
+                   absl::Hex((1 << kFastBits) - 1));
+  out->Add(
+      "// Decode short symbols several at a time while at least 8 bytes of");
+  out->Add("// input remain, stopping before any symbol that the table can't");
+  out->Add("// decode.");
+  out->Add("void DecodeFast() {");
+  auto fn = out->Add<Indent>();
+  auto loop = fn->Add<While>("end_ - begin_ >= 8");
+  loop->Add("const int bytes = (63 - buffer_len_) / 8;");
+  loop->Add("uint64_t input = 0;");
+  loop->Add("for (int i = 0; i < 8; i++) input = (input << 8) | begin_[i];");
+  loop->Add(
+      "buffer_ = (buffer_ << (8 * bytes)) | (input >> 1 >> (63 - 8 * bytes));");
+  loop->Add("begin_ += bytes;");
+  loop->Add("buffer_len_ += 8 * bytes;");
+  loop->Add(absl::StrCat("const auto next = GetFastOp(", index, ");"));
+  loop->Add("if (((next >> 16) & 3) == 0) return;");
+  loop->Add(absl::StrCat("uint8_t emit[", 2 * kFastLookups, "];"));
+  loop->Add("int emit_len = 0;");
+  loop->Add(absl::StrCat("for (int i = 0; i < ", kFastLookups, "; i++) {"));
+  auto lookup = loop->Add<Indent>();
+  lookup->Add(absl::StrCat("const auto op = GetFastOp(", index, ");"));
+  lookup->Add("emit[emit_len] = static_cast<uint8_t>(op);");
+  lookup->Add("emit[emit_len + 1] = static_cast<uint8_t>(op >> 8);");
+  lookup->Add("emit_len += (op >> 16) & 3;");
+  lookup->Add("buffer_len_ -= op >> 18;");
+  loop->Add("}");
+  loop->Add("for (int i = 0; i < emit_len; i++) sink_(emit[i]);");
+  out->Add("}");
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Driver code
 
@@ -1209,6 +1290,7 @@ BuildOutput Build(std::vector<int> max_bits_for_depth) {
   hdr->Add(" private:");
   auto prv = hdr->Add<Indent>();
   FunMaker fun_maker(prv->Add<Sink>());
+  auto fast_path = prv->Add<Sink>();
   hdr->Add("};");
   hdr->Add("}  // namespace grpc_core");
   hdr->Add("#endif  // GRPC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_DECODE_HUFF_H");
@@ -1232,11 +1314,13 @@ BuildOutput Build(std::vector<int> max_bits_for_depth) {
   pub->Add("bool Run() {");
   auto body = pub->Add<Indent>();
   body->Add("while (!done_) {");
-  ctx.AddStep(AllSyms(), ctx.MaxBitsForTop(), true, true, 0,
-              body->Add<Indent>());
+  auto loop = body->Add<Indent>();
+  loop->Add("DecodeFast();");
+  ctx.AddStep(AllSyms(), ctx.MaxBitsForTop(), true, true, 0, loop);
   body->Add("}");
   body->Add("return ok_;");
   pub->Add("}");
+  AddFastPath(global_fns, global_decls, global_values, fast_path);
   return {hdr->ToString(), src->ToString()};
 }
 
@@ -315,6 +315,27 @@ class CXXLanguage(Language):
             server_threads_per_cq=1,
             categories=[SCALABLE])
 
+        # Offer far more load than one server thread can take, with queue
+        # delay admission control on: the server should shed the excess and
+        # keep the latency of the calls it does serve bounded.
+        for server_type, name in [
+            ('ASYNC_SERVER', 'cpp_protobuf_async_unary_overload'),
+            ('SYNC_SERVER', 'cpp_protobuf_async_client_sync_server_unary_overload')
+        ]:
+            overload_scenario = _ping_pong_scenario(
+                '%s_admission_control' % name,
+                rpc_type='UNARY',
+                client_type='ASYNC_CLIENT',
+                server_type=server_type,
+                unconstrained_client='async',
+                offered_load=200000,
+                secure=False,
+                async_server_threads=1,
+                categories=[SWEEP])
+            _add_channel_arg(overload_scenario['server_config'],
+                             'grpc.server_queue_delay_target_ms', 5)
+            yield overload_scenario
+
         for secure in [True, False]:
             secstr = 'secure' if secure else 'insecure'
             smoketest_categories = ([SMOKETEST] if secure else [])
@@ -438,6 +459,24 @@ class CXXLanguage(Language):
                 server_threads_per_cq=1000000,
                 categories=inproc_categories + [SCALABLE])
 
+            # One SO_REUSEPORT listener and one server thread per core, with
+            # every connection kept on the core whose listener accepted it.
+            # Compare with cpp_protobuf_async_unary_qps_unconstrained_*.
+            sharded_listeners_scenario = _ping_pong_scenario(
+                'cpp_protobuf_async_unary_qps_unconstrained_sharded_listeners_%s'
+                % secstr,
+                rpc_type='UNARY',
+                client_type='ASYNC_CLIENT',
+                server_type='ASYNC_SERVER',
+                unconstrained_client='async',
+                secure=secure,
+                minimal_stack=not secure,
+                server_threads_per_cq=1,
+                categories=[SCALABLE])
+            _add_channel_arg(sharded_listeners_scenario['server_config'],
+                             'grpc.shard_reuseport_listeners', 1)
+            yield sharded_listeners_scenario
+
             yield _ping_pong_scenario(
                 'cpp_generic_async_streaming_qps_one_server_core_%s' % secstr,
                 rpc_type='STREAMING',